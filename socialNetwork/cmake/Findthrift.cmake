@@ -54,6 +54,8 @@ find_path(THRIFT_STATIC_LIB_PATH libthrift.a PATHS ${THRIFT_LIB_PATHS})
 
 # prefer the thrift version supplied in THRIFT_HOME
 find_library(THRIFT_LIB NAMES thrift HINTS ${THRIFT_LIB_PATHS})
+# TNonblockingServer lives in the libevent based thriftnb library
+find_library(THRIFT_NB_LIB NAMES thriftnb HINTS ${THRIFT_LIB_PATHS})
 
 find_program(THRIFT_COMPILER thrift
     ${THRIFT_ROOT}/bin
@@ -86,6 +88,7 @@ endif ()
 
 mark_as_advanced(
     THRIFT_LIB
+    THRIFT_NB_LIB
     THRIFT_COMPILER
     THRIFT_INCLUDE_DIR
     thriftstatic
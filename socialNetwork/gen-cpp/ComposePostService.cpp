@@ -70,14 +70,14 @@ uint32_t ComposePostService_ComposePost_args::read(::apache::thrift::protocol::T
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->media_ids.clear();
-            uint32_t _size121;
-            ::apache::thrift::protocol::TType _etype124;
-            xfer += iprot->readListBegin(_etype124, _size121);
-            this->media_ids.resize(_size121);
-            uint32_t _i125;
-            for (_i125 = 0; _i125 < _size121; ++_i125)
+            uint32_t _size130;
+            ::apache::thrift::protocol::TType _etype133;
+            xfer += iprot->readListBegin(_etype133, _size130);
+            this->media_ids.resize(_size130);
+            uint32_t _i134;
+            for (_i134 = 0; _i134 < _size130; ++_i134)
             {
-              xfer += iprot->readI64(this->media_ids[_i125]);
+              xfer += iprot->readI64(this->media_ids[_i134]);
             }
             xfer += iprot->readListEnd();
           }
@@ -90,14 +90,14 @@ uint32_t ComposePostService_ComposePost_args::read(::apache::thrift::protocol::T
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->media_types.clear();
-            uint32_t _size126;
-            ::apache::thrift::protocol::TType _etype129;
-            xfer += iprot->readListBegin(_etype129, _size126);
-            this->media_types.resize(_size126);
-            uint32_t _i130;
-            for (_i130 = 0; _i130 < _size126; ++_i130)
+            uint32_t _size135;
+            ::apache::thrift::protocol::TType _etype138;
+            xfer += iprot->readListBegin(_etype138, _size135);
+            this->media_types.resize(_size135);
+            uint32_t _i139;
+            for (_i139 = 0; _i139 < _size135; ++_i139)
             {
-              xfer += iprot->readString(this->media_types[_i130]);
+              xfer += iprot->readString(this->media_types[_i139]);
             }
             xfer += iprot->readListEnd();
           }
@@ -120,17 +120,17 @@ uint32_t ComposePostService_ComposePost_args::read(::apache::thrift::protocol::T
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size132;
-            ::apache::thrift::protocol::TType _ktype133;
-            ::apache::thrift::protocol::TType _vtype134;
-            xfer += iprot->readMapBegin(_ktype133, _vtype134, _size132);
-            uint32_t _i136;
-            for (_i136 = 0; _i136 < _size132; ++_i136)
+            uint32_t _size141;
+            ::apache::thrift::protocol::TType _ktype142;
+            ::apache::thrift::protocol::TType _vtype143;
+            xfer += iprot->readMapBegin(_ktype142, _vtype143, _size141);
+            uint32_t _i145;
+            for (_i145 = 0; _i145 < _size141; ++_i145)
             {
-              std::string _key137;
-              xfer += iprot->readString(_key137);
-              std::string& _val138 = this->carrier[_key137];
-              xfer += iprot->readString(_val138);
+              std::string _key146;
+              xfer += iprot->readString(_key146);
+              std::string& _val147 = this->carrier[_key146];
+              xfer += iprot->readString(_val147);
             }
             xfer += iprot->readMapEnd();
           }
@@ -175,10 +175,10 @@ uint32_t ComposePostService_ComposePost_args::write(::apache::thrift::protocol::
   xfer += oprot->writeFieldBegin("media_ids", ::apache::thrift::protocol::T_LIST, 5);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->media_ids.size()));
-    std::vector<int64_t> ::const_iterator _iter139;
-    for (_iter139 = this->media_ids.begin(); _iter139 != this->media_ids.end(); ++_iter139)
+    std::vector<int64_t> ::const_iterator _iter148;
+    for (_iter148 = this->media_ids.begin(); _iter148 != this->media_ids.end(); ++_iter148)
     {
-      xfer += oprot->writeI64((*_iter139));
+      xfer += oprot->writeI64((*_iter148));
     }
     xfer += oprot->writeListEnd();
   }
@@ -187,10 +187,10 @@ uint32_t ComposePostService_ComposePost_args::write(::apache::thrift::protocol::
   xfer += oprot->writeFieldBegin("media_types", ::apache::thrift::protocol::T_LIST, 6);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->media_types.size()));
-    std::vector<std::string> ::const_iterator _iter140;
-    for (_iter140 = this->media_types.begin(); _iter140 != this->media_types.end(); ++_iter140)
+    std::vector<std::string> ::const_iterator _iter149;
+    for (_iter149 = this->media_types.begin(); _iter149 != this->media_types.end(); ++_iter149)
     {
-      xfer += oprot->writeString((*_iter140));
+      xfer += oprot->writeString((*_iter149));
     }
     xfer += oprot->writeListEnd();
   }
@@ -203,11 +203,11 @@ uint32_t ComposePostService_ComposePost_args::write(::apache::thrift::protocol::
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 8);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter141;
-    for (_iter141 = this->carrier.begin(); _iter141 != this->carrier.end(); ++_iter141)
+    std::map<std::string, std::string> ::const_iterator _iter150;
+    for (_iter150 = this->carrier.begin(); _iter150 != this->carrier.end(); ++_iter150)
     {
-      xfer += oprot->writeString(_iter141->first);
-      xfer += oprot->writeString(_iter141->second);
+      xfer += oprot->writeString(_iter150->first);
+      xfer += oprot->writeString(_iter150->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -247,10 +247,10 @@ uint32_t ComposePostService_ComposePost_pargs::write(::apache::thrift::protocol:
   xfer += oprot->writeFieldBegin("media_ids", ::apache::thrift::protocol::T_LIST, 5);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*(this->media_ids)).size()));
-    std::vector<int64_t> ::const_iterator _iter142;
-    for (_iter142 = (*(this->media_ids)).begin(); _iter142 != (*(this->media_ids)).end(); ++_iter142)
+    std::vector<int64_t> ::const_iterator _iter151;
+    for (_iter151 = (*(this->media_ids)).begin(); _iter151 != (*(this->media_ids)).end(); ++_iter151)
     {
-      xfer += oprot->writeI64((*_iter142));
+      xfer += oprot->writeI64((*_iter151));
     }
     xfer += oprot->writeListEnd();
   }
@@ -259,10 +259,10 @@ uint32_t ComposePostService_ComposePost_pargs::write(::apache::thrift::protocol:
   xfer += oprot->writeFieldBegin("media_types", ::apache::thrift::protocol::T_LIST, 6);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->media_types)).size()));
-    std::vector<std::string> ::const_iterator _iter143;
-    for (_iter143 = (*(this->media_types)).begin(); _iter143 != (*(this->media_types)).end(); ++_iter143)
+    std::vector<std::string> ::const_iterator _iter152;
+    for (_iter152 = (*(this->media_types)).begin(); _iter152 != (*(this->media_types)).end(); ++_iter152)
     {
-      xfer += oprot->writeString((*_iter143));
+      xfer += oprot->writeString((*_iter152));
     }
     xfer += oprot->writeListEnd();
   }
@@ -275,11 +275,11 @@ uint32_t ComposePostService_ComposePost_pargs::write(::apache::thrift::protocol:
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 8);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter144;
-    for (_iter144 = (*(this->carrier)).begin(); _iter144 != (*(this->carrier)).end(); ++_iter144)
+    std::map<std::string, std::string> ::const_iterator _iter153;
+    for (_iter153 = (*(this->carrier)).begin(); _iter153 != (*(this->carrier)).end(); ++_iter153)
     {
-      xfer += oprot->writeString(_iter144->first);
-      xfer += oprot->writeString(_iter144->second);
+      xfer += oprot->writeString(_iter153->first);
+      xfer += oprot->writeString(_iter153->second);
     }
     xfer += oprot->writeMapEnd();
   }
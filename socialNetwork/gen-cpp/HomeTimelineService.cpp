@@ -70,17 +70,17 @@ uint32_t HomeTimelineService_ReadHomeTimeline_args::read(::apache::thrift::proto
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size190;
-            ::apache::thrift::protocol::TType _ktype191;
-            ::apache::thrift::protocol::TType _vtype192;
-            xfer += iprot->readMapBegin(_ktype191, _vtype192, _size190);
-            uint32_t _i194;
-            for (_i194 = 0; _i194 < _size190; ++_i194)
+            uint32_t _size199;
+            ::apache::thrift::protocol::TType _ktype200;
+            ::apache::thrift::protocol::TType _vtype201;
+            xfer += iprot->readMapBegin(_ktype200, _vtype201, _size199);
+            uint32_t _i203;
+            for (_i203 = 0; _i203 < _size199; ++_i203)
             {
-              std::string _key195;
-              xfer += iprot->readString(_key195);
-              std::string& _val196 = this->carrier[_key195];
-              xfer += iprot->readString(_val196);
+              std::string _key204;
+              xfer += iprot->readString(_key204);
+              std::string& _val205 = this->carrier[_key204];
+              xfer += iprot->readString(_val205);
             }
             xfer += iprot->readMapEnd();
           }
@@ -125,11 +125,11 @@ uint32_t HomeTimelineService_ReadHomeTimeline_args::write(::apache::thrift::prot
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 5);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter197;
-    for (_iter197 = this->carrier.begin(); _iter197 != this->carrier.end(); ++_iter197)
+    std::map<std::string, std::string> ::const_iterator _iter206;
+    for (_iter206 = this->carrier.begin(); _iter206 != this->carrier.end(); ++_iter206)
     {
-      xfer += oprot->writeString(_iter197->first);
-      xfer += oprot->writeString(_iter197->second);
+      xfer += oprot->writeString(_iter206->first);
+      xfer += oprot->writeString(_iter206->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -169,11 +169,11 @@ uint32_t HomeTimelineService_ReadHomeTimeline_pargs::write(::apache::thrift::pro
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 5);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter198;
-    for (_iter198 = (*(this->carrier)).begin(); _iter198 != (*(this->carrier)).end(); ++_iter198)
+    std::map<std::string, std::string> ::const_iterator _iter207;
+    for (_iter207 = (*(this->carrier)).begin(); _iter207 != (*(this->carrier)).end(); ++_iter207)
     {
-      xfer += oprot->writeString(_iter198->first);
-      xfer += oprot->writeString(_iter198->second);
+      xfer += oprot->writeString(_iter207->first);
+      xfer += oprot->writeString(_iter207->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -214,14 +214,14 @@ uint32_t HomeTimelineService_ReadHomeTimeline_result::read(::apache::thrift::pro
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size199;
-            ::apache::thrift::protocol::TType _etype202;
-            xfer += iprot->readListBegin(_etype202, _size199);
-            this->success.resize(_size199);
-            uint32_t _i203;
-            for (_i203 = 0; _i203 < _size199; ++_i203)
+            uint32_t _size208;
+            ::apache::thrift::protocol::TType _etype211;
+            xfer += iprot->readListBegin(_etype211, _size208);
+            this->success.resize(_size208);
+            uint32_t _i212;
+            for (_i212 = 0; _i212 < _size208; ++_i212)
             {
-              xfer += this->success[_i203].read(iprot);
+              xfer += this->success[_i212].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -260,10 +260,10 @@ uint32_t HomeTimelineService_ReadHomeTimeline_result::write(::apache::thrift::pr
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<Post> ::const_iterator _iter204;
-      for (_iter204 = this->success.begin(); _iter204 != this->success.end(); ++_iter204)
+      std::vector<Post> ::const_iterator _iter213;
+      for (_iter213 = this->success.begin(); _iter213 != this->success.end(); ++_iter213)
       {
-        xfer += (*_iter204).write(oprot);
+        xfer += (*_iter213).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -308,14 +308,14 @@ uint32_t HomeTimelineService_ReadHomeTimeline_presult::read(::apache::thrift::pr
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size205;
-            ::apache::thrift::protocol::TType _etype208;
-            xfer += iprot->readListBegin(_etype208, _size205);
-            (*(this->success)).resize(_size205);
-            uint32_t _i209;
-            for (_i209 = 0; _i209 < _size205; ++_i209)
+            uint32_t _size214;
+            ::apache::thrift::protocol::TType _etype217;
+            xfer += iprot->readListBegin(_etype217, _size214);
+            (*(this->success)).resize(_size214);
+            uint32_t _i218;
+            for (_i218 = 0; _i218 < _size214; ++_i218)
             {
-              xfer += (*(this->success))[_i209].read(iprot);
+              xfer += (*(this->success))[_i218].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -406,14 +406,14 @@ uint32_t HomeTimelineService_WriteHomeTimeline_args::read(::apache::thrift::prot
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->user_mentions_id.clear();
-            uint32_t _size210;
-            ::apache::thrift::protocol::TType _etype213;
-            xfer += iprot->readListBegin(_etype213, _size210);
-            this->user_mentions_id.resize(_size210);
-            uint32_t _i214;
-            for (_i214 = 0; _i214 < _size210; ++_i214)
+            uint32_t _size219;
+            ::apache::thrift::protocol::TType _etype222;
+            xfer += iprot->readListBegin(_etype222, _size219);
+            this->user_mentions_id.resize(_size219);
+            uint32_t _i223;
+            for (_i223 = 0; _i223 < _size219; ++_i223)
             {
-              xfer += iprot->readI64(this->user_mentions_id[_i214]);
+              xfer += iprot->readI64(this->user_mentions_id[_i223]);
             }
             xfer += iprot->readListEnd();
           }
@@ -426,17 +426,17 @@ uint32_t HomeTimelineService_WriteHomeTimeline_args::read(::apache::thrift::prot
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size215;
-            ::apache::thrift::protocol::TType _ktype216;
-            ::apache::thrift::protocol::TType _vtype217;
-            xfer += iprot->readMapBegin(_ktype216, _vtype217, _size215);
-            uint32_t _i219;
-            for (_i219 = 0; _i219 < _size215; ++_i219)
+            uint32_t _size224;
+            ::apache::thrift::protocol::TType _ktype225;
+            ::apache::thrift::protocol::TType _vtype226;
+            xfer += iprot->readMapBegin(_ktype225, _vtype226, _size224);
+            uint32_t _i228;
+            for (_i228 = 0; _i228 < _size224; ++_i228)
             {
-              std::string _key220;
-              xfer += iprot->readString(_key220);
-              std::string& _val221 = this->carrier[_key220];
-              xfer += iprot->readString(_val221);
+              std::string _key229;
+              xfer += iprot->readString(_key229);
+              std::string& _val230 = this->carrier[_key229];
+              xfer += iprot->readString(_val230);
             }
             xfer += iprot->readMapEnd();
           }
@@ -481,10 +481,10 @@ uint32_t HomeTimelineService_WriteHomeTimeline_args::write(::apache::thrift::pro
   xfer += oprot->writeFieldBegin("user_mentions_id", ::apache::thrift::protocol::T_LIST, 5);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->user_mentions_id.size()));
-    std::vector<int64_t> ::const_iterator _iter222;
-    for (_iter222 = this->user_mentions_id.begin(); _iter222 != this->user_mentions_id.end(); ++_iter222)
+    std::vector<int64_t> ::const_iterator _iter231;
+    for (_iter231 = this->user_mentions_id.begin(); _iter231 != this->user_mentions_id.end(); ++_iter231)
     {
-      xfer += oprot->writeI64((*_iter222));
+      xfer += oprot->writeI64((*_iter231));
     }
     xfer += oprot->writeListEnd();
   }
@@ -493,11 +493,11 @@ uint32_t HomeTimelineService_WriteHomeTimeline_args::write(::apache::thrift::pro
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 6);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter223;
-    for (_iter223 = this->carrier.begin(); _iter223 != this->carrier.end(); ++_iter223)
+    std::map<std::string, std::string> ::const_iterator _iter232;
+    for (_iter232 = this->carrier.begin(); _iter232 != this->carrier.end(); ++_iter232)
     {
-      xfer += oprot->writeString(_iter223->first);
-      xfer += oprot->writeString(_iter223->second);
+      xfer += oprot->writeString(_iter232->first);
+      xfer += oprot->writeString(_iter232->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -537,10 +537,10 @@ uint32_t HomeTimelineService_WriteHomeTimeline_pargs::write(::apache::thrift::pr
   xfer += oprot->writeFieldBegin("user_mentions_id", ::apache::thrift::protocol::T_LIST, 5);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>((*(this->user_mentions_id)).size()));
-    std::vector<int64_t> ::const_iterator _iter224;
-    for (_iter224 = (*(this->user_mentions_id)).begin(); _iter224 != (*(this->user_mentions_id)).end(); ++_iter224)
+    std::vector<int64_t> ::const_iterator _iter233;
+    for (_iter233 = (*(this->user_mentions_id)).begin(); _iter233 != (*(this->user_mentions_id)).end(); ++_iter233)
     {
-      xfer += oprot->writeI64((*_iter224));
+      xfer += oprot->writeI64((*_iter233));
     }
     xfer += oprot->writeListEnd();
   }
@@ -549,11 +549,11 @@ uint32_t HomeTimelineService_WriteHomeTimeline_pargs::write(::apache::thrift::pr
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 6);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter225;
-    for (_iter225 = (*(this->carrier)).begin(); _iter225 != (*(this->carrier)).end(); ++_iter225)
+    std::map<std::string, std::string> ::const_iterator _iter234;
+    for (_iter234 = (*(this->carrier)).begin(); _iter234 != (*(this->carrier)).end(); ++_iter234)
     {
-      xfer += oprot->writeString(_iter225->first);
-      xfer += oprot->writeString(_iter225->second);
+      xfer += oprot->writeString(_iter234->first);
+      xfer += oprot->writeString(_iter234->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -54,17 +54,17 @@ uint32_t SocialGraphService_GetFollowers_args::read(::apache::thrift::protocol::
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size255;
-            ::apache::thrift::protocol::TType _ktype256;
-            ::apache::thrift::protocol::TType _vtype257;
-            xfer += iprot->readMapBegin(_ktype256, _vtype257, _size255);
-            uint32_t _i259;
-            for (_i259 = 0; _i259 < _size255; ++_i259)
+            uint32_t _size288;
+            ::apache::thrift::protocol::TType _ktype289;
+            ::apache::thrift::protocol::TType _vtype290;
+            xfer += iprot->readMapBegin(_ktype289, _vtype290, _size288);
+            uint32_t _i292;
+            for (_i292 = 0; _i292 < _size288; ++_i292)
             {
-              std::string _key260;
-              xfer += iprot->readString(_key260);
-              std::string& _val261 = this->carrier[_key260];
-              xfer += iprot->readString(_val261);
+              std::string _key293;
+              xfer += iprot->readString(_key293);
+              std::string& _val294 = this->carrier[_key293];
+              xfer += iprot->readString(_val294);
             }
             xfer += iprot->readMapEnd();
           }
@@ -101,11 +101,11 @@ uint32_t SocialGraphService_GetFollowers_args::write(::apache::thrift::protocol:
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter262;
-    for (_iter262 = this->carrier.begin(); _iter262 != this->carrier.end(); ++_iter262)
+    std::map<std::string, std::string> ::const_iterator _iter295;
+    for (_iter295 = this->carrier.begin(); _iter295 != this->carrier.end(); ++_iter295)
     {
-      xfer += oprot->writeString(_iter262->first);
-      xfer += oprot->writeString(_iter262->second);
+      xfer += oprot->writeString(_iter295->first);
+      xfer += oprot->writeString(_iter295->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -137,11 +137,11 @@ uint32_t SocialGraphService_GetFollowers_pargs::write(::apache::thrift::protocol
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter263;
-    for (_iter263 = (*(this->carrier)).begin(); _iter263 != (*(this->carrier)).end(); ++_iter263)
+    std::map<std::string, std::string> ::const_iterator _iter296;
+    for (_iter296 = (*(this->carrier)).begin(); _iter296 != (*(this->carrier)).end(); ++_iter296)
     {
-      xfer += oprot->writeString(_iter263->first);
-      xfer += oprot->writeString(_iter263->second);
+      xfer += oprot->writeString(_iter296->first);
+      xfer += oprot->writeString(_iter296->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -182,14 +182,14 @@ uint32_t SocialGraphService_GetFollowers_result::read(::apache::thrift::protocol
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size264;
-            ::apache::thrift::protocol::TType _etype267;
-            xfer += iprot->readListBegin(_etype267, _size264);
-            this->success.resize(_size264);
-            uint32_t _i268;
-            for (_i268 = 0; _i268 < _size264; ++_i268)
+            uint32_t _size297;
+            ::apache::thrift::protocol::TType _etype300;
+            xfer += iprot->readListBegin(_etype300, _size297);
+            this->success.resize(_size297);
+            uint32_t _i301;
+            for (_i301 = 0; _i301 < _size297; ++_i301)
             {
-              xfer += iprot->readI64(this->success[_i268]);
+              xfer += iprot->readI64(this->success[_i301]);
             }
             xfer += iprot->readListEnd();
           }
@@ -228,10 +228,10 @@ uint32_t SocialGraphService_GetFollowers_result::write(::apache::thrift::protoco
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->success.size()));
-      std::vector<int64_t> ::const_iterator _iter269;
-      for (_iter269 = this->success.begin(); _iter269 != this->success.end(); ++_iter269)
+      std::vector<int64_t> ::const_iterator _iter302;
+      for (_iter302 = this->success.begin(); _iter302 != this->success.end(); ++_iter302)
       {
-        xfer += oprot->writeI64((*_iter269));
+        xfer += oprot->writeI64((*_iter302));
       }
       xfer += oprot->writeListEnd();
     }
@@ -276,14 +276,14 @@ uint32_t SocialGraphService_GetFollowers_presult::read(::apache::thrift::protoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size270;
-            ::apache::thrift::protocol::TType _etype273;
-            xfer += iprot->readListBegin(_etype273, _size270);
-            (*(this->success)).resize(_size270);
-            uint32_t _i274;
-            for (_i274 = 0; _i274 < _size270; ++_i274)
+            uint32_t _size303;
+            ::apache::thrift::protocol::TType _etype306;
+            xfer += iprot->readListBegin(_etype306, _size303);
+            (*(this->success)).resize(_size303);
+            uint32_t _i307;
+            for (_i307 = 0; _i307 < _size303; ++_i307)
             {
-              xfer += iprot->readI64((*(this->success))[_i274]);
+              xfer += iprot->readI64((*(this->success))[_i307]);
             }
             xfer += iprot->readListEnd();
           }
@@ -358,17 +358,17 @@ uint32_t SocialGraphService_GetFollowees_args::read(::apache::thrift::protocol::
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size275;
-            ::apache::thrift::protocol::TType _ktype276;
-            ::apache::thrift::protocol::TType _vtype277;
-            xfer += iprot->readMapBegin(_ktype276, _vtype277, _size275);
-            uint32_t _i279;
-            for (_i279 = 0; _i279 < _size275; ++_i279)
+            uint32_t _size308;
+            ::apache::thrift::protocol::TType _ktype309;
+            ::apache::thrift::protocol::TType _vtype310;
+            xfer += iprot->readMapBegin(_ktype309, _vtype310, _size308);
+            uint32_t _i312;
+            for (_i312 = 0; _i312 < _size308; ++_i312)
             {
-              std::string _key280;
-              xfer += iprot->readString(_key280);
-              std::string& _val281 = this->carrier[_key280];
-              xfer += iprot->readString(_val281);
+              std::string _key313;
+              xfer += iprot->readString(_key313);
+              std::string& _val314 = this->carrier[_key313];
+              xfer += iprot->readString(_val314);
             }
             xfer += iprot->readMapEnd();
           }
@@ -405,11 +405,11 @@ uint32_t SocialGraphService_GetFollowees_args::write(::apache::thrift::protocol:
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter282;
-    for (_iter282 = this->carrier.begin(); _iter282 != this->carrier.end(); ++_iter282)
+    std::map<std::string, std::string> ::const_iterator _iter315;
+    for (_iter315 = this->carrier.begin(); _iter315 != this->carrier.end(); ++_iter315)
     {
-      xfer += oprot->writeString(_iter282->first);
-      xfer += oprot->writeString(_iter282->second);
+      xfer += oprot->writeString(_iter315->first);
+      xfer += oprot->writeString(_iter315->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -441,11 +441,11 @@ uint32_t SocialGraphService_GetFollowees_pargs::write(::apache::thrift::protocol
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter283;
-    for (_iter283 = (*(this->carrier)).begin(); _iter283 != (*(this->carrier)).end(); ++_iter283)
+    std::map<std::string, std::string> ::const_iterator _iter316;
+    for (_iter316 = (*(this->carrier)).begin(); _iter316 != (*(this->carrier)).end(); ++_iter316)
     {
-      xfer += oprot->writeString(_iter283->first);
-      xfer += oprot->writeString(_iter283->second);
+      xfer += oprot->writeString(_iter316->first);
+      xfer += oprot->writeString(_iter316->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -486,14 +486,14 @@ uint32_t SocialGraphService_GetFollowees_result::read(::apache::thrift::protocol
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size284;
-            ::apache::thrift::protocol::TType _etype287;
-            xfer += iprot->readListBegin(_etype287, _size284);
-            this->success.resize(_size284);
-            uint32_t _i288;
-            for (_i288 = 0; _i288 < _size284; ++_i288)
+            uint32_t _size317;
+            ::apache::thrift::protocol::TType _etype320;
+            xfer += iprot->readListBegin(_etype320, _size317);
+            this->success.resize(_size317);
+            uint32_t _i321;
+            for (_i321 = 0; _i321 < _size317; ++_i321)
             {
-              xfer += iprot->readI64(this->success[_i288]);
+              xfer += iprot->readI64(this->success[_i321]);
             }
             xfer += iprot->readListEnd();
           }
@@ -532,10 +532,10 @@ uint32_t SocialGraphService_GetFollowees_result::write(::apache::thrift::protoco
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->success.size()));
-      std::vector<int64_t> ::const_iterator _iter289;
-      for (_iter289 = this->success.begin(); _iter289 != this->success.end(); ++_iter289)
+      std::vector<int64_t> ::const_iterator _iter322;
+      for (_iter322 = this->success.begin(); _iter322 != this->success.end(); ++_iter322)
       {
-        xfer += oprot->writeI64((*_iter289));
+        xfer += oprot->writeI64((*_iter322));
       }
       xfer += oprot->writeListEnd();
     }
@@ -580,14 +580,14 @@ uint32_t SocialGraphService_GetFollowees_presult::read(::apache::thrift::protoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size290;
-            ::apache::thrift::protocol::TType _etype293;
-            xfer += iprot->readListBegin(_etype293, _size290);
-            (*(this->success)).resize(_size290);
-            uint32_t _i294;
-            for (_i294 = 0; _i294 < _size290; ++_i294)
+            uint32_t _size323;
+            ::apache::thrift::protocol::TType _etype326;
+            xfer += iprot->readListBegin(_etype326, _size323);
+            (*(this->success)).resize(_size323);
+            uint32_t _i327;
+            for (_i327 = 0; _i327 < _size323; ++_i327)
             {
-              xfer += iprot->readI64((*(this->success))[_i294]);
+              xfer += iprot->readI64((*(this->success))[_i327]);
             }
             xfer += iprot->readListEnd();
           }
@@ -670,17 +670,17 @@ uint32_t SocialGraphService_Follow_args::read(::apache::thrift::protocol::TProto
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size295;
-            ::apache::thrift::protocol::TType _ktype296;
-            ::apache::thrift::protocol::TType _vtype297;
-            xfer += iprot->readMapBegin(_ktype296, _vtype297, _size295);
-            uint32_t _i299;
-            for (_i299 = 0; _i299 < _size295; ++_i299)
+            uint32_t _size328;
+            ::apache::thrift::protocol::TType _ktype329;
+            ::apache::thrift::protocol::TType _vtype330;
+            xfer += iprot->readMapBegin(_ktype329, _vtype330, _size328);
+            uint32_t _i332;
+            for (_i332 = 0; _i332 < _size328; ++_i332)
             {
-              std::string _key300;
-              xfer += iprot->readString(_key300);
-              std::string& _val301 = this->carrier[_key300];
-              xfer += iprot->readString(_val301);
+              std::string _key333;
+              xfer += iprot->readString(_key333);
+              std::string& _val334 = this->carrier[_key333];
+              xfer += iprot->readString(_val334);
             }
             xfer += iprot->readMapEnd();
           }
@@ -721,11 +721,11 @@ uint32_t SocialGraphService_Follow_args::write(::apache::thrift::protocol::TProt
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter302;
-    for (_iter302 = this->carrier.begin(); _iter302 != this->carrier.end(); ++_iter302)
+    std::map<std::string, std::string> ::const_iterator _iter335;
+    for (_iter335 = this->carrier.begin(); _iter335 != this->carrier.end(); ++_iter335)
     {
-      xfer += oprot->writeString(_iter302->first);
-      xfer += oprot->writeString(_iter302->second);
+      xfer += oprot->writeString(_iter335->first);
+      xfer += oprot->writeString(_iter335->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -761,11 +761,11 @@ uint32_t SocialGraphService_Follow_pargs::write(::apache::thrift::protocol::TPro
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter303;
-    for (_iter303 = (*(this->carrier)).begin(); _iter303 != (*(this->carrier)).end(); ++_iter303)
+    std::map<std::string, std::string> ::const_iterator _iter336;
+    for (_iter336 = (*(this->carrier)).begin(); _iter336 != (*(this->carrier)).end(); ++_iter336)
     {
-      xfer += oprot->writeString(_iter303->first);
-      xfer += oprot->writeString(_iter303->second);
+      xfer += oprot->writeString(_iter336->first);
+      xfer += oprot->writeString(_iter336->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -938,17 +938,17 @@ uint32_t SocialGraphService_Unfollow_args::read(::apache::thrift::protocol::TPro
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size304;
-            ::apache::thrift::protocol::TType _ktype305;
-            ::apache::thrift::protocol::TType _vtype306;
-            xfer += iprot->readMapBegin(_ktype305, _vtype306, _size304);
-            uint32_t _i308;
-            for (_i308 = 0; _i308 < _size304; ++_i308)
+            uint32_t _size337;
+            ::apache::thrift::protocol::TType _ktype338;
+            ::apache::thrift::protocol::TType _vtype339;
+            xfer += iprot->readMapBegin(_ktype338, _vtype339, _size337);
+            uint32_t _i341;
+            for (_i341 = 0; _i341 < _size337; ++_i341)
             {
-              std::string _key309;
-              xfer += iprot->readString(_key309);
-              std::string& _val310 = this->carrier[_key309];
-              xfer += iprot->readString(_val310);
+              std::string _key342;
+              xfer += iprot->readString(_key342);
+              std::string& _val343 = this->carrier[_key342];
+              xfer += iprot->readString(_val343);
             }
             xfer += iprot->readMapEnd();
           }
@@ -989,11 +989,11 @@ uint32_t SocialGraphService_Unfollow_args::write(::apache::thrift::protocol::TPr
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter311;
-    for (_iter311 = this->carrier.begin(); _iter311 != this->carrier.end(); ++_iter311)
+    std::map<std::string, std::string> ::const_iterator _iter344;
+    for (_iter344 = this->carrier.begin(); _iter344 != this->carrier.end(); ++_iter344)
     {
-      xfer += oprot->writeString(_iter311->first);
-      xfer += oprot->writeString(_iter311->second);
+      xfer += oprot->writeString(_iter344->first);
+      xfer += oprot->writeString(_iter344->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1029,11 +1029,11 @@ uint32_t SocialGraphService_Unfollow_pargs::write(::apache::thrift::protocol::TP
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter312;
-    for (_iter312 = (*(this->carrier)).begin(); _iter312 != (*(this->carrier)).end(); ++_iter312)
+    std::map<std::string, std::string> ::const_iterator _iter345;
+    for (_iter345 = (*(this->carrier)).begin(); _iter345 != (*(this->carrier)).end(); ++_iter345)
     {
-      xfer += oprot->writeString(_iter312->first);
-      xfer += oprot->writeString(_iter312->second);
+      xfer += oprot->writeString(_iter345->first);
+      xfer += oprot->writeString(_iter345->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1206,17 +1206,17 @@ uint32_t SocialGraphService_FollowWithUsername_args::read(::apache::thrift::prot
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size313;
-            ::apache::thrift::protocol::TType _ktype314;
-            ::apache::thrift::protocol::TType _vtype315;
-            xfer += iprot->readMapBegin(_ktype314, _vtype315, _size313);
-            uint32_t _i317;
-            for (_i317 = 0; _i317 < _size313; ++_i317)
+            uint32_t _size346;
+            ::apache::thrift::protocol::TType _ktype347;
+            ::apache::thrift::protocol::TType _vtype348;
+            xfer += iprot->readMapBegin(_ktype347, _vtype348, _size346);
+            uint32_t _i350;
+            for (_i350 = 0; _i350 < _size346; ++_i350)
             {
-              std::string _key318;
-              xfer += iprot->readString(_key318);
-              std::string& _val319 = this->carrier[_key318];
-              xfer += iprot->readString(_val319);
+              std::string _key351;
+              xfer += iprot->readString(_key351);
+              std::string& _val352 = this->carrier[_key351];
+              xfer += iprot->readString(_val352);
             }
             xfer += iprot->readMapEnd();
           }
@@ -1257,11 +1257,11 @@ uint32_t SocialGraphService_FollowWithUsername_args::write(::apache::thrift::pro
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter320;
-    for (_iter320 = this->carrier.begin(); _iter320 != this->carrier.end(); ++_iter320)
+    std::map<std::string, std::string> ::const_iterator _iter353;
+    for (_iter353 = this->carrier.begin(); _iter353 != this->carrier.end(); ++_iter353)
     {
-      xfer += oprot->writeString(_iter320->first);
-      xfer += oprot->writeString(_iter320->second);
+      xfer += oprot->writeString(_iter353->first);
+      xfer += oprot->writeString(_iter353->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1297,11 +1297,11 @@ uint32_t SocialGraphService_FollowWithUsername_pargs::write(::apache::thrift::pr
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter321;
-    for (_iter321 = (*(this->carrier)).begin(); _iter321 != (*(this->carrier)).end(); ++_iter321)
+    std::map<std::string, std::string> ::const_iterator _iter354;
+    for (_iter354 = (*(this->carrier)).begin(); _iter354 != (*(this->carrier)).end(); ++_iter354)
     {
-      xfer += oprot->writeString(_iter321->first);
-      xfer += oprot->writeString(_iter321->second);
+      xfer += oprot->writeString(_iter354->first);
+      xfer += oprot->writeString(_iter354->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1474,17 +1474,17 @@ uint32_t SocialGraphService_UnfollowWithUsername_args::read(::apache::thrift::pr
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size322;
-            ::apache::thrift::protocol::TType _ktype323;
-            ::apache::thrift::protocol::TType _vtype324;
-            xfer += iprot->readMapBegin(_ktype323, _vtype324, _size322);
-            uint32_t _i326;
-            for (_i326 = 0; _i326 < _size322; ++_i326)
+            uint32_t _size355;
+            ::apache::thrift::protocol::TType _ktype356;
+            ::apache::thrift::protocol::TType _vtype357;
+            xfer += iprot->readMapBegin(_ktype356, _vtype357, _size355);
+            uint32_t _i359;
+            for (_i359 = 0; _i359 < _size355; ++_i359)
             {
-              std::string _key327;
-              xfer += iprot->readString(_key327);
-              std::string& _val328 = this->carrier[_key327];
-              xfer += iprot->readString(_val328);
+              std::string _key360;
+              xfer += iprot->readString(_key360);
+              std::string& _val361 = this->carrier[_key360];
+              xfer += iprot->readString(_val361);
             }
             xfer += iprot->readMapEnd();
           }
@@ -1525,11 +1525,11 @@ uint32_t SocialGraphService_UnfollowWithUsername_args::write(::apache::thrift::p
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter329;
-    for (_iter329 = this->carrier.begin(); _iter329 != this->carrier.end(); ++_iter329)
+    std::map<std::string, std::string> ::const_iterator _iter362;
+    for (_iter362 = this->carrier.begin(); _iter362 != this->carrier.end(); ++_iter362)
     {
-      xfer += oprot->writeString(_iter329->first);
-      xfer += oprot->writeString(_iter329->second);
+      xfer += oprot->writeString(_iter362->first);
+      xfer += oprot->writeString(_iter362->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1565,11 +1565,11 @@ uint32_t SocialGraphService_UnfollowWithUsername_pargs::write(::apache::thrift::
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter330;
-    for (_iter330 = (*(this->carrier)).begin(); _iter330 != (*(this->carrier)).end(); ++_iter330)
+    std::map<std::string, std::string> ::const_iterator _iter363;
+    for (_iter363 = (*(this->carrier)).begin(); _iter363 != (*(this->carrier)).end(); ++_iter363)
     {
-      xfer += oprot->writeString(_iter330->first);
-      xfer += oprot->writeString(_iter330->second);
+      xfer += oprot->writeString(_iter363->first);
+      xfer += oprot->writeString(_iter363->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1734,17 +1734,17 @@ uint32_t SocialGraphService_InsertUser_args::read(::apache::thrift::protocol::TP
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size331;
-            ::apache::thrift::protocol::TType _ktype332;
-            ::apache::thrift::protocol::TType _vtype333;
-            xfer += iprot->readMapBegin(_ktype332, _vtype333, _size331);
-            uint32_t _i335;
-            for (_i335 = 0; _i335 < _size331; ++_i335)
+            uint32_t _size364;
+            ::apache::thrift::protocol::TType _ktype365;
+            ::apache::thrift::protocol::TType _vtype366;
+            xfer += iprot->readMapBegin(_ktype365, _vtype366, _size364);
+            uint32_t _i368;
+            for (_i368 = 0; _i368 < _size364; ++_i368)
             {
-              std::string _key336;
-              xfer += iprot->readString(_key336);
-              std::string& _val337 = this->carrier[_key336];
-              xfer += iprot->readString(_val337);
+              std::string _key369;
+              xfer += iprot->readString(_key369);
+              std::string& _val370 = this->carrier[_key369];
+              xfer += iprot->readString(_val370);
             }
             xfer += iprot->readMapEnd();
           }
@@ -1781,11 +1781,11 @@ uint32_t SocialGraphService_InsertUser_args::write(::apache::thrift::protocol::T
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter338;
-    for (_iter338 = this->carrier.begin(); _iter338 != this->carrier.end(); ++_iter338)
+    std::map<std::string, std::string> ::const_iterator _iter371;
+    for (_iter371 = this->carrier.begin(); _iter371 != this->carrier.end(); ++_iter371)
     {
-      xfer += oprot->writeString(_iter338->first);
-      xfer += oprot->writeString(_iter338->second);
+      xfer += oprot->writeString(_iter371->first);
+      xfer += oprot->writeString(_iter371->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1817,11 +1817,11 @@ uint32_t SocialGraphService_InsertUser_pargs::write(::apache::thrift::protocol::
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter339;
-    for (_iter339 = (*(this->carrier)).begin(); _iter339 != (*(this->carrier)).end(); ++_iter339)
+    std::map<std::string, std::string> ::const_iterator _iter372;
+    for (_iter372 = (*(this->carrier)).begin(); _iter372 != (*(this->carrier)).end(); ++_iter372)
     {
-      xfer += oprot->writeString(_iter339->first);
-      xfer += oprot->writeString(_iter339->second);
+      xfer += oprot->writeString(_iter372->first);
+      xfer += oprot->writeString(_iter372->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -1940,6 +1940,934 @@ uint32_t SocialGraphService_InsertUser_presult::read(::apache::thrift::protocol:
   return xfer;
 }
 
+SocialGraphService_GetFollowersPage_args::~SocialGraphService_GetFollowersPage_args() throw() {
+}
+
+
+uint32_t SocialGraphService_GetFollowersPage_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->req_id);
+          this->__isset.req_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->user_id);
+          this->__isset.user_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->cursor);
+          this->__isset.cursor = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->limit);
+          this->__isset.limit = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->carrier.clear();
+            uint32_t _size373;
+            ::apache::thrift::protocol::TType _ktype374;
+            ::apache::thrift::protocol::TType _vtype375;
+            xfer += iprot->readMapBegin(_ktype374, _vtype375, _size373);
+            uint32_t _i377;
+            for (_i377 = 0; _i377 < _size373; ++_i377)
+            {
+              std::string _key378;
+              xfer += iprot->readString(_key378);
+              std::string& _val379 = this->carrier[_key378];
+              xfer += iprot->readString(_val379);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.carrier = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t SocialGraphService_GetFollowersPage_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("SocialGraphService_GetFollowersPage_args");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->req_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->user_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("cursor", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->cursor);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("limit", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->limit);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 5);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
+    std::map<std::string, std::string> ::const_iterator _iter380;
+    for (_iter380 = this->carrier.begin(); _iter380 != this->carrier.end(); ++_iter380)
+    {
+      xfer += oprot->writeString(_iter380->first);
+      xfer += oprot->writeString(_iter380->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetFollowersPage_pargs::~SocialGraphService_GetFollowersPage_pargs() throw() {
+}
+
+
+uint32_t SocialGraphService_GetFollowersPage_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("SocialGraphService_GetFollowersPage_pargs");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->req_id)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64((*(this->user_id)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("cursor", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64((*(this->cursor)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("limit", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32((*(this->limit)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 5);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
+    std::map<std::string, std::string> ::const_iterator _iter381;
+    for (_iter381 = (*(this->carrier)).begin(); _iter381 != (*(this->carrier)).end(); ++_iter381)
+    {
+      xfer += oprot->writeString(_iter381->first);
+      xfer += oprot->writeString(_iter381->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetFollowersPage_result::~SocialGraphService_GetFollowersPage_result() throw() {
+}
+
+
+uint32_t SocialGraphService_GetFollowersPage_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size382;
+            ::apache::thrift::protocol::TType _etype385;
+            xfer += iprot->readListBegin(_etype385, _size382);
+            this->success.resize(_size382);
+            uint32_t _i386;
+            for (_i386 = 0; _i386 < _size382; ++_i386)
+            {
+              xfer += iprot->readI64(this->success[_i386]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t SocialGraphService_GetFollowersPage_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("SocialGraphService_GetFollowersPage_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->success.size()));
+      std::vector<int64_t> ::const_iterator _iter387;
+      for (_iter387 = this->success.begin(); _iter387 != this->success.end(); ++_iter387)
+      {
+        xfer += oprot->writeI64((*_iter387));
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.se) {
+    xfer += oprot->writeFieldBegin("se", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->se.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetFollowersPage_presult::~SocialGraphService_GetFollowersPage_presult() throw() {
+}
+
+
+uint32_t SocialGraphService_GetFollowersPage_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size388;
+            ::apache::thrift::protocol::TType _etype391;
+            xfer += iprot->readListBegin(_etype391, _size388);
+            (*(this->success)).resize(_size388);
+            uint32_t _i392;
+            for (_i392 = 0; _i392 < _size388; ++_i392)
+            {
+              xfer += iprot->readI64((*(this->success))[_i392]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+SocialGraphService_GetFollowerCount_args::~SocialGraphService_GetFollowerCount_args() throw() {
+}
+
+
+uint32_t SocialGraphService_GetFollowerCount_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->req_id);
+          this->__isset.req_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->user_id);
+          this->__isset.user_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->carrier.clear();
+            uint32_t _size393;
+            ::apache::thrift::protocol::TType _ktype394;
+            ::apache::thrift::protocol::TType _vtype395;
+            xfer += iprot->readMapBegin(_ktype394, _vtype395, _size393);
+            uint32_t _i397;
+            for (_i397 = 0; _i397 < _size393; ++_i397)
+            {
+              std::string _key398;
+              xfer += iprot->readString(_key398);
+              std::string& _val399 = this->carrier[_key398];
+              xfer += iprot->readString(_val399);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.carrier = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t SocialGraphService_GetFollowerCount_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("SocialGraphService_GetFollowerCount_args");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->req_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->user_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
+    std::map<std::string, std::string> ::const_iterator _iter400;
+    for (_iter400 = this->carrier.begin(); _iter400 != this->carrier.end(); ++_iter400)
+    {
+      xfer += oprot->writeString(_iter400->first);
+      xfer += oprot->writeString(_iter400->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetFollowerCount_pargs::~SocialGraphService_GetFollowerCount_pargs() throw() {
+}
+
+
+uint32_t SocialGraphService_GetFollowerCount_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("SocialGraphService_GetFollowerCount_pargs");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->req_id)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64((*(this->user_id)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
+    std::map<std::string, std::string> ::const_iterator _iter401;
+    for (_iter401 = (*(this->carrier)).begin(); _iter401 != (*(this->carrier)).end(); ++_iter401)
+    {
+      xfer += oprot->writeString(_iter401->first);
+      xfer += oprot->writeString(_iter401->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetFollowerCount_result::~SocialGraphService_GetFollowerCount_result() throw() {
+}
+
+
+uint32_t SocialGraphService_GetFollowerCount_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->success);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t SocialGraphService_GetFollowerCount_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("SocialGraphService_GetFollowerCount_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_I64, 0);
+    xfer += oprot->writeI64(this->success);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.se) {
+    xfer += oprot->writeFieldBegin("se", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->se.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetFollowerCount_presult::~SocialGraphService_GetFollowerCount_presult() throw() {
+}
+
+
+uint32_t SocialGraphService_GetFollowerCount_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64((*(this->success)));
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+SocialGraphService_GetHighFanoutFollowees_args::~SocialGraphService_GetHighFanoutFollowees_args() throw() {
+}
+
+
+uint32_t SocialGraphService_GetHighFanoutFollowees_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->req_id);
+          this->__isset.req_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->user_id);
+          this->__isset.user_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->min_followers);
+          this->__isset.min_followers = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->carrier.clear();
+            uint32_t _size402;
+            ::apache::thrift::protocol::TType _ktype403;
+            ::apache::thrift::protocol::TType _vtype404;
+            xfer += iprot->readMapBegin(_ktype403, _vtype404, _size402);
+            uint32_t _i406;
+            for (_i406 = 0; _i406 < _size402; ++_i406)
+            {
+              std::string _key407;
+              xfer += iprot->readString(_key407);
+              std::string& _val408 = this->carrier[_key407];
+              xfer += iprot->readString(_val408);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.carrier = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t SocialGraphService_GetHighFanoutFollowees_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("SocialGraphService_GetHighFanoutFollowees_args");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->req_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->user_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("min_followers", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->min_followers);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
+    std::map<std::string, std::string> ::const_iterator _iter409;
+    for (_iter409 = this->carrier.begin(); _iter409 != this->carrier.end(); ++_iter409)
+    {
+      xfer += oprot->writeString(_iter409->first);
+      xfer += oprot->writeString(_iter409->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetHighFanoutFollowees_pargs::~SocialGraphService_GetHighFanoutFollowees_pargs() throw() {
+}
+
+
+uint32_t SocialGraphService_GetHighFanoutFollowees_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("SocialGraphService_GetHighFanoutFollowees_pargs");
+
+  xfer += oprot->writeFieldBegin("req_id", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->req_id)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("user_id", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64((*(this->user_id)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("min_followers", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64((*(this->min_followers)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 4);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
+    std::map<std::string, std::string> ::const_iterator _iter410;
+    for (_iter410 = (*(this->carrier)).begin(); _iter410 != (*(this->carrier)).end(); ++_iter410)
+    {
+      xfer += oprot->writeString(_iter410->first);
+      xfer += oprot->writeString(_iter410->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetHighFanoutFollowees_result::~SocialGraphService_GetHighFanoutFollowees_result() throw() {
+}
+
+
+uint32_t SocialGraphService_GetHighFanoutFollowees_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->success.clear();
+            uint32_t _size411;
+            ::apache::thrift::protocol::TType _etype414;
+            xfer += iprot->readListBegin(_etype414, _size411);
+            this->success.resize(_size411);
+            uint32_t _i415;
+            for (_i415 = 0; _i415 < _size411; ++_i415)
+            {
+              xfer += iprot->readI64(this->success[_i415]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t SocialGraphService_GetHighFanoutFollowees_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("SocialGraphService_GetHighFanoutFollowees_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->success.size()));
+      std::vector<int64_t> ::const_iterator _iter416;
+      for (_iter416 = this->success.begin(); _iter416 != this->success.end(); ++_iter416)
+      {
+        xfer += oprot->writeI64((*_iter416));
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.se) {
+    xfer += oprot->writeFieldBegin("se", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->se.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+SocialGraphService_GetHighFanoutFollowees_presult::~SocialGraphService_GetHighFanoutFollowees_presult() throw() {
+}
+
+
+uint32_t SocialGraphService_GetHighFanoutFollowees_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size417;
+            ::apache::thrift::protocol::TType _etype420;
+            xfer += iprot->readListBegin(_etype420, _size417);
+            (*(this->success)).resize(_size417);
+            uint32_t _i421;
+            for (_i421 = 0; _i421 < _size417; ++_i421)
+            {
+              xfer += iprot->readI64((*(this->success))[_i421]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->se.read(iprot);
+          this->__isset.se = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
 void SocialGraphServiceClient::GetFollowers(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
 {
   send_GetFollowers(req_id, user_id, carrier);
@@ -2014,9 +2942,191 @@ void SocialGraphServiceClient::send_GetFollowees(const int64_t req_id, const int
   int32_t cseqid = 0;
   oprot_->writeMessageBegin("GetFollowees", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  SocialGraphService_GetFollowees_pargs args;
+  SocialGraphService_GetFollowees_pargs args;
+  args.req_id = &req_id;
+  args.user_id = &user_id;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void SocialGraphServiceClient::recv_GetFollowees(std::vector<int64_t> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("GetFollowees") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  SocialGraphService_GetFollowees_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.se) {
+    throw result.se;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetFollowees failed: unknown result");
+}
+
+void SocialGraphServiceClient::Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier)
+{
+  send_Follow(req_id, user_id, followee_id, carrier);
+  recv_Follow();
+}
+
+void SocialGraphServiceClient::send_Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Follow", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  SocialGraphService_Follow_pargs args;
+  args.req_id = &req_id;
+  args.user_id = &user_id;
+  args.followee_id = &followee_id;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void SocialGraphServiceClient::recv_Follow()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("Follow") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  SocialGraphService_Follow_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.se) {
+    throw result.se;
+  }
+  return;
+}
+
+void SocialGraphServiceClient::Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier)
+{
+  send_Unfollow(req_id, user_id, followee_id, carrier);
+  recv_Unfollow();
+}
+
+void SocialGraphServiceClient::send_Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Unfollow", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  SocialGraphService_Unfollow_pargs args;
+  args.req_id = &req_id;
+  args.user_id = &user_id;
+  args.followee_id = &followee_id;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void SocialGraphServiceClient::recv_Unfollow()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("Unfollow") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  SocialGraphService_Unfollow_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.se) {
+    throw result.se;
+  }
+  return;
+}
+
+void SocialGraphServiceClient::FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier)
+{
+  send_FollowWithUsername(req_id, user_usernmae, followee_username, carrier);
+  recv_FollowWithUsername();
+}
+
+void SocialGraphServiceClient::send_FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("FollowWithUsername", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  SocialGraphService_FollowWithUsername_pargs args;
   args.req_id = &req_id;
-  args.user_id = &user_id;
+  args.user_usernmae = &user_usernmae;
+  args.followee_username = &followee_username;
   args.carrier = &carrier;
   args.write(oprot_);
 
@@ -2025,7 +3135,7 @@ void SocialGraphServiceClient::send_GetFollowees(const int64_t req_id, const int
   oprot_->getTransport()->flush();
 }
 
-void SocialGraphServiceClient::recv_GetFollowees(std::vector<int64_t> & _return)
+void SocialGraphServiceClient::recv_FollowWithUsername()
 {
 
   int32_t rseqid = 0;
@@ -2045,42 +3155,37 @@ void SocialGraphServiceClient::recv_GetFollowees(std::vector<int64_t> & _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("GetFollowees") != 0) {
+  if (fname.compare("FollowWithUsername") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  SocialGraphService_GetFollowees_presult result;
-  result.success = &_return;
+  SocialGraphService_FollowWithUsername_presult result;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
-  if (result.__isset.success) {
-    // _return pointer has now been filled
-    return;
-  }
   if (result.__isset.se) {
     throw result.se;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetFollowees failed: unknown result");
+  return;
 }
 
-void SocialGraphServiceClient::Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier)
 {
-  send_Follow(req_id, user_id, followee_id, carrier);
-  recv_Follow();
+  send_UnfollowWithUsername(req_id, user_usernmae, followee_username, carrier);
+  recv_UnfollowWithUsername();
 }
 
-void SocialGraphServiceClient::send_Follow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::send_UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Follow", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("UnfollowWithUsername", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  SocialGraphService_Follow_pargs args;
+  SocialGraphService_UnfollowWithUsername_pargs args;
   args.req_id = &req_id;
-  args.user_id = &user_id;
-  args.followee_id = &followee_id;
+  args.user_usernmae = &user_usernmae;
+  args.followee_username = &followee_username;
   args.carrier = &carrier;
   args.write(oprot_);
 
@@ -2089,7 +3194,7 @@ void SocialGraphServiceClient::send_Follow(const int64_t req_id, const int64_t u
   oprot_->getTransport()->flush();
 }
 
-void SocialGraphServiceClient::recv_Follow()
+void SocialGraphServiceClient::recv_UnfollowWithUsername()
 {
 
   int32_t rseqid = 0;
@@ -2109,12 +3214,12 @@ void SocialGraphServiceClient::recv_Follow()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("Follow") != 0) {
+  if (fname.compare("UnfollowWithUsername") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  SocialGraphService_Follow_presult result;
+  SocialGraphService_UnfollowWithUsername_presult result;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
@@ -2125,21 +3230,20 @@ void SocialGraphServiceClient::recv_Follow()
   return;
 }
 
-void SocialGraphServiceClient::Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
 {
-  send_Unfollow(req_id, user_id, followee_id, carrier);
-  recv_Unfollow();
+  send_InsertUser(req_id, user_id, carrier);
+  recv_InsertUser();
 }
 
-void SocialGraphServiceClient::send_Unfollow(const int64_t req_id, const int64_t user_id, const int64_t followee_id, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::send_InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("Unfollow", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("InsertUser", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  SocialGraphService_Unfollow_pargs args;
+  SocialGraphService_InsertUser_pargs args;
   args.req_id = &req_id;
   args.user_id = &user_id;
-  args.followee_id = &followee_id;
   args.carrier = &carrier;
   args.write(oprot_);
 
@@ -2148,7 +3252,7 @@ void SocialGraphServiceClient::send_Unfollow(const int64_t req_id, const int64_t
   oprot_->getTransport()->flush();
 }
 
-void SocialGraphServiceClient::recv_Unfollow()
+void SocialGraphServiceClient::recv_InsertUser()
 {
 
   int32_t rseqid = 0;
@@ -2168,12 +3272,12 @@ void SocialGraphServiceClient::recv_Unfollow()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("Unfollow") != 0) {
+  if (fname.compare("InsertUser") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  SocialGraphService_Unfollow_presult result;
+  SocialGraphService_InsertUser_presult result;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
@@ -2184,21 +3288,22 @@ void SocialGraphServiceClient::recv_Unfollow()
   return;
 }
 
-void SocialGraphServiceClient::FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::GetFollowersPage(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier)
 {
-  send_FollowWithUsername(req_id, user_usernmae, followee_username, carrier);
-  recv_FollowWithUsername();
+  send_GetFollowersPage(req_id, user_id, cursor, limit, carrier);
+  recv_GetFollowersPage(_return);
 }
 
-void SocialGraphServiceClient::send_FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::send_GetFollowersPage(const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("FollowWithUsername", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("GetFollowersPage", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  SocialGraphService_FollowWithUsername_pargs args;
+  SocialGraphService_GetFollowersPage_pargs args;
   args.req_id = &req_id;
-  args.user_usernmae = &user_usernmae;
-  args.followee_username = &followee_username;
+  args.user_id = &user_id;
+  args.cursor = &cursor;
+  args.limit = &limit;
   args.carrier = &carrier;
   args.write(oprot_);
 
@@ -2207,7 +3312,7 @@ void SocialGraphServiceClient::send_FollowWithUsername(const int64_t req_id, con
   oprot_->getTransport()->flush();
 }
 
-void SocialGraphServiceClient::recv_FollowWithUsername()
+void SocialGraphServiceClient::recv_GetFollowersPage(std::vector<int64_t> & _return)
 {
 
   int32_t rseqid = 0;
@@ -2227,37 +3332,41 @@ void SocialGraphServiceClient::recv_FollowWithUsername()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("FollowWithUsername") != 0) {
+  if (fname.compare("GetFollowersPage") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  SocialGraphService_FollowWithUsername_presult result;
+  SocialGraphService_GetFollowersPage_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
   if (result.__isset.se) {
     throw result.se;
   }
-  return;
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetFollowersPage failed: unknown result");
 }
 
-void SocialGraphServiceClient::UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier)
+int64_t SocialGraphServiceClient::GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
 {
-  send_UnfollowWithUsername(req_id, user_usernmae, followee_username, carrier);
-  recv_UnfollowWithUsername();
+  send_GetFollowerCount(req_id, user_id, carrier);
+  return recv_GetFollowerCount();
 }
 
-void SocialGraphServiceClient::send_UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::send_GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("UnfollowWithUsername", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("GetFollowerCount", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  SocialGraphService_UnfollowWithUsername_pargs args;
+  SocialGraphService_GetFollowerCount_pargs args;
   args.req_id = &req_id;
-  args.user_usernmae = &user_usernmae;
-  args.followee_username = &followee_username;
+  args.user_id = &user_id;
   args.carrier = &carrier;
   args.write(oprot_);
 
@@ -2266,7 +3375,7 @@ void SocialGraphServiceClient::send_UnfollowWithUsername(const int64_t req_id, c
   oprot_->getTransport()->flush();
 }
 
-void SocialGraphServiceClient::recv_UnfollowWithUsername()
+int64_t SocialGraphServiceClient::recv_GetFollowerCount()
 {
 
   int32_t rseqid = 0;
@@ -2286,36 +3395,42 @@ void SocialGraphServiceClient::recv_UnfollowWithUsername()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("UnfollowWithUsername") != 0) {
+  if (fname.compare("GetFollowerCount") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  SocialGraphService_UnfollowWithUsername_presult result;
+  int64_t _return;
+  SocialGraphService_GetFollowerCount_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
+  if (result.__isset.success) {
+    return _return;
+  }
   if (result.__isset.se) {
     throw result.se;
   }
-  return;
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetFollowerCount failed: unknown result");
 }
 
-void SocialGraphServiceClient::InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::GetHighFanoutFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier)
 {
-  send_InsertUser(req_id, user_id, carrier);
-  recv_InsertUser();
+  send_GetHighFanoutFollowees(req_id, user_id, min_followers, carrier);
+  recv_GetHighFanoutFollowees(_return);
 }
 
-void SocialGraphServiceClient::send_InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
+void SocialGraphServiceClient::send_GetHighFanoutFollowees(const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier)
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("InsertUser", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("GetHighFanoutFollowees", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  SocialGraphService_InsertUser_pargs args;
+  SocialGraphService_GetHighFanoutFollowees_pargs args;
   args.req_id = &req_id;
   args.user_id = &user_id;
+  args.min_followers = &min_followers;
   args.carrier = &carrier;
   args.write(oprot_);
 
@@ -2324,7 +3439,7 @@ void SocialGraphServiceClient::send_InsertUser(const int64_t req_id, const int64
   oprot_->getTransport()->flush();
 }
 
-void SocialGraphServiceClient::recv_InsertUser()
+void SocialGraphServiceClient::recv_GetHighFanoutFollowees(std::vector<int64_t> & _return)
 {
 
   int32_t rseqid = 0;
@@ -2344,20 +3459,25 @@ void SocialGraphServiceClient::recv_InsertUser()
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("InsertUser") != 0) {
+  if (fname.compare("GetHighFanoutFollowees") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  SocialGraphService_InsertUser_presult result;
+  SocialGraphService_GetHighFanoutFollowees_presult result;
+  result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
   iprot_->getTransport()->readEnd();
 
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
   if (result.__isset.se) {
     throw result.se;
   }
-  return;
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetHighFanoutFollowees failed: unknown result");
 }
 
 bool SocialGraphServiceProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
@@ -2694,7 +3814,177 @@ void SocialGraphServiceProcessor::process_UnfollowWithUsername(int32_t seqid, ::
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("UnfollowWithUsername", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("UnfollowWithUsername", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "SocialGraphService.UnfollowWithUsername");
+  }
+
+  oprot->writeMessageBegin("UnfollowWithUsername", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "SocialGraphService.UnfollowWithUsername", bytes);
+  }
+}
+
+void SocialGraphServiceProcessor::process_InsertUser(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("SocialGraphService.InsertUser", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "SocialGraphService.InsertUser");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "SocialGraphService.InsertUser");
+  }
+
+  SocialGraphService_InsertUser_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "SocialGraphService.InsertUser", bytes);
+  }
+
+  SocialGraphService_InsertUser_result result;
+  try {
+    iface_->InsertUser(args.req_id, args.user_id, args.carrier);
+  } catch (ServiceException &se) {
+    result.se = se;
+    result.__isset.se = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "SocialGraphService.InsertUser");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("InsertUser", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "SocialGraphService.InsertUser");
+  }
+
+  oprot->writeMessageBegin("InsertUser", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "SocialGraphService.InsertUser", bytes);
+  }
+}
+
+void SocialGraphServiceProcessor::process_GetFollowersPage(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("SocialGraphService.GetFollowersPage", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "SocialGraphService.GetFollowersPage");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "SocialGraphService.GetFollowersPage");
+  }
+
+  SocialGraphService_GetFollowersPage_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "SocialGraphService.GetFollowersPage", bytes);
+  }
+
+  SocialGraphService_GetFollowersPage_result result;
+  try {
+    iface_->GetFollowersPage(result.success, args.req_id, args.user_id, args.cursor, args.limit, args.carrier);
+    result.__isset.success = true;
+  } catch (ServiceException &se) {
+    result.se = se;
+    result.__isset.se = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "SocialGraphService.GetFollowersPage");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("GetFollowersPage", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "SocialGraphService.GetFollowersPage");
+  }
+
+  oprot->writeMessageBegin("GetFollowersPage", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "SocialGraphService.GetFollowersPage", bytes);
+  }
+}
+
+void SocialGraphServiceProcessor::process_GetFollowerCount(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("SocialGraphService.GetFollowerCount", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "SocialGraphService.GetFollowerCount");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "SocialGraphService.GetFollowerCount");
+  }
+
+  SocialGraphService_GetFollowerCount_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "SocialGraphService.GetFollowerCount", bytes);
+  }
+
+  SocialGraphService_GetFollowerCount_result result;
+  try {
+    result.success = iface_->GetFollowerCount(args.req_id, args.user_id, args.carrier);
+    result.__isset.success = true;
+  } catch (ServiceException &se) {
+    result.se = se;
+    result.__isset.se = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "SocialGraphService.GetFollowerCount");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("GetFollowerCount", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -2703,54 +3993,55 @@ void SocialGraphServiceProcessor::process_UnfollowWithUsername(int32_t seqid, ::
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "SocialGraphService.UnfollowWithUsername");
+    this->eventHandler_->preWrite(ctx, "SocialGraphService.GetFollowerCount");
   }
 
-  oprot->writeMessageBegin("UnfollowWithUsername", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("GetFollowerCount", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "SocialGraphService.UnfollowWithUsername", bytes);
+    this->eventHandler_->postWrite(ctx, "SocialGraphService.GetFollowerCount", bytes);
   }
 }
 
-void SocialGraphServiceProcessor::process_InsertUser(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+void SocialGraphServiceProcessor::process_GetHighFanoutFollowees(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
   if (this->eventHandler_.get() != NULL) {
-    ctx = this->eventHandler_->getContext("SocialGraphService.InsertUser", callContext);
+    ctx = this->eventHandler_->getContext("SocialGraphService.GetHighFanoutFollowees", callContext);
   }
-  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "SocialGraphService.InsertUser");
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "SocialGraphService.GetHighFanoutFollowees");
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preRead(ctx, "SocialGraphService.InsertUser");
+    this->eventHandler_->preRead(ctx, "SocialGraphService.GetHighFanoutFollowees");
   }
 
-  SocialGraphService_InsertUser_args args;
+  SocialGraphService_GetHighFanoutFollowees_args args;
   args.read(iprot);
   iprot->readMessageEnd();
   uint32_t bytes = iprot->getTransport()->readEnd();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postRead(ctx, "SocialGraphService.InsertUser", bytes);
+    this->eventHandler_->postRead(ctx, "SocialGraphService.GetHighFanoutFollowees", bytes);
   }
 
-  SocialGraphService_InsertUser_result result;
+  SocialGraphService_GetHighFanoutFollowees_result result;
   try {
-    iface_->InsertUser(args.req_id, args.user_id, args.carrier);
+    iface_->GetHighFanoutFollowees(result.success, args.req_id, args.user_id, args.min_followers, args.carrier);
+    result.__isset.success = true;
   } catch (ServiceException &se) {
     result.se = se;
     result.__isset.se = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
-      this->eventHandler_->handlerError(ctx, "SocialGraphService.InsertUser");
+      this->eventHandler_->handlerError(ctx, "SocialGraphService.GetHighFanoutFollowees");
     }
 
     ::apache::thrift::TApplicationException x(e.what());
-    oprot->writeMessageBegin("InsertUser", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    oprot->writeMessageBegin("GetHighFanoutFollowees", ::apache::thrift::protocol::T_EXCEPTION, seqid);
     x.write(oprot);
     oprot->writeMessageEnd();
     oprot->getTransport()->writeEnd();
@@ -2759,17 +4050,17 @@ void SocialGraphServiceProcessor::process_InsertUser(int32_t seqid, ::apache::th
   }
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->preWrite(ctx, "SocialGraphService.InsertUser");
+    this->eventHandler_->preWrite(ctx, "SocialGraphService.GetHighFanoutFollowees");
   }
 
-  oprot->writeMessageBegin("InsertUser", ::apache::thrift::protocol::T_REPLY, seqid);
+  oprot->writeMessageBegin("GetHighFanoutFollowees", ::apache::thrift::protocol::T_REPLY, seqid);
   result.write(oprot);
   oprot->writeMessageEnd();
   bytes = oprot->getTransport()->writeEnd();
   oprot->getTransport()->flush();
 
   if (this->eventHandler_.get() != NULL) {
-    this->eventHandler_->postWrite(ctx, "SocialGraphService.InsertUser", bytes);
+    this->eventHandler_->postWrite(ctx, "SocialGraphService.GetHighFanoutFollowees", bytes);
   }
 }
 
@@ -3384,5 +4675,278 @@ void SocialGraphServiceConcurrentClient::recv_InsertUser(const int32_t seqid)
   } // end while(true)
 }
 
+void SocialGraphServiceConcurrentClient::GetFollowersPage(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier)
+{
+  int32_t seqid = send_GetFollowersPage(req_id, user_id, cursor, limit, carrier);
+  recv_GetFollowersPage(_return, seqid);
+}
+
+int32_t SocialGraphServiceConcurrentClient::send_GetFollowersPage(const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = this->sync_.generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(&this->sync_);
+  oprot_->writeMessageBegin("GetFollowersPage", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  SocialGraphService_GetFollowersPage_pargs args;
+  args.req_id = &req_id;
+  args.user_id = &user_id;
+  args.cursor = &cursor;
+  args.limit = &limit;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void SocialGraphServiceConcurrentClient::recv_GetFollowersPage(std::vector<int64_t> & _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(&this->sync_, seqid);
+
+  while(true) {
+    if(!this->sync_.getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("GetFollowersPage") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      SocialGraphService_GetFollowersPage_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      if (result.__isset.se) {
+        sentry.commit();
+        throw result.se;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetFollowersPage failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_.updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_.waitForWork(seqid);
+  } // end while(true)
+}
+
+int64_t SocialGraphServiceConcurrentClient::GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
+{
+  int32_t seqid = send_GetFollowerCount(req_id, user_id, carrier);
+  return recv_GetFollowerCount(seqid);
+}
+
+int32_t SocialGraphServiceConcurrentClient::send_GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = this->sync_.generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(&this->sync_);
+  oprot_->writeMessageBegin("GetFollowerCount", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  SocialGraphService_GetFollowerCount_pargs args;
+  args.req_id = &req_id;
+  args.user_id = &user_id;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+int64_t SocialGraphServiceConcurrentClient::recv_GetFollowerCount(const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(&this->sync_, seqid);
+
+  while(true) {
+    if(!this->sync_.getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("GetFollowerCount") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      int64_t _return;
+      SocialGraphService_GetFollowerCount_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        sentry.commit();
+        return _return;
+      }
+      if (result.__isset.se) {
+        sentry.commit();
+        throw result.se;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetFollowerCount failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_.updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_.waitForWork(seqid);
+  } // end while(true)
+}
+
+void SocialGraphServiceConcurrentClient::GetHighFanoutFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier)
+{
+  int32_t seqid = send_GetHighFanoutFollowees(req_id, user_id, min_followers, carrier);
+  recv_GetHighFanoutFollowees(_return, seqid);
+}
+
+int32_t SocialGraphServiceConcurrentClient::send_GetHighFanoutFollowees(const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier)
+{
+  int32_t cseqid = this->sync_.generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(&this->sync_);
+  oprot_->writeMessageBegin("GetHighFanoutFollowees", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  SocialGraphService_GetHighFanoutFollowees_pargs args;
+  args.req_id = &req_id;
+  args.user_id = &user_id;
+  args.min_followers = &min_followers;
+  args.carrier = &carrier;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void SocialGraphServiceConcurrentClient::recv_GetHighFanoutFollowees(std::vector<int64_t> & _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(&this->sync_, seqid);
+
+  while(true) {
+    if(!this->sync_.getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("GetHighFanoutFollowees") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      SocialGraphService_GetHighFanoutFollowees_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      if (result.__isset.se) {
+        sentry.commit();
+        throw result.se;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "GetHighFanoutFollowees failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_.updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_.waitForWork(seqid);
+  } // end while(true)
+}
+
 } // namespace
 
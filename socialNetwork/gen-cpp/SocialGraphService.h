@@ -28,6 +28,9 @@ class SocialGraphServiceIf {
   virtual void FollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier) = 0;
   virtual void UnfollowWithUsername(const int64_t req_id, const std::string& user_usernmae, const std::string& followee_username, const std::map<std::string, std::string> & carrier) = 0;
   virtual void InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void GetFollowersPage(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier) = 0;
+  virtual int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void GetHighFanoutFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class SocialGraphServiceIfFactory {
@@ -78,6 +81,16 @@ class SocialGraphServiceNull : virtual public SocialGraphServiceIf {
   void InsertUser(const int64_t /* req_id */, const int64_t /* user_id */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
+  void GetFollowersPage(std::vector<int64_t> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int64_t /* cursor */, const int32_t /* limit */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
+  int64_t GetFollowerCount(const int64_t /* req_id */, const int64_t /* user_id */, const std::map<std::string, std::string> & /* carrier */) {
+    int64_t _return = 0;
+    return _return;
+  }
+  void GetHighFanoutFollowees(std::vector<int64_t> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int64_t /* min_followers */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
 };
 
 typedef struct _SocialGraphService_GetFollowers_args__isset {
@@ -950,6 +963,405 @@ class SocialGraphService_InsertUser_presult {
 
 };
 
+typedef struct _SocialGraphService_GetFollowersPage_args__isset {
+  _SocialGraphService_GetFollowersPage_args__isset() : req_id(false), user_id(false), cursor(false), limit(false), carrier(false) {}
+  bool req_id :1;
+  bool user_id :1;
+  bool cursor :1;
+  bool limit :1;
+  bool carrier :1;
+} _SocialGraphService_GetFollowersPage_args__isset;
+
+class SocialGraphService_GetFollowersPage_args {
+ public:
+
+  SocialGraphService_GetFollowersPage_args(const SocialGraphService_GetFollowersPage_args&);
+  SocialGraphService_GetFollowersPage_args& operator=(const SocialGraphService_GetFollowersPage_args&);
+  SocialGraphService_GetFollowersPage_args() : req_id(0), user_id(0), cursor(0), limit(0) {
+  }
+
+  virtual ~SocialGraphService_GetFollowersPage_args() throw();
+  int64_t req_id;
+  int64_t user_id;
+  int64_t cursor;
+  int32_t limit;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_GetFollowersPage_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_id(const int64_t val);
+
+  void __set_cursor(const int64_t val);
+
+  void __set_limit(const int32_t val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_GetFollowersPage_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(cursor == rhs.cursor))
+      return false;
+    if (!(limit == rhs.limit))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowersPage_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowersPage_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_GetFollowersPage_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowersPage_pargs() throw();
+  const int64_t* req_id;
+  const int64_t* user_id;
+  const int64_t* cursor;
+  const int32_t* limit;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowersPage_result__isset {
+  _SocialGraphService_GetFollowersPage_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowersPage_result__isset;
+
+class SocialGraphService_GetFollowersPage_result {
+ public:
+
+  SocialGraphService_GetFollowersPage_result(const SocialGraphService_GetFollowersPage_result&);
+  SocialGraphService_GetFollowersPage_result& operator=(const SocialGraphService_GetFollowersPage_result&);
+  SocialGraphService_GetFollowersPage_result() {
+  }
+
+  virtual ~SocialGraphService_GetFollowersPage_result() throw();
+  std::vector<int64_t>  success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowersPage_result__isset __isset;
+
+  void __set_success(const std::vector<int64_t> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_GetFollowersPage_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowersPage_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowersPage_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowersPage_presult__isset {
+  _SocialGraphService_GetFollowersPage_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowersPage_presult__isset;
+
+class SocialGraphService_GetFollowersPage_presult {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowersPage_presult() throw();
+  std::vector<int64_t> * success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowersPage_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _SocialGraphService_GetFollowerCount_args__isset {
+  _SocialGraphService_GetFollowerCount_args__isset() : req_id(false), user_id(false), carrier(false) {}
+  bool req_id :1;
+  bool user_id :1;
+  bool carrier :1;
+} _SocialGraphService_GetFollowerCount_args__isset;
+
+class SocialGraphService_GetFollowerCount_args {
+ public:
+
+  SocialGraphService_GetFollowerCount_args(const SocialGraphService_GetFollowerCount_args&);
+  SocialGraphService_GetFollowerCount_args& operator=(const SocialGraphService_GetFollowerCount_args&);
+  SocialGraphService_GetFollowerCount_args() : req_id(0), user_id(0) {
+  }
+
+  virtual ~SocialGraphService_GetFollowerCount_args() throw();
+  int64_t req_id;
+  int64_t user_id;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_GetFollowerCount_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_id(const int64_t val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_GetFollowerCount_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowerCount_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowerCount_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_GetFollowerCount_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowerCount_pargs() throw();
+  const int64_t* req_id;
+  const int64_t* user_id;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowerCount_result__isset {
+  _SocialGraphService_GetFollowerCount_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowerCount_result__isset;
+
+class SocialGraphService_GetFollowerCount_result {
+ public:
+
+  SocialGraphService_GetFollowerCount_result(const SocialGraphService_GetFollowerCount_result&);
+  SocialGraphService_GetFollowerCount_result& operator=(const SocialGraphService_GetFollowerCount_result&);
+  SocialGraphService_GetFollowerCount_result() : success(0) {
+  }
+
+  virtual ~SocialGraphService_GetFollowerCount_result() throw();
+  int64_t success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowerCount_result__isset __isset;
+
+  void __set_success(const int64_t val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_GetFollowerCount_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetFollowerCount_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetFollowerCount_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetFollowerCount_presult__isset {
+  _SocialGraphService_GetFollowerCount_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetFollowerCount_presult__isset;
+
+class SocialGraphService_GetFollowerCount_presult {
+ public:
+
+
+  virtual ~SocialGraphService_GetFollowerCount_presult() throw();
+  int64_t* success;
+  ServiceException se;
+
+  _SocialGraphService_GetFollowerCount_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+typedef struct _SocialGraphService_GetHighFanoutFollowees_args__isset {
+  _SocialGraphService_GetHighFanoutFollowees_args__isset() : req_id(false), user_id(false), min_followers(false), carrier(false) {}
+  bool req_id :1;
+  bool user_id :1;
+  bool min_followers :1;
+  bool carrier :1;
+} _SocialGraphService_GetHighFanoutFollowees_args__isset;
+
+class SocialGraphService_GetHighFanoutFollowees_args {
+ public:
+
+  SocialGraphService_GetHighFanoutFollowees_args(const SocialGraphService_GetHighFanoutFollowees_args&);
+  SocialGraphService_GetHighFanoutFollowees_args& operator=(const SocialGraphService_GetHighFanoutFollowees_args&);
+  SocialGraphService_GetHighFanoutFollowees_args() : req_id(0), user_id(0), min_followers(0) {
+  }
+
+  virtual ~SocialGraphService_GetHighFanoutFollowees_args() throw();
+  int64_t req_id;
+  int64_t user_id;
+  int64_t min_followers;
+  std::map<std::string, std::string>  carrier;
+
+  _SocialGraphService_GetHighFanoutFollowees_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_id(const int64_t val);
+
+  void __set_min_followers(const int64_t val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const SocialGraphService_GetHighFanoutFollowees_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(min_followers == rhs.min_followers))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetHighFanoutFollowees_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetHighFanoutFollowees_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class SocialGraphService_GetHighFanoutFollowees_pargs {
+ public:
+
+
+  virtual ~SocialGraphService_GetHighFanoutFollowees_pargs() throw();
+  const int64_t* req_id;
+  const int64_t* user_id;
+  const int64_t* min_followers;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetHighFanoutFollowees_result__isset {
+  _SocialGraphService_GetHighFanoutFollowees_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetHighFanoutFollowees_result__isset;
+
+class SocialGraphService_GetHighFanoutFollowees_result {
+ public:
+
+  SocialGraphService_GetHighFanoutFollowees_result(const SocialGraphService_GetHighFanoutFollowees_result&);
+  SocialGraphService_GetHighFanoutFollowees_result& operator=(const SocialGraphService_GetHighFanoutFollowees_result&);
+  SocialGraphService_GetHighFanoutFollowees_result() {
+  }
+
+  virtual ~SocialGraphService_GetHighFanoutFollowees_result() throw();
+  std::vector<int64_t>  success;
+  ServiceException se;
+
+  _SocialGraphService_GetHighFanoutFollowees_result__isset __isset;
+
+  void __set_success(const std::vector<int64_t> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const SocialGraphService_GetHighFanoutFollowees_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const SocialGraphService_GetHighFanoutFollowees_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SocialGraphService_GetHighFanoutFollowees_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _SocialGraphService_GetHighFanoutFollowees_presult__isset {
+  _SocialGraphService_GetHighFanoutFollowees_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _SocialGraphService_GetHighFanoutFollowees_presult__isset;
+
+class SocialGraphService_GetHighFanoutFollowees_presult {
+ public:
+
+
+  virtual ~SocialGraphService_GetHighFanoutFollowees_presult() throw();
+  std::vector<int64_t> * success;
+  ServiceException se;
+
+  _SocialGraphService_GetHighFanoutFollowees_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class SocialGraphServiceClient : virtual public SocialGraphServiceIf {
  public:
   SocialGraphServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -996,6 +1408,15 @@ class SocialGraphServiceClient : virtual public SocialGraphServiceIf {
   void InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
   void send_InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
   void recv_InsertUser();
+  void GetFollowersPage(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier);
+  void send_GetFollowersPage(const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier);
+  void recv_GetFollowersPage(std::vector<int64_t> & _return);
+  int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  void send_GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  int64_t recv_GetFollowerCount();
+  void GetHighFanoutFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier);
+  void send_GetHighFanoutFollowees(const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier);
+  void recv_GetHighFanoutFollowees(std::vector<int64_t> & _return);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -1018,6 +1439,9 @@ class SocialGraphServiceProcessor : public ::apache::thrift::TDispatchProcessor
   void process_FollowWithUsername(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_UnfollowWithUsername(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_InsertUser(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetFollowersPage(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetFollowerCount(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_GetHighFanoutFollowees(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   SocialGraphServiceProcessor(::apache::thrift::stdcxx::shared_ptr<SocialGraphServiceIf> iface) :
     iface_(iface) {
@@ -1028,6 +1452,9 @@ class SocialGraphServiceProcessor : public ::apache::thrift::TDispatchProcessor
     processMap_["FollowWithUsername"] = &SocialGraphServiceProcessor::process_FollowWithUsername;
     processMap_["UnfollowWithUsername"] = &SocialGraphServiceProcessor::process_UnfollowWithUsername;
     processMap_["InsertUser"] = &SocialGraphServiceProcessor::process_InsertUser;
+    processMap_["GetFollowersPage"] = &SocialGraphServiceProcessor::process_GetFollowersPage;
+    processMap_["GetFollowerCount"] = &SocialGraphServiceProcessor::process_GetFollowerCount;
+    processMap_["GetHighFanoutFollowees"] = &SocialGraphServiceProcessor::process_GetHighFanoutFollowees;
   }
 
   virtual ~SocialGraphServiceProcessor() {}
@@ -1121,6 +1548,35 @@ class SocialGraphServiceMultiface : virtual public SocialGraphServiceIf {
     ifaces_[i]->InsertUser(req_id, user_id, carrier);
   }
 
+  void GetFollowersPage(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetFollowersPage(_return, req_id, user_id, cursor, limit, carrier);
+    }
+    ifaces_[i]->GetFollowersPage(_return, req_id, user_id, cursor, limit, carrier);
+    return;
+  }
+
+  int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetFollowerCount(req_id, user_id, carrier);
+    }
+    return ifaces_[i]->GetFollowerCount(req_id, user_id, carrier);
+  }
+
+  void GetHighFanoutFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->GetHighFanoutFollowees(_return, req_id, user_id, min_followers, carrier);
+    }
+    ifaces_[i]->GetHighFanoutFollowees(_return, req_id, user_id, min_followers, carrier);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -1172,6 +1628,15 @@ class SocialGraphServiceConcurrentClient : virtual public SocialGraphServiceIf {
   void InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
   int32_t send_InsertUser(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
   void recv_InsertUser(const int32_t seqid);
+  void GetFollowersPage(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier);
+  int32_t send_GetFollowersPage(const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier);
+  void recv_GetFollowersPage(std::vector<int64_t> & _return, const int32_t seqid);
+  int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  int32_t send_GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier);
+  int64_t recv_GetFollowerCount(const int32_t seqid);
+  void GetHighFanoutFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier);
+  int32_t send_GetHighFanoutFollowees(const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier);
+  void recv_GetHighFanoutFollowees(std::vector<int64_t> & _return, const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
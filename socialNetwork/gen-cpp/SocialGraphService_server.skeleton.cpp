@@ -55,6 +55,21 @@ class SocialGraphServiceHandler : virtual public SocialGraphServiceIf {
     printf("InsertUser\n");
   }
 
+  void GetFollowersPage(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t cursor, const int32_t limit, const std::map<std::string, std::string> & carrier) {
+    // Your implementation goes here
+    printf("GetFollowersPage\n");
+  }
+
+  int64_t GetFollowerCount(const int64_t req_id, const int64_t user_id, const std::map<std::string, std::string> & carrier) {
+    // Your implementation goes here
+    printf("GetFollowerCount\n");
+  }
+
+  void GetHighFanoutFollowees(std::vector<int64_t> & _return, const int64_t req_id, const int64_t user_id, const int64_t min_followers, const std::map<std::string, std::string> & carrier) {
+    // Your implementation goes here
+    printf("GetHighFanoutFollowees\n");
+  }
+
 };
 
 int main(int argc, char **argv) {
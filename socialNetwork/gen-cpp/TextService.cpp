@@ -54,17 +54,17 @@ uint32_t TextService_ComposeText_args::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->carrier.clear();
-            uint32_t _size58;
-            ::apache::thrift::protocol::TType _ktype59;
-            ::apache::thrift::protocol::TType _vtype60;
-            xfer += iprot->readMapBegin(_ktype59, _vtype60, _size58);
-            uint32_t _i62;
-            for (_i62 = 0; _i62 < _size58; ++_i62)
+            uint32_t _size67;
+            ::apache::thrift::protocol::TType _ktype68;
+            ::apache::thrift::protocol::TType _vtype69;
+            xfer += iprot->readMapBegin(_ktype68, _vtype69, _size67);
+            uint32_t _i71;
+            for (_i71 = 0; _i71 < _size67; ++_i71)
             {
-              std::string _key63;
-              xfer += iprot->readString(_key63);
-              std::string& _val64 = this->carrier[_key63];
-              xfer += iprot->readString(_val64);
+              std::string _key72;
+              xfer += iprot->readString(_key72);
+              std::string& _val73 = this->carrier[_key72];
+              xfer += iprot->readString(_val73);
             }
             xfer += iprot->readMapEnd();
           }
@@ -101,11 +101,11 @@ uint32_t TextService_ComposeText_args::write(::apache::thrift::protocol::TProtoc
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->carrier.size()));
-    std::map<std::string, std::string> ::const_iterator _iter65;
-    for (_iter65 = this->carrier.begin(); _iter65 != this->carrier.end(); ++_iter65)
+    std::map<std::string, std::string> ::const_iterator _iter74;
+    for (_iter74 = this->carrier.begin(); _iter74 != this->carrier.end(); ++_iter74)
     {
-      xfer += oprot->writeString(_iter65->first);
-      xfer += oprot->writeString(_iter65->second);
+      xfer += oprot->writeString(_iter74->first);
+      xfer += oprot->writeString(_iter74->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -137,11 +137,11 @@ uint32_t TextService_ComposeText_pargs::write(::apache::thrift::protocol::TProto
   xfer += oprot->writeFieldBegin("carrier", ::apache::thrift::protocol::T_MAP, 3);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->carrier)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter66;
-    for (_iter66 = (*(this->carrier)).begin(); _iter66 != (*(this->carrier)).end(); ++_iter66)
+    std::map<std::string, std::string> ::const_iterator _iter75;
+    for (_iter75 = (*(this->carrier)).begin(); _iter75 != (*(this->carrier)).end(); ++_iter75)
     {
-      xfer += oprot->writeString(_iter66->first);
-      xfer += oprot->writeString(_iter66->second);
+      xfer += oprot->writeString(_iter75->first);
+      xfer += oprot->writeString(_iter75->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -25,6 +25,11 @@ class UniqueIdServiceHandler : virtual public UniqueIdServiceIf {
     printf("ComposeUniqueId\n");
   }
 
+  int64_t ComposeUniqueIds(const int64_t req_id, const int32_t count, const std::map<std::string, std::string> & carrier) {
+    // Your implementation goes here
+    printf("ComposeUniqueIds\n");
+  }
+
 };
 
 int main(int argc, char **argv) {
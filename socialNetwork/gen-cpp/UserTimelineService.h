@@ -23,6 +23,7 @@ class UserTimelineServiceIf {
   virtual ~UserTimelineServiceIf() {}
   virtual void WriteUserTimeline(const int64_t req_id, const int64_t post_id, const int64_t user_id, const int64_t timestamp, const std::map<std::string, std::string> & carrier) = 0;
   virtual void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier) = 0;
+  virtual void ReadUserTimelineEntries(std::map<int64_t, int64_t> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier) = 0;
 };
 
 class UserTimelineServiceIfFactory {
@@ -58,6 +59,9 @@ class UserTimelineServiceNull : virtual public UserTimelineServiceIf {
   void ReadUserTimeline(std::vector<Post> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int32_t /* start */, const int32_t /* stop */, const std::map<std::string, std::string> & /* carrier */) {
     return;
   }
+  void ReadUserTimelineEntries(std::map<int64_t, int64_t> & /* _return */, const int64_t /* req_id */, const int64_t /* user_id */, const int32_t /* start */, const int32_t /* stop */, const std::map<std::string, std::string> & /* carrier */) {
+    return;
+  }
 };
 
 typedef struct _UserTimelineService_WriteUserTimeline_args__isset {
@@ -332,6 +336,146 @@ class UserTimelineService_ReadUserTimeline_presult {
 
 };
 
+typedef struct _UserTimelineService_ReadUserTimelineEntries_args__isset {
+  _UserTimelineService_ReadUserTimelineEntries_args__isset() : req_id(false), user_id(false), start(false), stop(false), carrier(false) {}
+  bool req_id :1;
+  bool user_id :1;
+  bool start :1;
+  bool stop :1;
+  bool carrier :1;
+} _UserTimelineService_ReadUserTimelineEntries_args__isset;
+
+class UserTimelineService_ReadUserTimelineEntries_args {
+ public:
+
+  UserTimelineService_ReadUserTimelineEntries_args(const UserTimelineService_ReadUserTimelineEntries_args&);
+  UserTimelineService_ReadUserTimelineEntries_args& operator=(const UserTimelineService_ReadUserTimelineEntries_args&);
+  UserTimelineService_ReadUserTimelineEntries_args() : req_id(0), user_id(0), start(0), stop(0) {
+  }
+
+  virtual ~UserTimelineService_ReadUserTimelineEntries_args() throw();
+  int64_t req_id;
+  int64_t user_id;
+  int32_t start;
+  int32_t stop;
+  std::map<std::string, std::string>  carrier;
+
+  _UserTimelineService_ReadUserTimelineEntries_args__isset __isset;
+
+  void __set_req_id(const int64_t val);
+
+  void __set_user_id(const int64_t val);
+
+  void __set_start(const int32_t val);
+
+  void __set_stop(const int32_t val);
+
+  void __set_carrier(const std::map<std::string, std::string> & val);
+
+  bool operator == (const UserTimelineService_ReadUserTimelineEntries_args & rhs) const
+  {
+    if (!(req_id == rhs.req_id))
+      return false;
+    if (!(user_id == rhs.user_id))
+      return false;
+    if (!(start == rhs.start))
+      return false;
+    if (!(stop == rhs.stop))
+      return false;
+    if (!(carrier == rhs.carrier))
+      return false;
+    return true;
+  }
+  bool operator != (const UserTimelineService_ReadUserTimelineEntries_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserTimelineService_ReadUserTimelineEntries_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class UserTimelineService_ReadUserTimelineEntries_pargs {
+ public:
+
+
+  virtual ~UserTimelineService_ReadUserTimelineEntries_pargs() throw();
+  const int64_t* req_id;
+  const int64_t* user_id;
+  const int32_t* start;
+  const int32_t* stop;
+  const std::map<std::string, std::string> * carrier;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserTimelineService_ReadUserTimelineEntries_result__isset {
+  _UserTimelineService_ReadUserTimelineEntries_result__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UserTimelineService_ReadUserTimelineEntries_result__isset;
+
+class UserTimelineService_ReadUserTimelineEntries_result {
+ public:
+
+  UserTimelineService_ReadUserTimelineEntries_result(const UserTimelineService_ReadUserTimelineEntries_result&);
+  UserTimelineService_ReadUserTimelineEntries_result& operator=(const UserTimelineService_ReadUserTimelineEntries_result&);
+  UserTimelineService_ReadUserTimelineEntries_result() {
+  }
+
+  virtual ~UserTimelineService_ReadUserTimelineEntries_result() throw();
+  std::map<int64_t, int64_t>  success;
+  ServiceException se;
+
+  _UserTimelineService_ReadUserTimelineEntries_result__isset __isset;
+
+  void __set_success(const std::map<int64_t, int64_t> & val);
+
+  void __set_se(const ServiceException& val);
+
+  bool operator == (const UserTimelineService_ReadUserTimelineEntries_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(se == rhs.se))
+      return false;
+    return true;
+  }
+  bool operator != (const UserTimelineService_ReadUserTimelineEntries_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const UserTimelineService_ReadUserTimelineEntries_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _UserTimelineService_ReadUserTimelineEntries_presult__isset {
+  _UserTimelineService_ReadUserTimelineEntries_presult__isset() : success(false), se(false) {}
+  bool success :1;
+  bool se :1;
+} _UserTimelineService_ReadUserTimelineEntries_presult__isset;
+
+class UserTimelineService_ReadUserTimelineEntries_presult {
+ public:
+
+
+  virtual ~UserTimelineService_ReadUserTimelineEntries_presult() throw();
+  std::map<int64_t, int64_t> * success;
+  ServiceException se;
+
+  _UserTimelineService_ReadUserTimelineEntries_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class UserTimelineServiceClient : virtual public UserTimelineServiceIf {
  public:
   UserTimelineServiceClient(apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -363,6 +507,9 @@ class UserTimelineServiceClient : virtual public UserTimelineServiceIf {
   void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
   void send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
   void recv_ReadUserTimeline(std::vector<Post> & _return);
+  void ReadUserTimelineEntries(std::map<int64_t, int64_t> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
+  void send_ReadUserTimelineEntries(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
+  void recv_ReadUserTimelineEntries(std::map<int64_t, int64_t> & _return);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -380,11 +527,13 @@ class UserTimelineServiceProcessor : public ::apache::thrift::TDispatchProcessor
   ProcessMap processMap_;
   void process_WriteUserTimeline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ReadUserTimeline(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_ReadUserTimelineEntries(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   UserTimelineServiceProcessor(::apache::thrift::stdcxx::shared_ptr<UserTimelineServiceIf> iface) :
     iface_(iface) {
     processMap_["WriteUserTimeline"] = &UserTimelineServiceProcessor::process_WriteUserTimeline;
     processMap_["ReadUserTimeline"] = &UserTimelineServiceProcessor::process_ReadUserTimeline;
+    processMap_["ReadUserTimelineEntries"] = &UserTimelineServiceProcessor::process_ReadUserTimelineEntries;
   }
 
   virtual ~UserTimelineServiceProcessor() {}
@@ -432,6 +581,16 @@ class UserTimelineServiceMultiface : virtual public UserTimelineServiceIf {
     return;
   }
 
+  void ReadUserTimelineEntries(std::map<int64_t, int64_t> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->ReadUserTimelineEntries(_return, req_id, user_id, start, stop, carrier);
+    }
+    ifaces_[i]->ReadUserTimelineEntries(_return, req_id, user_id, start, stop, carrier);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -468,6 +627,9 @@ class UserTimelineServiceConcurrentClient : virtual public UserTimelineServiceIf
   void ReadUserTimeline(std::vector<Post> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
   int32_t send_ReadUserTimeline(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
   void recv_ReadUserTimeline(std::vector<Post> & _return, const int32_t seqid);
+  void ReadUserTimelineEntries(std::map<int64_t, int64_t> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
+  int32_t send_ReadUserTimelineEntries(const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier);
+  void recv_ReadUserTimelineEntries(std::map<int64_t, int64_t> & _return, const int32_t seqid);
  protected:
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   apache::thrift::stdcxx::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -30,6 +30,11 @@ class UserTimelineServiceHandler : virtual public UserTimelineServiceIf {
     printf("ReadUserTimeline\n");
   }
 
+  void ReadUserTimelineEntries(std::map<int64_t, int64_t> & _return, const int64_t req_id, const int64_t user_id, const int32_t start, const int32_t stop, const std::map<std::string, std::string> & carrier) {
+    // Your implementation goes here
+    printf("ReadUserTimelineEntries\n");
+  }
+
 };
 
 int main(int argc, char **argv) {
@@ -64,10 +64,10 @@ function ComposePost_args:read(iprot)
     elseif fid == 5 then
       if ftype == TType.LIST then
         self.media_ids = {}
-        local _etype97, _size94 = iprot:readListBegin()
-        for _i=1,_size94 do
-          local _elem98 = iprot:readI64()
-          table.insert(self.media_ids, _elem98)
+        local _etype105, _size102 = iprot:readListBegin()
+        for _i=1,_size102 do
+          local _elem106 = iprot:readI64()
+          table.insert(self.media_ids, _elem106)
         end
         iprot:readListEnd()
       else
@@ -76,10 +76,10 @@ function ComposePost_args:read(iprot)
     elseif fid == 6 then
       if ftype == TType.LIST then
         self.media_types = {}
-        local _etype102, _size99 = iprot:readListBegin()
-        for _i=1,_size99 do
-          local _elem103 = iprot:readString()
-          table.insert(self.media_types, _elem103)
+        local _etype110, _size107 = iprot:readListBegin()
+        for _i=1,_size107 do
+          local _elem111 = iprot:readString()
+          table.insert(self.media_types, _elem111)
         end
         iprot:readListEnd()
       else
@@ -94,11 +94,11 @@ function ComposePost_args:read(iprot)
     elseif fid == 8 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype105, _vtype106, _size104 = iprot:readMapBegin()
-        for _i=1,_size104 do
-          local _key108 = iprot:readString()
-          local _val109 = iprot:readString()
-          self.carrier[_key108] = _val109
+        local _ktype113, _vtype114, _size112 = iprot:readMapBegin()
+        for _i=1,_size112 do
+          local _key116 = iprot:readString()
+          local _val117 = iprot:readString()
+          self.carrier[_key116] = _val117
         end
         iprot:readMapEnd()
       else
@@ -137,8 +137,8 @@ function ComposePost_args:write(oprot)
   if self.media_ids ~= nil then
     oprot:writeFieldBegin('media_ids', TType.LIST, 5)
     oprot:writeListBegin(TType.I64, #self.media_ids)
-    for _,iter110 in ipairs(self.media_ids) do
-      oprot:writeI64(iter110)
+    for _,iter118 in ipairs(self.media_ids) do
+      oprot:writeI64(iter118)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -146,8 +146,8 @@ function ComposePost_args:write(oprot)
   if self.media_types ~= nil then
     oprot:writeFieldBegin('media_types', TType.LIST, 6)
     oprot:writeListBegin(TType.STRING, #self.media_types)
-    for _,iter111 in ipairs(self.media_types) do
-      oprot:writeString(iter111)
+    for _,iter119 in ipairs(self.media_types) do
+      oprot:writeString(iter119)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -160,9 +160,9 @@ function ComposePost_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 8)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter112,viter113 in pairs(self.carrier) do
-      oprot:writeString(kiter112)
-      oprot:writeString(viter113)
+    for kiter120,viter121 in pairs(self.carrier) do
+      oprot:writeString(kiter120)
+      oprot:writeString(viter121)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -62,11 +62,11 @@ function ReadHomeTimeline_args:read(iprot)
     elseif fid == 5 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype151, _vtype152, _size150 = iprot:readMapBegin()
-        for _i=1,_size150 do
-          local _key154 = iprot:readString()
-          local _val155 = iprot:readString()
-          self.carrier[_key154] = _val155
+        local _ktype159, _vtype160, _size158 = iprot:readMapBegin()
+        for _i=1,_size158 do
+          local _key162 = iprot:readString()
+          local _val163 = iprot:readString()
+          self.carrier[_key162] = _val163
         end
         iprot:readMapEnd()
       else
@@ -105,9 +105,9 @@ function ReadHomeTimeline_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 5)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter156,viter157 in pairs(self.carrier) do
-      oprot:writeString(kiter156)
-      oprot:writeString(viter157)
+    for kiter164,viter165 in pairs(self.carrier) do
+      oprot:writeString(kiter164)
+      oprot:writeString(viter165)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -130,11 +130,11 @@ function ReadHomeTimeline_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype161, _size158 = iprot:readListBegin()
-        for _i=1,_size158 do
-          local _elem162 = Post:new{}
-          _elem162:read(iprot)
-          table.insert(self.success, _elem162)
+        local _etype169, _size166 = iprot:readListBegin()
+        for _i=1,_size166 do
+          local _elem170 = Post:new{}
+          _elem170:read(iprot)
+          table.insert(self.success, _elem170)
         end
         iprot:readListEnd()
       else
@@ -160,8 +160,8 @@ function ReadHomeTimeline_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.STRUCT, #self.success)
-    for _,iter163 in ipairs(self.success) do
-      iter163:write(oprot)
+    for _,iter171 in ipairs(self.success) do
+      iter171:write(oprot)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -217,10 +217,10 @@ function WriteHomeTimeline_args:read(iprot)
     elseif fid == 5 then
       if ftype == TType.LIST then
         self.user_mentions_id = {}
-        local _etype167, _size164 = iprot:readListBegin()
-        for _i=1,_size164 do
-          local _elem168 = iprot:readI64()
-          table.insert(self.user_mentions_id, _elem168)
+        local _etype175, _size172 = iprot:readListBegin()
+        for _i=1,_size172 do
+          local _elem176 = iprot:readI64()
+          table.insert(self.user_mentions_id, _elem176)
         end
         iprot:readListEnd()
       else
@@ -229,11 +229,11 @@ function WriteHomeTimeline_args:read(iprot)
     elseif fid == 6 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype170, _vtype171, _size169 = iprot:readMapBegin()
-        for _i=1,_size169 do
-          local _key173 = iprot:readString()
-          local _val174 = iprot:readString()
-          self.carrier[_key173] = _val174
+        local _ktype178, _vtype179, _size177 = iprot:readMapBegin()
+        for _i=1,_size177 do
+          local _key181 = iprot:readString()
+          local _val182 = iprot:readString()
+          self.carrier[_key181] = _val182
         end
         iprot:readMapEnd()
       else
@@ -272,8 +272,8 @@ function WriteHomeTimeline_args:write(oprot)
   if self.user_mentions_id ~= nil then
     oprot:writeFieldBegin('user_mentions_id', TType.LIST, 5)
     oprot:writeListBegin(TType.I64, #self.user_mentions_id)
-    for _,iter175 in ipairs(self.user_mentions_id) do
-      oprot:writeI64(iter175)
+    for _,iter183 in ipairs(self.user_mentions_id) do
+      oprot:writeI64(iter183)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -281,9 +281,9 @@ function WriteHomeTimeline_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 6)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter176,viter177 in pairs(self.carrier) do
-      oprot:writeString(kiter176)
-      oprot:writeString(viter177)
+    for kiter184,viter185 in pairs(self.carrier) do
+      oprot:writeString(kiter184)
+      oprot:writeString(viter185)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -121,10 +121,10 @@ function ComposeMedia_args:read(iprot)
     elseif fid == 2 then
       if ftype == TType.LIST then
         self.media_types = {}
-        local _etype323, _size320 = iprot:readListBegin()
-        for _i=1,_size320 do
-          local _elem324 = iprot:readString()
-          table.insert(self.media_types, _elem324)
+        local _etype383, _size380 = iprot:readListBegin()
+        for _i=1,_size380 do
+          local _elem384 = iprot:readString()
+          table.insert(self.media_types, _elem384)
         end
         iprot:readListEnd()
       else
@@ -133,10 +133,10 @@ function ComposeMedia_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.LIST then
         self.media_ids = {}
-        local _etype328, _size325 = iprot:readListBegin()
-        for _i=1,_size325 do
-          local _elem329 = iprot:readI64()
-          table.insert(self.media_ids, _elem329)
+        local _etype388, _size385 = iprot:readListBegin()
+        for _i=1,_size385 do
+          local _elem389 = iprot:readI64()
+          table.insert(self.media_ids, _elem389)
         end
         iprot:readListEnd()
       else
@@ -145,11 +145,11 @@ function ComposeMedia_args:read(iprot)
     elseif fid == 4 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype331, _vtype332, _size330 = iprot:readMapBegin()
-        for _i=1,_size330 do
-          local _key334 = iprot:readString()
-          local _val335 = iprot:readString()
-          self.carrier[_key334] = _val335
+        local _ktype391, _vtype392, _size390 = iprot:readMapBegin()
+        for _i=1,_size390 do
+          local _key394 = iprot:readString()
+          local _val395 = iprot:readString()
+          self.carrier[_key394] = _val395
         end
         iprot:readMapEnd()
       else
@@ -173,8 +173,8 @@ function ComposeMedia_args:write(oprot)
   if self.media_types ~= nil then
     oprot:writeFieldBegin('media_types', TType.LIST, 2)
     oprot:writeListBegin(TType.STRING, #self.media_types)
-    for _,iter336 in ipairs(self.media_types) do
-      oprot:writeString(iter336)
+    for _,iter396 in ipairs(self.media_types) do
+      oprot:writeString(iter396)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -182,8 +182,8 @@ function ComposeMedia_args:write(oprot)
   if self.media_ids ~= nil then
     oprot:writeFieldBegin('media_ids', TType.LIST, 3)
     oprot:writeListBegin(TType.I64, #self.media_ids)
-    for _,iter337 in ipairs(self.media_ids) do
-      oprot:writeI64(iter337)
+    for _,iter397 in ipairs(self.media_ids) do
+      oprot:writeI64(iter397)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -191,9 +191,9 @@ function ComposeMedia_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 4)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter338,viter339 in pairs(self.carrier) do
-      oprot:writeString(kiter338)
-      oprot:writeString(viter339)
+    for kiter398,viter399 in pairs(self.carrier) do
+      oprot:writeString(kiter398)
+      oprot:writeString(viter399)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -216,11 +216,11 @@ function ComposeMedia_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype343, _size340 = iprot:readListBegin()
-        for _i=1,_size340 do
-          local _elem344 = Media:new{}
-          _elem344:read(iprot)
-          table.insert(self.success, _elem344)
+        local _etype403, _size400 = iprot:readListBegin()
+        for _i=1,_size400 do
+          local _elem404 = Media:new{}
+          _elem404:read(iprot)
+          table.insert(self.success, _elem404)
         end
         iprot:readListEnd()
       else
@@ -246,8 +246,8 @@ function ComposeMedia_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.STRUCT, #self.success)
-    for _,iter345 in ipairs(self.success) do
-      iter345:write(oprot)
+    for _,iter405 in ipairs(self.success) do
+      iter405:write(oprot)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -232,11 +232,11 @@ function StorePost_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype121, _vtype122, _size120 = iprot:readMapBegin()
-        for _i=1,_size120 do
-          local _key124 = iprot:readString()
-          local _val125 = iprot:readString()
-          self.carrier[_key124] = _val125
+        local _ktype129, _vtype130, _size128 = iprot:readMapBegin()
+        for _i=1,_size128 do
+          local _key132 = iprot:readString()
+          local _val133 = iprot:readString()
+          self.carrier[_key132] = _val133
         end
         iprot:readMapEnd()
       else
@@ -265,9 +265,9 @@ function StorePost_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter126,viter127 in pairs(self.carrier) do
-      oprot:writeString(kiter126)
-      oprot:writeString(viter127)
+    for kiter134,viter135 in pairs(self.carrier) do
+      oprot:writeString(kiter134)
+      oprot:writeString(viter135)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -339,11 +339,11 @@ function ReadPost_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype129, _vtype130, _size128 = iprot:readMapBegin()
-        for _i=1,_size128 do
-          local _key132 = iprot:readString()
-          local _val133 = iprot:readString()
-          self.carrier[_key132] = _val133
+        local _ktype137, _vtype138, _size136 = iprot:readMapBegin()
+        for _i=1,_size136 do
+          local _key140 = iprot:readString()
+          local _val141 = iprot:readString()
+          self.carrier[_key140] = _val141
         end
         iprot:readMapEnd()
       else
@@ -372,9 +372,9 @@ function ReadPost_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter134,viter135 in pairs(self.carrier) do
-      oprot:writeString(kiter134)
-      oprot:writeString(viter135)
+    for kiter142,viter143 in pairs(self.carrier) do
+      oprot:writeString(kiter142)
+      oprot:writeString(viter143)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -453,10 +453,10 @@ function ReadPosts_args:read(iprot)
     elseif fid == 2 then
       if ftype == TType.LIST then
         self.post_ids = {}
-        local _etype139, _size136 = iprot:readListBegin()
-        for _i=1,_size136 do
-          local _elem140 = iprot:readI64()
-          table.insert(self.post_ids, _elem140)
+        local _etype147, _size144 = iprot:readListBegin()
+        for _i=1,_size144 do
+          local _elem148 = iprot:readI64()
+          table.insert(self.post_ids, _elem148)
         end
         iprot:readListEnd()
       else
@@ -465,11 +465,11 @@ function ReadPosts_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype142, _vtype143, _size141 = iprot:readMapBegin()
-        for _i=1,_size141 do
-          local _key145 = iprot:readString()
-          local _val146 = iprot:readString()
-          self.carrier[_key145] = _val146
+        local _ktype150, _vtype151, _size149 = iprot:readMapBegin()
+        for _i=1,_size149 do
+          local _key153 = iprot:readString()
+          local _val154 = iprot:readString()
+          self.carrier[_key153] = _val154
         end
         iprot:readMapEnd()
       else
@@ -493,8 +493,8 @@ function ReadPosts_args:write(oprot)
   if self.post_ids ~= nil then
     oprot:writeFieldBegin('post_ids', TType.LIST, 2)
     oprot:writeListBegin(TType.I64, #self.post_ids)
-    for _,iter147 in ipairs(self.post_ids) do
-      oprot:writeI64(iter147)
+    for _,iter155 in ipairs(self.post_ids) do
+      oprot:writeI64(iter155)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -502,9 +502,9 @@ function ReadPosts_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter148,viter149 in pairs(self.carrier) do
-      oprot:writeString(kiter148)
-      oprot:writeString(viter149)
+    for kiter156,viter157 in pairs(self.carrier) do
+      oprot:writeString(kiter156)
+      oprot:writeString(viter157)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -527,11 +527,11 @@ function ReadPosts_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype153, _size150 = iprot:readListBegin()
-        for _i=1,_size150 do
-          local _elem154 = Post:new{}
-          _elem154:read(iprot)
-          table.insert(self.success, _elem154)
+        local _etype161, _size158 = iprot:readListBegin()
+        for _i=1,_size158 do
+          local _elem162 = Post:new{}
+          _elem162:read(iprot)
+          table.insert(self.success, _elem162)
         end
         iprot:readListEnd()
       else
@@ -557,8 +557,8 @@ function ReadPosts_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.STRUCT, #self.success)
-    for _,iter155 in ipairs(self.success) do
-      iter155:write(oprot)
+    for _,iter163 in ipairs(self.success) do
+      iter163:write(oprot)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
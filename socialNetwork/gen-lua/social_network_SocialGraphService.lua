@@ -47,11 +47,11 @@ function GetFollowers_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype201, _vtype202, _size200 = iprot:readMapBegin()
-        for _i=1,_size200 do
-          local _key204 = iprot:readString()
-          local _val205 = iprot:readString()
-          self.carrier[_key204] = _val205
+        local _ktype225, _vtype226, _size224 = iprot:readMapBegin()
+        for _i=1,_size224 do
+          local _key228 = iprot:readString()
+          local _val229 = iprot:readString()
+          self.carrier[_key228] = _val229
         end
         iprot:readMapEnd()
       else
@@ -80,9 +80,9 @@ function GetFollowers_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter206,viter207 in pairs(self.carrier) do
-      oprot:writeString(kiter206)
-      oprot:writeString(viter207)
+    for kiter230,viter231 in pairs(self.carrier) do
+      oprot:writeString(kiter230)
+      oprot:writeString(viter231)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -105,10 +105,10 @@ function GetFollowers_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype211, _size208 = iprot:readListBegin()
-        for _i=1,_size208 do
-          local _elem212 = iprot:readI64()
-          table.insert(self.success, _elem212)
+        local _etype235, _size232 = iprot:readListBegin()
+        for _i=1,_size232 do
+          local _elem236 = iprot:readI64()
+          table.insert(self.success, _elem236)
         end
         iprot:readListEnd()
       else
@@ -134,8 +134,8 @@ function GetFollowers_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.I64, #self.success)
-    for _,iter213 in ipairs(self.success) do
-      oprot:writeI64(iter213)
+    for _,iter237 in ipairs(self.success) do
+      oprot:writeI64(iter237)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -176,11 +176,11 @@ function GetFollowees_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype215, _vtype216, _size214 = iprot:readMapBegin()
-        for _i=1,_size214 do
-          local _key218 = iprot:readString()
-          local _val219 = iprot:readString()
-          self.carrier[_key218] = _val219
+        local _ktype239, _vtype240, _size238 = iprot:readMapBegin()
+        for _i=1,_size238 do
+          local _key242 = iprot:readString()
+          local _val243 = iprot:readString()
+          self.carrier[_key242] = _val243
         end
         iprot:readMapEnd()
       else
@@ -209,9 +209,9 @@ function GetFollowees_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter220,viter221 in pairs(self.carrier) do
-      oprot:writeString(kiter220)
-      oprot:writeString(viter221)
+    for kiter244,viter245 in pairs(self.carrier) do
+      oprot:writeString(kiter244)
+      oprot:writeString(viter245)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -234,10 +234,10 @@ function GetFollowees_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype225, _size222 = iprot:readListBegin()
-        for _i=1,_size222 do
-          local _elem226 = iprot:readI64()
-          table.insert(self.success, _elem226)
+        local _etype249, _size246 = iprot:readListBegin()
+        for _i=1,_size246 do
+          local _elem250 = iprot:readI64()
+          table.insert(self.success, _elem250)
         end
         iprot:readListEnd()
       else
@@ -263,8 +263,8 @@ function GetFollowees_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.I64, #self.success)
-    for _,iter227 in ipairs(self.success) do
-      oprot:writeI64(iter227)
+    for _,iter251 in ipairs(self.success) do
+      oprot:writeI64(iter251)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -312,11 +312,11 @@ function Follow_args:read(iprot)
     elseif fid == 4 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype229, _vtype230, _size228 = iprot:readMapBegin()
-        for _i=1,_size228 do
-          local _key232 = iprot:readString()
-          local _val233 = iprot:readString()
-          self.carrier[_key232] = _val233
+        local _ktype253, _vtype254, _size252 = iprot:readMapBegin()
+        for _i=1,_size252 do
+          local _key256 = iprot:readString()
+          local _val257 = iprot:readString()
+          self.carrier[_key256] = _val257
         end
         iprot:readMapEnd()
       else
@@ -350,9 +350,9 @@ function Follow_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 4)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter234,viter235 in pairs(self.carrier) do
-      oprot:writeString(kiter234)
-      oprot:writeString(viter235)
+    for kiter258,viter259 in pairs(self.carrier) do
+      oprot:writeString(kiter258)
+      oprot:writeString(viter259)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -431,11 +431,11 @@ function Unfollow_args:read(iprot)
     elseif fid == 4 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype237, _vtype238, _size236 = iprot:readMapBegin()
-        for _i=1,_size236 do
-          local _key240 = iprot:readString()
-          local _val241 = iprot:readString()
-          self.carrier[_key240] = _val241
+        local _ktype261, _vtype262, _size260 = iprot:readMapBegin()
+        for _i=1,_size260 do
+          local _key264 = iprot:readString()
+          local _val265 = iprot:readString()
+          self.carrier[_key264] = _val265
         end
         iprot:readMapEnd()
       else
@@ -469,9 +469,9 @@ function Unfollow_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 4)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter242,viter243 in pairs(self.carrier) do
-      oprot:writeString(kiter242)
-      oprot:writeString(viter243)
+    for kiter266,viter267 in pairs(self.carrier) do
+      oprot:writeString(kiter266)
+      oprot:writeString(viter267)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -550,11 +550,11 @@ function FollowWithUsername_args:read(iprot)
     elseif fid == 4 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype245, _vtype246, _size244 = iprot:readMapBegin()
-        for _i=1,_size244 do
-          local _key248 = iprot:readString()
-          local _val249 = iprot:readString()
-          self.carrier[_key248] = _val249
+        local _ktype269, _vtype270, _size268 = iprot:readMapBegin()
+        for _i=1,_size268 do
+          local _key272 = iprot:readString()
+          local _val273 = iprot:readString()
+          self.carrier[_key272] = _val273
         end
         iprot:readMapEnd()
       else
@@ -588,9 +588,9 @@ function FollowWithUsername_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 4)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter250,viter251 in pairs(self.carrier) do
-      oprot:writeString(kiter250)
-      oprot:writeString(viter251)
+    for kiter274,viter275 in pairs(self.carrier) do
+      oprot:writeString(kiter274)
+      oprot:writeString(viter275)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -669,11 +669,11 @@ function UnfollowWithUsername_args:read(iprot)
     elseif fid == 4 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype253, _vtype254, _size252 = iprot:readMapBegin()
-        for _i=1,_size252 do
-          local _key256 = iprot:readString()
-          local _val257 = iprot:readString()
-          self.carrier[_key256] = _val257
+        local _ktype277, _vtype278, _size276 = iprot:readMapBegin()
+        for _i=1,_size276 do
+          local _key280 = iprot:readString()
+          local _val281 = iprot:readString()
+          self.carrier[_key280] = _val281
         end
         iprot:readMapEnd()
       else
@@ -707,9 +707,9 @@ function UnfollowWithUsername_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 4)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter258,viter259 in pairs(self.carrier) do
-      oprot:writeString(kiter258)
-      oprot:writeString(viter259)
+    for kiter282,viter283 in pairs(self.carrier) do
+      oprot:writeString(kiter282)
+      oprot:writeString(viter283)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -781,11 +781,11 @@ function InsertUser_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype261, _vtype262, _size260 = iprot:readMapBegin()
-        for _i=1,_size260 do
-          local _key264 = iprot:readString()
-          local _val265 = iprot:readString()
-          self.carrier[_key264] = _val265
+        local _ktype285, _vtype286, _size284 = iprot:readMapBegin()
+        for _i=1,_size284 do
+          local _key288 = iprot:readString()
+          local _val289 = iprot:readString()
+          self.carrier[_key288] = _val289
         end
         iprot:readMapEnd()
       else
@@ -814,9 +814,9 @@ function InsertUser_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter266,viter267 in pairs(self.carrier) do
-      oprot:writeString(kiter266)
-      oprot:writeString(viter267)
+    for kiter290,viter291 in pairs(self.carrier) do
+      oprot:writeString(kiter290)
+      oprot:writeString(viter291)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -861,6 +861,419 @@ function InsertUser_result:write(oprot)
   oprot:writeStructEnd()
 end
 
+local GetFollowersPage_args = __TObject:new{
+  req_id,
+  user_id,
+  cursor,
+  limit,
+  carrier
+}
+
+function GetFollowersPage_args:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.req_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.I64 then
+        self.user_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 3 then
+      if ftype == TType.I64 then
+        self.cursor = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 4 then
+      if ftype == TType.I32 then
+        self.limit = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 5 then
+      if ftype == TType.MAP then
+        self.carrier = {}
+        local _ktype293, _vtype294, _size292 = iprot:readMapBegin()
+        for _i=1,_size292 do
+          local _key296 = iprot:readString()
+          local _val297 = iprot:readString()
+          self.carrier[_key296] = _val297
+        end
+        iprot:readMapEnd()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function GetFollowersPage_args:write(oprot)
+  oprot:writeStructBegin('GetFollowersPage_args')
+  if self.req_id ~= nil then
+    oprot:writeFieldBegin('req_id', TType.I64, 1)
+    oprot:writeI64(self.req_id)
+    oprot:writeFieldEnd()
+  end
+  if self.user_id ~= nil then
+    oprot:writeFieldBegin('user_id', TType.I64, 2)
+    oprot:writeI64(self.user_id)
+    oprot:writeFieldEnd()
+  end
+  if self.cursor ~= nil then
+    oprot:writeFieldBegin('cursor', TType.I64, 3)
+    oprot:writeI64(self.cursor)
+    oprot:writeFieldEnd()
+  end
+  if self.limit ~= nil then
+    oprot:writeFieldBegin('limit', TType.I32, 4)
+    oprot:writeI32(self.limit)
+    oprot:writeFieldEnd()
+  end
+  if self.carrier ~= nil then
+    oprot:writeFieldBegin('carrier', TType.MAP, 5)
+    oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
+    for kiter298,viter299 in pairs(self.carrier) do
+      oprot:writeString(kiter298)
+      oprot:writeString(viter299)
+    end
+    oprot:writeMapEnd()
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local GetFollowersPage_result = __TObject:new{
+  success,
+  se
+}
+
+function GetFollowersPage_result:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 0 then
+      if ftype == TType.LIST then
+        self.success = {}
+        local _etype303, _size300 = iprot:readListBegin()
+        for _i=1,_size300 do
+          local _elem304 = iprot:readI64()
+          table.insert(self.success, _elem304)
+        end
+        iprot:readListEnd()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 1 then
+      if ftype == TType.STRUCT then
+        self.se = ServiceException:new{}
+        self.se:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function GetFollowersPage_result:write(oprot)
+  oprot:writeStructBegin('GetFollowersPage_result')
+  if self.success ~= nil then
+    oprot:writeFieldBegin('success', TType.LIST, 0)
+    oprot:writeListBegin(TType.I64, #self.success)
+    for _,iter305 in ipairs(self.success) do
+      oprot:writeI64(iter305)
+    end
+    oprot:writeListEnd()
+    oprot:writeFieldEnd()
+  end
+  if self.se ~= nil then
+    oprot:writeFieldBegin('se', TType.STRUCT, 1)
+    self.se:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local GetFollowerCount_args = __TObject:new{
+  req_id,
+  user_id,
+  carrier
+}
+
+function GetFollowerCount_args:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.req_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.I64 then
+        self.user_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 3 then
+      if ftype == TType.MAP then
+        self.carrier = {}
+        local _ktype307, _vtype308, _size306 = iprot:readMapBegin()
+        for _i=1,_size306 do
+          local _key310 = iprot:readString()
+          local _val311 = iprot:readString()
+          self.carrier[_key310] = _val311
+        end
+        iprot:readMapEnd()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function GetFollowerCount_args:write(oprot)
+  oprot:writeStructBegin('GetFollowerCount_args')
+  if self.req_id ~= nil then
+    oprot:writeFieldBegin('req_id', TType.I64, 1)
+    oprot:writeI64(self.req_id)
+    oprot:writeFieldEnd()
+  end
+  if self.user_id ~= nil then
+    oprot:writeFieldBegin('user_id', TType.I64, 2)
+    oprot:writeI64(self.user_id)
+    oprot:writeFieldEnd()
+  end
+  if self.carrier ~= nil then
+    oprot:writeFieldBegin('carrier', TType.MAP, 3)
+    oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
+    for kiter312,viter313 in pairs(self.carrier) do
+      oprot:writeString(kiter312)
+      oprot:writeString(viter313)
+    end
+    oprot:writeMapEnd()
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local GetFollowerCount_result = __TObject:new{
+  success,
+  se
+}
+
+function GetFollowerCount_result:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 0 then
+      if ftype == TType.I64 then
+        self.success = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 1 then
+      if ftype == TType.STRUCT then
+        self.se = ServiceException:new{}
+        self.se:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function GetFollowerCount_result:write(oprot)
+  oprot:writeStructBegin('GetFollowerCount_result')
+  if self.success ~= nil then
+    oprot:writeFieldBegin('success', TType.I64, 0)
+    oprot:writeI64(self.success)
+    oprot:writeFieldEnd()
+  end
+  if self.se ~= nil then
+    oprot:writeFieldBegin('se', TType.STRUCT, 1)
+    self.se:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local GetHighFanoutFollowees_args = __TObject:new{
+  req_id,
+  user_id,
+  min_followers,
+  carrier
+}
+
+function GetHighFanoutFollowees_args:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.req_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.I64 then
+        self.user_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 3 then
+      if ftype == TType.I64 then
+        self.min_followers = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 4 then
+      if ftype == TType.MAP then
+        self.carrier = {}
+        local _ktype315, _vtype316, _size314 = iprot:readMapBegin()
+        for _i=1,_size314 do
+          local _key318 = iprot:readString()
+          local _val319 = iprot:readString()
+          self.carrier[_key318] = _val319
+        end
+        iprot:readMapEnd()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function GetHighFanoutFollowees_args:write(oprot)
+  oprot:writeStructBegin('GetHighFanoutFollowees_args')
+  if self.req_id ~= nil then
+    oprot:writeFieldBegin('req_id', TType.I64, 1)
+    oprot:writeI64(self.req_id)
+    oprot:writeFieldEnd()
+  end
+  if self.user_id ~= nil then
+    oprot:writeFieldBegin('user_id', TType.I64, 2)
+    oprot:writeI64(self.user_id)
+    oprot:writeFieldEnd()
+  end
+  if self.min_followers ~= nil then
+    oprot:writeFieldBegin('min_followers', TType.I64, 3)
+    oprot:writeI64(self.min_followers)
+    oprot:writeFieldEnd()
+  end
+  if self.carrier ~= nil then
+    oprot:writeFieldBegin('carrier', TType.MAP, 4)
+    oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
+    for kiter320,viter321 in pairs(self.carrier) do
+      oprot:writeString(kiter320)
+      oprot:writeString(viter321)
+    end
+    oprot:writeMapEnd()
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local GetHighFanoutFollowees_result = __TObject:new{
+  success,
+  se
+}
+
+function GetHighFanoutFollowees_result:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 0 then
+      if ftype == TType.LIST then
+        self.success = {}
+        local _etype325, _size322 = iprot:readListBegin()
+        for _i=1,_size322 do
+          local _elem326 = iprot:readI64()
+          table.insert(self.success, _elem326)
+        end
+        iprot:readListEnd()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 1 then
+      if ftype == TType.STRUCT then
+        self.se = ServiceException:new{}
+        self.se:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function GetHighFanoutFollowees_result:write(oprot)
+  oprot:writeStructBegin('GetHighFanoutFollowees_result')
+  if self.success ~= nil then
+    oprot:writeFieldBegin('success', TType.LIST, 0)
+    oprot:writeListBegin(TType.I64, #self.success)
+    for _,iter327 in ipairs(self.success) do
+      oprot:writeI64(iter327)
+    end
+    oprot:writeListEnd()
+    oprot:writeFieldEnd()
+  end
+  if self.se ~= nil then
+    oprot:writeFieldBegin('se', TType.STRUCT, 1)
+    self.se:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
 local SocialGraphServiceClient = __TObject.new(__TClient, {
   __type = 'SocialGraphServiceClient'
 })
@@ -1098,6 +1511,114 @@ function SocialGraphServiceClient:recv_InsertUser(req_id, user_id, carrier)
     error(result.se)
   end
 end
+
+function SocialGraphServiceClient:GetFollowersPage(req_id, user_id, cursor, limit, carrier)
+  self:send_GetFollowersPage(req_id, user_id, cursor, limit, carrier)
+  return self:recv_GetFollowersPage(req_id, user_id, cursor, limit, carrier)
+end
+
+function SocialGraphServiceClient:send_GetFollowersPage(req_id, user_id, cursor, limit, carrier)
+  self.oprot:writeMessageBegin('GetFollowersPage', TMessageType.CALL, self._seqid)
+  local args = GetFollowersPage_args:new{}
+  args.req_id = req_id
+  args.user_id = user_id
+  args.cursor = cursor
+  args.limit = limit
+  args.carrier = carrier
+  args:write(self.oprot)
+  self.oprot:writeMessageEnd()
+  self.oprot.trans:flush()
+end
+
+function SocialGraphServiceClient:recv_GetFollowersPage(req_id, user_id, cursor, limit, carrier)
+  local fname, mtype, rseqid = self.iprot:readMessageBegin()
+  if mtype == TMessageType.EXCEPTION then
+    local x = TApplicationException:new{}
+    x:read(self.iprot)
+    self.iprot:readMessageEnd()
+    error(x)
+  end
+  local result = GetFollowersPage_result:new{}
+  result:read(self.iprot)
+  self.iprot:readMessageEnd()
+  if result.success ~= nil then
+    return result.success
+  elseif result.se then
+    error(result.se)
+  end
+  error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
+end
+
+function SocialGraphServiceClient:GetFollowerCount(req_id, user_id, carrier)
+  self:send_GetFollowerCount(req_id, user_id, carrier)
+  return self:recv_GetFollowerCount(req_id, user_id, carrier)
+end
+
+function SocialGraphServiceClient:send_GetFollowerCount(req_id, user_id, carrier)
+  self.oprot:writeMessageBegin('GetFollowerCount', TMessageType.CALL, self._seqid)
+  local args = GetFollowerCount_args:new{}
+  args.req_id = req_id
+  args.user_id = user_id
+  args.carrier = carrier
+  args:write(self.oprot)
+  self.oprot:writeMessageEnd()
+  self.oprot.trans:flush()
+end
+
+function SocialGraphServiceClient:recv_GetFollowerCount(req_id, user_id, carrier)
+  local fname, mtype, rseqid = self.iprot:readMessageBegin()
+  if mtype == TMessageType.EXCEPTION then
+    local x = TApplicationException:new{}
+    x:read(self.iprot)
+    self.iprot:readMessageEnd()
+    error(x)
+  end
+  local result = GetFollowerCount_result:new{}
+  result:read(self.iprot)
+  self.iprot:readMessageEnd()
+  if result.success ~= nil then
+    return result.success
+  elseif result.se then
+    error(result.se)
+  end
+  error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
+end
+
+function SocialGraphServiceClient:GetHighFanoutFollowees(req_id, user_id, min_followers, carrier)
+  self:send_GetHighFanoutFollowees(req_id, user_id, min_followers, carrier)
+  return self:recv_GetHighFanoutFollowees(req_id, user_id, min_followers, carrier)
+end
+
+function SocialGraphServiceClient:send_GetHighFanoutFollowees(req_id, user_id, min_followers, carrier)
+  self.oprot:writeMessageBegin('GetHighFanoutFollowees', TMessageType.CALL, self._seqid)
+  local args = GetHighFanoutFollowees_args:new{}
+  args.req_id = req_id
+  args.user_id = user_id
+  args.min_followers = min_followers
+  args.carrier = carrier
+  args:write(self.oprot)
+  self.oprot:writeMessageEnd()
+  self.oprot.trans:flush()
+end
+
+function SocialGraphServiceClient:recv_GetHighFanoutFollowees(req_id, user_id, min_followers, carrier)
+  local fname, mtype, rseqid = self.iprot:readMessageBegin()
+  if mtype == TMessageType.EXCEPTION then
+    local x = TApplicationException:new{}
+    x:read(self.iprot)
+    self.iprot:readMessageEnd()
+    error(x)
+  end
+  local result = GetHighFanoutFollowees_result:new{}
+  result:read(self.iprot)
+  self.iprot:readMessageEnd()
+  if result.success ~= nil then
+    return result.success
+  elseif result.se then
+    error(result.se)
+  end
+  error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
+end
 local SocialGraphServiceIface = __TObject:new{
   __type = 'SocialGraphServiceIface'
 }
@@ -1273,6 +1794,69 @@ function SocialGraphServiceProcessor:process_InsertUser(seqid, iprot, oprot, ser
   oprot.trans:flush()
 end
 
+function SocialGraphServiceProcessor:process_GetFollowersPage(seqid, iprot, oprot, server_ctx)
+  local args = GetFollowersPage_args:new{}
+  local reply_type = TMessageType.REPLY
+  args:read(iprot)
+  iprot:readMessageEnd()
+  local result = GetFollowersPage_result:new{}
+  local status, res = pcall(self.handler.GetFollowersPage, self.handler, args.req_id, args.user_id, args.cursor, args.limit, args.carrier)
+  if not status then
+    reply_type = TMessageType.EXCEPTION
+    result = TApplicationException:new{message = res}
+  elseif ttype(res) == 'ServiceException' then
+    result.se = res
+  else
+    result.success = res
+  end
+  oprot:writeMessageBegin('GetFollowersPage', reply_type, seqid)
+  result:write(oprot)
+  oprot:writeMessageEnd()
+  oprot.trans:flush()
+end
+
+function SocialGraphServiceProcessor:process_GetFollowerCount(seqid, iprot, oprot, server_ctx)
+  local args = GetFollowerCount_args:new{}
+  local reply_type = TMessageType.REPLY
+  args:read(iprot)
+  iprot:readMessageEnd()
+  local result = GetFollowerCount_result:new{}
+  local status, res = pcall(self.handler.GetFollowerCount, self.handler, args.req_id, args.user_id, args.carrier)
+  if not status then
+    reply_type = TMessageType.EXCEPTION
+    result = TApplicationException:new{message = res}
+  elseif ttype(res) == 'ServiceException' then
+    result.se = res
+  else
+    result.success = res
+  end
+  oprot:writeMessageBegin('GetFollowerCount', reply_type, seqid)
+  result:write(oprot)
+  oprot:writeMessageEnd()
+  oprot.trans:flush()
+end
+
+function SocialGraphServiceProcessor:process_GetHighFanoutFollowees(seqid, iprot, oprot, server_ctx)
+  local args = GetHighFanoutFollowees_args:new{}
+  local reply_type = TMessageType.REPLY
+  args:read(iprot)
+  iprot:readMessageEnd()
+  local result = GetHighFanoutFollowees_result:new{}
+  local status, res = pcall(self.handler.GetHighFanoutFollowees, self.handler, args.req_id, args.user_id, args.min_followers, args.carrier)
+  if not status then
+    reply_type = TMessageType.EXCEPTION
+    result = TApplicationException:new{message = res}
+  elseif ttype(res) == 'ServiceException' then
+    result.se = res
+  else
+    result.success = res
+  end
+  oprot:writeMessageBegin('GetHighFanoutFollowees', reply_type, seqid)
+  result:write(oprot)
+  oprot:writeMessageEnd()
+  oprot.trans:flush()
+end
+
 return {
   SocialGraphServiceClient = SocialGraphServiceClient
 }
\ No newline at end of file
@@ -125,11 +125,11 @@ function ComposeText_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype39, _vtype40, _size38 = iprot:readMapBegin()
-        for _i=1,_size38 do
-          local _key42 = iprot:readString()
-          local _val43 = iprot:readString()
-          self.carrier[_key42] = _val43
+        local _ktype47, _vtype48, _size46 = iprot:readMapBegin()
+        for _i=1,_size46 do
+          local _key50 = iprot:readString()
+          local _val51 = iprot:readString()
+          self.carrier[_key50] = _val51
         end
         iprot:readMapEnd()
       else
@@ -158,9 +158,9 @@ function ComposeText_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter44,viter45 in pairs(self.carrier) do
-      oprot:writeString(kiter44)
-      oprot:writeString(viter45)
+    for kiter52,viter53 in pairs(self.carrier) do
+      oprot:writeString(kiter52)
+      oprot:writeString(viter53)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
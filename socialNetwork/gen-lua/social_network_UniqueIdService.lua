@@ -47,6 +47,41 @@ function UniqueIdServiceClient:recv_ComposeUniqueId(req_id, post_type, carrier)
   end
   error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
 end
+
+function UniqueIdServiceClient:ComposeUniqueIds(req_id, count, carrier)
+  self:send_ComposeUniqueIds(req_id, count, carrier)
+  return self:recv_ComposeUniqueIds(req_id, count, carrier)
+end
+
+function UniqueIdServiceClient:send_ComposeUniqueIds(req_id, count, carrier)
+  self.oprot:writeMessageBegin('ComposeUniqueIds', TMessageType.CALL, self._seqid)
+  local args = ComposeUniqueIds_args:new{}
+  args.req_id = req_id
+  args.count = count
+  args.carrier = carrier
+  args:write(self.oprot)
+  self.oprot:writeMessageEnd()
+  self.oprot.trans:flush()
+end
+
+function UniqueIdServiceClient:recv_ComposeUniqueIds(req_id, count, carrier)
+  local fname, mtype, rseqid = self.iprot:readMessageBegin()
+  if mtype == TMessageType.EXCEPTION then
+    local x = TApplicationException:new{}
+    x:read(self.iprot)
+    self.iprot:readMessageEnd()
+    error(x)
+  end
+  local result = ComposeUniqueIds_result:new{}
+  result:read(self.iprot)
+  self.iprot:readMessageEnd()
+  if result.success ~= nil then
+    return result.success
+  elseif result.se then
+    error(result.se)
+  end
+  error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
+end
 UniqueIdServiceIface = __TObject:new{
   __type = 'UniqueIdServiceIface'
 }
@@ -96,6 +131,27 @@ function UniqueIdServiceProcessor:process_ComposeUniqueId(seqid, iprot, oprot, s
   oprot.trans:flush()
 end
 
+function UniqueIdServiceProcessor:process_ComposeUniqueIds(seqid, iprot, oprot, server_ctx)
+  local args = ComposeUniqueIds_args:new{}
+  local reply_type = TMessageType.REPLY
+  args:read(iprot)
+  iprot:readMessageEnd()
+  local result = ComposeUniqueIds_result:new{}
+  local status, res = pcall(self.handler.ComposeUniqueIds, self.handler, args.req_id, args.count, args.carrier)
+  if not status then
+    reply_type = TMessageType.EXCEPTION
+    result = TApplicationException:new{message = res}
+  elseif ttype(res) == 'ServiceException' then
+    result.se = res
+  else
+    result.success = res
+  end
+  oprot:writeMessageBegin('ComposeUniqueIds', reply_type, seqid)
+  result:write(oprot)
+  oprot:writeMessageEnd()
+  oprot.trans:flush()
+end
+
 -- HELPER FUNCTIONS AND STRUCTURES
 
 ComposeUniqueId_args = __TObject:new{
@@ -215,4 +271,123 @@ function ComposeUniqueId_result:write(oprot)
   end
   oprot:writeFieldStop()
   oprot:writeStructEnd()
+end
+
+ComposeUniqueIds_args = __TObject:new{
+  req_id,
+  count,
+  carrier
+}
+
+function ComposeUniqueIds_args:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.req_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.I32 then
+        self.count = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 3 then
+      if ftype == TType.MAP then
+        self.carrier = {}
+        local _ktype39, _vtype40, _size38 = iprot:readMapBegin()
+        for _i=1,_size38 do
+          local _key42 = iprot:readString()
+          local _val43 = iprot:readString()
+          self.carrier[_key42] = _val43
+        end
+        iprot:readMapEnd()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function ComposeUniqueIds_args:write(oprot)
+  oprot:writeStructBegin('ComposeUniqueIds_args')
+  if self.req_id ~= nil then
+    oprot:writeFieldBegin('req_id', TType.I64, 1)
+    oprot:writeI64(self.req_id)
+    oprot:writeFieldEnd()
+  end
+  if self.count ~= nil then
+    oprot:writeFieldBegin('count', TType.I32, 2)
+    oprot:writeI32(self.count)
+    oprot:writeFieldEnd()
+  end
+  if self.carrier ~= nil then
+    oprot:writeFieldBegin('carrier', TType.MAP, 3)
+    oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
+    for kiter44,viter45 in pairs(self.carrier) do
+      oprot:writeString(kiter44)
+      oprot:writeString(viter45)
+    end
+    oprot:writeMapEnd()
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+ComposeUniqueIds_result = __TObject:new{
+  success,
+  se
+}
+
+function ComposeUniqueIds_result:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 0 then
+      if ftype == TType.I64 then
+        self.success = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 1 then
+      if ftype == TType.STRUCT then
+        self.se = ServiceException:new{}
+        self.se:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function ComposeUniqueIds_result:write(oprot)
+  oprot:writeStructBegin('ComposeUniqueIds_result')
+  if self.success ~= nil then
+    oprot:writeFieldBegin('success', TType.I64, 0)
+    oprot:writeI64(self.success)
+    oprot:writeFieldEnd()
+  end
+  if self.se ~= nil then
+    oprot:writeFieldBegin('se', TType.STRUCT, 1)
+    self.se:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
 end
\ No newline at end of file
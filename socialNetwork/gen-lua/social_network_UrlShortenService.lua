@@ -175,10 +175,10 @@ function ComposeUrls_args:read(iprot)
     elseif fid == 2 then
       if ftype == TType.LIST then
         self.urls = {}
-        local _etype283, _size280 = iprot:readListBegin()
-        for _i=1,_size280 do
-          local _elem284 = iprot:readString()
-          table.insert(self.urls, _elem284)
+        local _etype343, _size340 = iprot:readListBegin()
+        for _i=1,_size340 do
+          local _elem344 = iprot:readString()
+          table.insert(self.urls, _elem344)
         end
         iprot:readListEnd()
       else
@@ -187,11 +187,11 @@ function ComposeUrls_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype286, _vtype287, _size285 = iprot:readMapBegin()
-        for _i=1,_size285 do
-          local _key289 = iprot:readString()
-          local _val290 = iprot:readString()
-          self.carrier[_key289] = _val290
+        local _ktype346, _vtype347, _size345 = iprot:readMapBegin()
+        for _i=1,_size345 do
+          local _key349 = iprot:readString()
+          local _val350 = iprot:readString()
+          self.carrier[_key349] = _val350
         end
         iprot:readMapEnd()
       else
@@ -215,8 +215,8 @@ function ComposeUrls_args:write(oprot)
   if self.urls ~= nil then
     oprot:writeFieldBegin('urls', TType.LIST, 2)
     oprot:writeListBegin(TType.STRING, #self.urls)
-    for _,iter291 in ipairs(self.urls) do
-      oprot:writeString(iter291)
+    for _,iter351 in ipairs(self.urls) do
+      oprot:writeString(iter351)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -224,9 +224,9 @@ function ComposeUrls_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter292,viter293 in pairs(self.carrier) do
-      oprot:writeString(kiter292)
-      oprot:writeString(viter293)
+    for kiter352,viter353 in pairs(self.carrier) do
+      oprot:writeString(kiter352)
+      oprot:writeString(viter353)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -249,11 +249,11 @@ function ComposeUrls_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype297, _size294 = iprot:readListBegin()
-        for _i=1,_size294 do
-          local _elem298 = Url:new{}
-          _elem298:read(iprot)
-          table.insert(self.success, _elem298)
+        local _etype357, _size354 = iprot:readListBegin()
+        for _i=1,_size354 do
+          local _elem358 = Url:new{}
+          _elem358:read(iprot)
+          table.insert(self.success, _elem358)
         end
         iprot:readListEnd()
       else
@@ -279,8 +279,8 @@ function ComposeUrls_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.STRUCT, #self.success)
-    for _,iter299 in ipairs(self.success) do
-      iter299:write(oprot)
+    for _,iter359 in ipairs(self.success) do
+      iter359:write(oprot)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -315,10 +315,10 @@ function GetExtendedUrls_args:read(iprot)
     elseif fid == 2 then
       if ftype == TType.LIST then
         self.shortened_urls = {}
-        local _etype303, _size300 = iprot:readListBegin()
-        for _i=1,_size300 do
-          local _elem304 = iprot:readString()
-          table.insert(self.shortened_urls, _elem304)
+        local _etype363, _size360 = iprot:readListBegin()
+        for _i=1,_size360 do
+          local _elem364 = iprot:readString()
+          table.insert(self.shortened_urls, _elem364)
         end
         iprot:readListEnd()
       else
@@ -327,11 +327,11 @@ function GetExtendedUrls_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype306, _vtype307, _size305 = iprot:readMapBegin()
-        for _i=1,_size305 do
-          local _key309 = iprot:readString()
-          local _val310 = iprot:readString()
-          self.carrier[_key309] = _val310
+        local _ktype366, _vtype367, _size365 = iprot:readMapBegin()
+        for _i=1,_size365 do
+          local _key369 = iprot:readString()
+          local _val370 = iprot:readString()
+          self.carrier[_key369] = _val370
         end
         iprot:readMapEnd()
       else
@@ -355,8 +355,8 @@ function GetExtendedUrls_args:write(oprot)
   if self.shortened_urls ~= nil then
     oprot:writeFieldBegin('shortened_urls', TType.LIST, 2)
     oprot:writeListBegin(TType.STRING, #self.shortened_urls)
-    for _,iter311 in ipairs(self.shortened_urls) do
-      oprot:writeString(iter311)
+    for _,iter371 in ipairs(self.shortened_urls) do
+      oprot:writeString(iter371)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -364,9 +364,9 @@ function GetExtendedUrls_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter312,viter313 in pairs(self.carrier) do
-      oprot:writeString(kiter312)
-      oprot:writeString(viter313)
+    for kiter372,viter373 in pairs(self.carrier) do
+      oprot:writeString(kiter372)
+      oprot:writeString(viter373)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -389,10 +389,10 @@ function GetExtendedUrls_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype317, _size314 = iprot:readListBegin()
-        for _i=1,_size314 do
-          local _elem318 = iprot:readString()
-          table.insert(self.success, _elem318)
+        local _etype377, _size374 = iprot:readListBegin()
+        for _i=1,_size374 do
+          local _elem378 = iprot:readString()
+          table.insert(self.success, _elem378)
         end
         iprot:readListEnd()
       else
@@ -418,8 +418,8 @@ function GetExtendedUrls_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.STRING, #self.success)
-    for _,iter319 in ipairs(self.success) do
-      oprot:writeString(iter319)
+    for _,iter379 in ipairs(self.success) do
+      oprot:writeString(iter379)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -119,10 +119,10 @@ function ComposeUserMentions_args:read(iprot)
     elseif fid == 2 then
       if ftype == TType.LIST then
         self.usernames = {}
-        local _etype263, _size260 = iprot:readListBegin()
-        for _i=1,_size260 do
-          local _elem264 = iprot:readString()
-          table.insert(self.usernames, _elem264)
+        local _etype323, _size320 = iprot:readListBegin()
+        for _i=1,_size320 do
+          local _elem324 = iprot:readString()
+          table.insert(self.usernames, _elem324)
         end
         iprot:readListEnd()
       else
@@ -131,11 +131,11 @@ function ComposeUserMentions_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype266, _vtype267, _size265 = iprot:readMapBegin()
-        for _i=1,_size265 do
-          local _key269 = iprot:readString()
-          local _val270 = iprot:readString()
-          self.carrier[_key269] = _val270
+        local _ktype326, _vtype327, _size325 = iprot:readMapBegin()
+        for _i=1,_size325 do
+          local _key329 = iprot:readString()
+          local _val330 = iprot:readString()
+          self.carrier[_key329] = _val330
         end
         iprot:readMapEnd()
       else
@@ -159,8 +159,8 @@ function ComposeUserMentions_args:write(oprot)
   if self.usernames ~= nil then
     oprot:writeFieldBegin('usernames', TType.LIST, 2)
     oprot:writeListBegin(TType.STRING, #self.usernames)
-    for _,iter271 in ipairs(self.usernames) do
-      oprot:writeString(iter271)
+    for _,iter331 in ipairs(self.usernames) do
+      oprot:writeString(iter331)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -168,9 +168,9 @@ function ComposeUserMentions_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter272,viter273 in pairs(self.carrier) do
-      oprot:writeString(kiter272)
-      oprot:writeString(viter273)
+    for kiter332,viter333 in pairs(self.carrier) do
+      oprot:writeString(kiter332)
+      oprot:writeString(viter333)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -193,11 +193,11 @@ function ComposeUserMentions_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype277, _size274 = iprot:readListBegin()
-        for _i=1,_size274 do
-          local _elem278 = UserMention:new{}
-          _elem278:read(iprot)
-          table.insert(self.success, _elem278)
+        local _etype337, _size334 = iprot:readListBegin()
+        for _i=1,_size334 do
+          local _elem338 = UserMention:new{}
+          _elem338:read(iprot)
+          table.insert(self.success, _elem338)
         end
         iprot:readListEnd()
       else
@@ -223,8 +223,8 @@ function ComposeUserMentions_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.STRUCT, #self.success)
-    for _,iter279 in ipairs(self.success) do
-      iter279:write(oprot)
+    for _,iter339 in ipairs(self.success) do
+      iter339:write(oprot)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
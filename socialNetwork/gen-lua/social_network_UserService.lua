@@ -69,11 +69,11 @@ function RegisterUser_args:read(iprot)
     elseif fid == 6 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype47, _vtype48, _size46 = iprot:readMapBegin()
-        for _i=1,_size46 do
-          local _key50 = iprot:readString()
-          local _val51 = iprot:readString()
-          self.carrier[_key50] = _val51
+        local _ktype55, _vtype56, _size54 = iprot:readMapBegin()
+        for _i=1,_size54 do
+          local _key58 = iprot:readString()
+          local _val59 = iprot:readString()
+          self.carrier[_key58] = _val59
         end
         iprot:readMapEnd()
       else
@@ -117,9 +117,9 @@ function RegisterUser_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 6)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter52,viter53 in pairs(self.carrier) do
-      oprot:writeString(kiter52)
-      oprot:writeString(viter53)
+    for kiter60,viter61 in pairs(self.carrier) do
+      oprot:writeString(kiter60)
+      oprot:writeString(viter61)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -219,11 +219,11 @@ function RegisterUserWithId_args:read(iprot)
     elseif fid == 7 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype55, _vtype56, _size54 = iprot:readMapBegin()
-        for _i=1,_size54 do
-          local _key58 = iprot:readString()
-          local _val59 = iprot:readString()
-          self.carrier[_key58] = _val59
+        local _ktype63, _vtype64, _size62 = iprot:readMapBegin()
+        for _i=1,_size62 do
+          local _key66 = iprot:readString()
+          local _val67 = iprot:readString()
+          self.carrier[_key66] = _val67
         end
         iprot:readMapEnd()
       else
@@ -272,9 +272,9 @@ function RegisterUserWithId_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 7)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter60,viter61 in pairs(self.carrier) do
-      oprot:writeString(kiter60)
-      oprot:writeString(viter61)
+    for kiter68,viter69 in pairs(self.carrier) do
+      oprot:writeString(kiter68)
+      oprot:writeString(viter69)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -353,11 +353,11 @@ function Login_args:read(iprot)
     elseif fid == 4 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype63, _vtype64, _size62 = iprot:readMapBegin()
-        for _i=1,_size62 do
-          local _key66 = iprot:readString()
-          local _val67 = iprot:readString()
-          self.carrier[_key66] = _val67
+        local _ktype71, _vtype72, _size70 = iprot:readMapBegin()
+        for _i=1,_size70 do
+          local _key74 = iprot:readString()
+          local _val75 = iprot:readString()
+          self.carrier[_key74] = _val75
         end
         iprot:readMapEnd()
       else
@@ -391,9 +391,9 @@ function Login_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 4)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter68,viter69 in pairs(self.carrier) do
-      oprot:writeString(kiter68)
-      oprot:writeString(viter69)
+    for kiter76,viter77 in pairs(self.carrier) do
+      oprot:writeString(kiter76)
+      oprot:writeString(viter77)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -484,11 +484,11 @@ function ComposeCreatorWithUserId_args:read(iprot)
     elseif fid == 4 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype71, _vtype72, _size70 = iprot:readMapBegin()
-        for _i=1,_size70 do
-          local _key74 = iprot:readString()
-          local _val75 = iprot:readString()
-          self.carrier[_key74] = _val75
+        local _ktype79, _vtype80, _size78 = iprot:readMapBegin()
+        for _i=1,_size78 do
+          local _key82 = iprot:readString()
+          local _val83 = iprot:readString()
+          self.carrier[_key82] = _val83
         end
         iprot:readMapEnd()
       else
@@ -522,9 +522,9 @@ function ComposeCreatorWithUserId_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 4)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter76,viter77 in pairs(self.carrier) do
-      oprot:writeString(kiter76)
-      oprot:writeString(viter77)
+    for kiter84,viter85 in pairs(self.carrier) do
+      oprot:writeString(kiter84)
+      oprot:writeString(viter85)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -609,11 +609,11 @@ function ComposeCreatorWithUsername_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype79, _vtype80, _size78 = iprot:readMapBegin()
-        for _i=1,_size78 do
-          local _key82 = iprot:readString()
-          local _val83 = iprot:readString()
-          self.carrier[_key82] = _val83
+        local _ktype87, _vtype88, _size86 = iprot:readMapBegin()
+        for _i=1,_size86 do
+          local _key90 = iprot:readString()
+          local _val91 = iprot:readString()
+          self.carrier[_key90] = _val91
         end
         iprot:readMapEnd()
       else
@@ -642,9 +642,9 @@ function ComposeCreatorWithUsername_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter84,viter85 in pairs(self.carrier) do
-      oprot:writeString(kiter84)
-      oprot:writeString(viter85)
+    for kiter92,viter93 in pairs(self.carrier) do
+      oprot:writeString(kiter92)
+      oprot:writeString(viter93)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -729,11 +729,11 @@ function GetUserId_args:read(iprot)
     elseif fid == 3 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype87, _vtype88, _size86 = iprot:readMapBegin()
-        for _i=1,_size86 do
-          local _key90 = iprot:readString()
-          local _val91 = iprot:readString()
-          self.carrier[_key90] = _val91
+        local _ktype95, _vtype96, _size94 = iprot:readMapBegin()
+        for _i=1,_size94 do
+          local _key98 = iprot:readString()
+          local _val99 = iprot:readString()
+          self.carrier[_key98] = _val99
         end
         iprot:readMapEnd()
       else
@@ -762,9 +762,9 @@ function GetUserId_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 3)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter92,viter93 in pairs(self.carrier) do
-      oprot:writeString(kiter92)
-      oprot:writeString(viter93)
+    for kiter100,viter101 in pairs(self.carrier) do
+      oprot:writeString(kiter100)
+      oprot:writeString(viter101)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -62,11 +62,11 @@ function WriteUserTimeline_args:read(iprot)
     elseif fid == 5 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype171, _vtype172, _size170 = iprot:readMapBegin()
-        for _i=1,_size170 do
-          local _key174 = iprot:readString()
-          local _val175 = iprot:readString()
-          self.carrier[_key174] = _val175
+        local _ktype179, _vtype180, _size178 = iprot:readMapBegin()
+        for _i=1,_size178 do
+          local _key182 = iprot:readString()
+          local _val183 = iprot:readString()
+          self.carrier[_key182] = _val183
         end
         iprot:readMapEnd()
       else
@@ -105,9 +105,9 @@ function WriteUserTimeline_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 5)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter176,viter177 in pairs(self.carrier) do
-      oprot:writeString(kiter176)
-      oprot:writeString(viter177)
+    for kiter184,viter185 in pairs(self.carrier) do
+      oprot:writeString(kiter184)
+      oprot:writeString(viter185)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -193,11 +193,11 @@ function ReadUserTimeline_args:read(iprot)
     elseif fid == 5 then
       if ftype == TType.MAP then
         self.carrier = {}
-        local _ktype179, _vtype180, _size178 = iprot:readMapBegin()
-        for _i=1,_size178 do
-          local _key182 = iprot:readString()
-          local _val183 = iprot:readString()
-          self.carrier[_key182] = _val183
+        local _ktype187, _vtype188, _size186 = iprot:readMapBegin()
+        for _i=1,_size186 do
+          local _key190 = iprot:readString()
+          local _val191 = iprot:readString()
+          self.carrier[_key190] = _val191
         end
         iprot:readMapEnd()
       else
@@ -236,9 +236,9 @@ function ReadUserTimeline_args:write(oprot)
   if self.carrier ~= nil then
     oprot:writeFieldBegin('carrier', TType.MAP, 5)
     oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
-    for kiter184,viter185 in pairs(self.carrier) do
-      oprot:writeString(kiter184)
-      oprot:writeString(viter185)
+    for kiter192,viter193 in pairs(self.carrier) do
+      oprot:writeString(kiter192)
+      oprot:writeString(viter193)
     end
     oprot:writeMapEnd()
     oprot:writeFieldEnd()
@@ -261,11 +261,11 @@ function ReadUserTimeline_result:read(iprot)
     elseif fid == 0 then
       if ftype == TType.LIST then
         self.success = {}
-        local _etype189, _size186 = iprot:readListBegin()
-        for _i=1,_size186 do
-          local _elem190 = Post:new{}
-          _elem190:read(iprot)
-          table.insert(self.success, _elem190)
+        local _etype197, _size194 = iprot:readListBegin()
+        for _i=1,_size194 do
+          local _elem198 = Post:new{}
+          _elem198:read(iprot)
+          table.insert(self.success, _elem198)
         end
         iprot:readListEnd()
       else
@@ -291,8 +291,8 @@ function ReadUserTimeline_result:write(oprot)
   if self.success ~= nil then
     oprot:writeFieldBegin('success', TType.LIST, 0)
     oprot:writeListBegin(TType.STRUCT, #self.success)
-    for _,iter191 in ipairs(self.success) do
-      iter191:write(oprot)
+    for _,iter199 in ipairs(self.success) do
+      iter199:write(oprot)
     end
     oprot:writeListEnd()
     oprot:writeFieldEnd()
@@ -306,6 +306,161 @@ function ReadUserTimeline_result:write(oprot)
   oprot:writeStructEnd()
 end
 
+local ReadUserTimelineEntries_args = __TObject:new{
+  req_id,
+  user_id,
+  start,
+  stop,
+  carrier
+}
+
+function ReadUserTimelineEntries_args:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 1 then
+      if ftype == TType.I64 then
+        self.req_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 2 then
+      if ftype == TType.I64 then
+        self.user_id = iprot:readI64()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 3 then
+      if ftype == TType.I32 then
+        self.start = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 4 then
+      if ftype == TType.I32 then
+        self.stop = iprot:readI32()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 5 then
+      if ftype == TType.MAP then
+        self.carrier = {}
+        local _ktype201, _vtype202, _size200 = iprot:readMapBegin()
+        for _i=1,_size200 do
+          local _key204 = iprot:readString()
+          local _val205 = iprot:readString()
+          self.carrier[_key204] = _val205
+        end
+        iprot:readMapEnd()
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function ReadUserTimelineEntries_args:write(oprot)
+  oprot:writeStructBegin('ReadUserTimelineEntries_args')
+  if self.req_id ~= nil then
+    oprot:writeFieldBegin('req_id', TType.I64, 1)
+    oprot:writeI64(self.req_id)
+    oprot:writeFieldEnd()
+  end
+  if self.user_id ~= nil then
+    oprot:writeFieldBegin('user_id', TType.I64, 2)
+    oprot:writeI64(self.user_id)
+    oprot:writeFieldEnd()
+  end
+  if self.start ~= nil then
+    oprot:writeFieldBegin('start', TType.I32, 3)
+    oprot:writeI32(self.start)
+    oprot:writeFieldEnd()
+  end
+  if self.stop ~= nil then
+    oprot:writeFieldBegin('stop', TType.I32, 4)
+    oprot:writeI32(self.stop)
+    oprot:writeFieldEnd()
+  end
+  if self.carrier ~= nil then
+    oprot:writeFieldBegin('carrier', TType.MAP, 5)
+    oprot:writeMapBegin(TType.STRING, TType.STRING, ttable_size(self.carrier))
+    for kiter206,viter207 in pairs(self.carrier) do
+      oprot:writeString(kiter206)
+      oprot:writeString(viter207)
+    end
+    oprot:writeMapEnd()
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
+local ReadUserTimelineEntries_result = __TObject:new{
+  success,
+  se
+}
+
+function ReadUserTimelineEntries_result:read(iprot)
+  iprot:readStructBegin()
+  while true do
+    local fname, ftype, fid = iprot:readFieldBegin()
+    if ftype == TType.STOP then
+      break
+    elseif fid == 0 then
+      if ftype == TType.MAP then
+        self.success = {}
+        local _ktype209, _vtype210, _size208 = iprot:readMapBegin()
+        for _i=1,_size208 do
+          local _key212 = iprot:readI64()
+          local _val213 = iprot:readI64()
+          self.success[_key212] = _val213
+        end
+        iprot:readMapEnd()
+      else
+        iprot:skip(ftype)
+      end
+    elseif fid == 1 then
+      if ftype == TType.STRUCT then
+        self.se = ServiceException:new{}
+        self.se:read(iprot)
+      else
+        iprot:skip(ftype)
+      end
+    else
+      iprot:skip(ftype)
+    end
+    iprot:readFieldEnd()
+  end
+  iprot:readStructEnd()
+end
+
+function ReadUserTimelineEntries_result:write(oprot)
+  oprot:writeStructBegin('ReadUserTimelineEntries_result')
+  if self.success ~= nil then
+    oprot:writeFieldBegin('success', TType.MAP, 0)
+    oprot:writeMapBegin(TType.I64, TType.I64, ttable_size(self.success))
+    for kiter214,viter215 in pairs(self.success) do
+      oprot:writeI64(kiter214)
+      oprot:writeI64(viter215)
+    end
+    oprot:writeMapEnd()
+    oprot:writeFieldEnd()
+  end
+  if self.se ~= nil then
+    oprot:writeFieldBegin('se', TType.STRUCT, 1)
+    self.se:write(oprot)
+    oprot:writeFieldEnd()
+  end
+  oprot:writeFieldStop()
+  oprot:writeStructEnd()
+end
+
 local UserTimelineServiceClient = __TObject.new(__TClient, {
   __type = 'UserTimelineServiceClient'
 })
@@ -380,6 +535,43 @@ function UserTimelineServiceClient:recv_ReadUserTimeline(req_id, user_id, start,
   end
   error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
 end
+
+function UserTimelineServiceClient:ReadUserTimelineEntries(req_id, user_id, start, stop, carrier)
+  self:send_ReadUserTimelineEntries(req_id, user_id, start, stop, carrier)
+  return self:recv_ReadUserTimelineEntries(req_id, user_id, start, stop, carrier)
+end
+
+function UserTimelineServiceClient:send_ReadUserTimelineEntries(req_id, user_id, start, stop, carrier)
+  self.oprot:writeMessageBegin('ReadUserTimelineEntries', TMessageType.CALL, self._seqid)
+  local args = ReadUserTimelineEntries_args:new{}
+  args.req_id = req_id
+  args.user_id = user_id
+  args.start = start
+  args.stop = stop
+  args.carrier = carrier
+  args:write(self.oprot)
+  self.oprot:writeMessageEnd()
+  self.oprot.trans:flush()
+end
+
+function UserTimelineServiceClient:recv_ReadUserTimelineEntries(req_id, user_id, start, stop, carrier)
+  local fname, mtype, rseqid = self.iprot:readMessageBegin()
+  if mtype == TMessageType.EXCEPTION then
+    local x = TApplicationException:new{}
+    x:read(self.iprot)
+    self.iprot:readMessageEnd()
+    error(x)
+  end
+  local result = ReadUserTimelineEntries_result:new{}
+  result:read(self.iprot)
+  self.iprot:readMessageEnd()
+  if result.success ~= nil then
+    return result.success
+  elseif result.se then
+    error(result.se)
+  end
+  error(TApplicationException:new{errorCode = TApplicationException.MISSING_RESULT})
+end
 local UserTimelineServiceIface = __TObject:new{
   __type = 'UserTimelineServiceIface'
 }
@@ -450,6 +642,27 @@ function UserTimelineServiceProcessor:process_ReadUserTimeline(seqid, iprot, opr
   oprot.trans:flush()
 end
 
+function UserTimelineServiceProcessor:process_ReadUserTimelineEntries(seqid, iprot, oprot, server_ctx)
+  local args = ReadUserTimelineEntries_args:new{}
+  local reply_type = TMessageType.REPLY
+  args:read(iprot)
+  iprot:readMessageEnd()
+  local result = ReadUserTimelineEntries_result:new{}
+  local status, res = pcall(self.handler.ReadUserTimelineEntries, self.handler, args.req_id, args.user_id, args.start, args.stop, args.carrier)
+  if not status then
+    reply_type = TMessageType.EXCEPTION
+    result = TApplicationException:new{message = res}
+  elseif ttype(res) == 'ServiceException' then
+    result.se = res
+  else
+    result.success = res
+  end
+  oprot:writeMessageBegin('ReadUserTimelineEntries', reply_type, seqid)
+  result:write(oprot)
+  oprot:writeMessageEnd()
+  oprot.trans:flush()
+end
+
 return {
   UserTimelineServiceClient = UserTimelineServiceClient
 }
\ No newline at end of file
@@ -271,11 +271,11 @@ class ReadHomeTimeline_args(object):
             elif fid == 5:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype172, _vtype173, _size171) = iprot.readMapBegin()
-                    for _i175 in range(_size171):
-                        _key176 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val177 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key176] = _val177
+                    (_ktype181, _vtype182, _size180) = iprot.readMapBegin()
+                    for _i184 in range(_size180):
+                        _key185 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val186 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key185] = _val186
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -308,9 +308,9 @@ class ReadHomeTimeline_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 5)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter178, viter179 in self.carrier.items():
-                oprot.writeString(kiter178.encode('utf-8') if sys.version_info[0] == 2 else kiter178)
-                oprot.writeString(viter179.encode('utf-8') if sys.version_info[0] == 2 else viter179)
+            for kiter187, viter188 in self.carrier.items():
+                oprot.writeString(kiter187.encode('utf-8') if sys.version_info[0] == 2 else kiter187)
+                oprot.writeString(viter188.encode('utf-8') if sys.version_info[0] == 2 else viter188)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -365,11 +365,11 @@ class ReadHomeTimeline_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype183, _size180) = iprot.readListBegin()
-                    for _i184 in range(_size180):
-                        _elem185 = Post()
-                        _elem185.read(iprot)
-                        self.success.append(_elem185)
+                    (_etype192, _size189) = iprot.readListBegin()
+                    for _i193 in range(_size189):
+                        _elem194 = Post()
+                        _elem194.read(iprot)
+                        self.success.append(_elem194)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -391,8 +391,8 @@ class ReadHomeTimeline_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter186 in self.success:
-                iter186.write(oprot)
+            for iter195 in self.success:
+                iter195.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
@@ -475,21 +475,21 @@ class WriteHomeTimeline_args(object):
             elif fid == 5:
                 if ftype == TType.LIST:
                     self.user_mentions_id = []
-                    (_etype190, _size187) = iprot.readListBegin()
-                    for _i191 in range(_size187):
-                        _elem192 = iprot.readI64()
-                        self.user_mentions_id.append(_elem192)
+                    (_etype199, _size196) = iprot.readListBegin()
+                    for _i200 in range(_size196):
+                        _elem201 = iprot.readI64()
+                        self.user_mentions_id.append(_elem201)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 6:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype194, _vtype195, _size193) = iprot.readMapBegin()
-                    for _i197 in range(_size193):
-                        _key198 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val199 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key198] = _val199
+                    (_ktype203, _vtype204, _size202) = iprot.readMapBegin()
+                    for _i206 in range(_size202):
+                        _key207 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val208 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key207] = _val208
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -522,16 +522,16 @@ class WriteHomeTimeline_args(object):
         if self.user_mentions_id is not None:
             oprot.writeFieldBegin('user_mentions_id', TType.LIST, 5)
             oprot.writeListBegin(TType.I64, len(self.user_mentions_id))
-            for iter200 in self.user_mentions_id:
-                oprot.writeI64(iter200)
+            for iter209 in self.user_mentions_id:
+                oprot.writeI64(iter209)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 6)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter201, viter202 in self.carrier.items():
-                oprot.writeString(kiter201.encode('utf-8') if sys.version_info[0] == 2 else kiter201)
-                oprot.writeString(viter202.encode('utf-8') if sys.version_info[0] == 2 else viter202)
+            for kiter210, viter211 in self.carrier.items():
+                oprot.writeString(kiter210.encode('utf-8') if sys.version_info[0] == 2 else kiter210)
+                oprot.writeString(viter211.encode('utf-8') if sys.version_info[0] == 2 else viter211)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
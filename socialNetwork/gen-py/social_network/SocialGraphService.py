@@ -93,6 +93,39 @@ class Iface(object):
         """
         pass
 
+    def GetFollowersPage(self, req_id, user_id, cursor, limit, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - cursor
+         - limit
+         - carrier
+
+        """
+        pass
+
+    def GetFollowerCount(self, req_id, user_id, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - carrier
+
+        """
+        pass
+
+    def GetHighFanoutFollowees(self, req_id, user_id, min_followers, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - min_followers
+         - carrier
+
+        """
+        pass
+
 
 class Client(Iface):
     def __init__(self, iprot, oprot=None):
@@ -365,6 +398,126 @@ class Client(Iface):
             raise result.se
         return
 
+    def GetFollowersPage(self, req_id, user_id, cursor, limit, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - cursor
+         - limit
+         - carrier
+
+        """
+        self.send_GetFollowersPage(req_id, user_id, cursor, limit, carrier)
+        return self.recv_GetFollowersPage()
+
+    def send_GetFollowersPage(self, req_id, user_id, cursor, limit, carrier):
+        self._oprot.writeMessageBegin('GetFollowersPage', TMessageType.CALL, self._seqid)
+        args = GetFollowersPage_args()
+        args.req_id = req_id
+        args.user_id = user_id
+        args.cursor = cursor
+        args.limit = limit
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_GetFollowersPage(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = GetFollowersPage_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "GetFollowersPage failed: unknown result")
+
+    def GetFollowerCount(self, req_id, user_id, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - carrier
+
+        """
+        self.send_GetFollowerCount(req_id, user_id, carrier)
+        return self.recv_GetFollowerCount()
+
+    def send_GetFollowerCount(self, req_id, user_id, carrier):
+        self._oprot.writeMessageBegin('GetFollowerCount', TMessageType.CALL, self._seqid)
+        args = GetFollowerCount_args()
+        args.req_id = req_id
+        args.user_id = user_id
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_GetFollowerCount(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = GetFollowerCount_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "GetFollowerCount failed: unknown result")
+
+    def GetHighFanoutFollowees(self, req_id, user_id, min_followers, carrier):
+        """
+        Parameters:
+         - req_id
+         - user_id
+         - min_followers
+         - carrier
+
+        """
+        self.send_GetHighFanoutFollowees(req_id, user_id, min_followers, carrier)
+        return self.recv_GetHighFanoutFollowees()
+
+    def send_GetHighFanoutFollowees(self, req_id, user_id, min_followers, carrier):
+        self._oprot.writeMessageBegin('GetHighFanoutFollowees', TMessageType.CALL, self._seqid)
+        args = GetHighFanoutFollowees_args()
+        args.req_id = req_id
+        args.user_id = user_id
+        args.min_followers = min_followers
+        args.carrier = carrier
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_GetHighFanoutFollowees(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = GetHighFanoutFollowees_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.se is not None:
+            raise result.se
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "GetHighFanoutFollowees failed: unknown result")
+
 
 class Processor(Iface, TProcessor):
     def __init__(self, handler):
@@ -377,6 +530,9 @@ class Processor(Iface, TProcessor):
         self._processMap["FollowWithUsername"] = Processor.process_FollowWithUsername
         self._processMap["UnfollowWithUsername"] = Processor.process_UnfollowWithUsername
         self._processMap["InsertUser"] = Processor.process_InsertUser
+        self._processMap["GetFollowersPage"] = Processor.process_GetFollowersPage
+        self._processMap["GetFollowerCount"] = Processor.process_GetFollowerCount
+        self._processMap["GetHighFanoutFollowees"] = Processor.process_GetHighFanoutFollowees
         self._on_message_begin = None
 
     def on_message_begin(self, func):
@@ -581,6 +737,84 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_GetFollowersPage(self, seqid, iprot, oprot):
+        args = GetFollowersPage_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetFollowersPage_result()
+        try:
+            result.success = self._handler.GetFollowersPage(args.req_id, args.user_id, args.cursor, args.limit, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetFollowersPage", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_GetFollowerCount(self, seqid, iprot, oprot):
+        args = GetFollowerCount_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetFollowerCount_result()
+        try:
+            result.success = self._handler.GetFollowerCount(args.req_id, args.user_id, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetFollowerCount", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_GetHighFanoutFollowees(self, seqid, iprot, oprot):
+        args = GetHighFanoutFollowees_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = GetHighFanoutFollowees_result()
+        try:
+            result.success = self._handler.GetHighFanoutFollowees(args.req_id, args.user_id, args.min_followers, args.carrier)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except ServiceException as se:
+            msg_type = TMessageType.REPLY
+            result.se = se
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("GetHighFanoutFollowees", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
 # HELPER FUNCTIONS AND STRUCTURES
 
 
@@ -621,11 +855,11 @@ class GetFollowers_args(object):
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype229, _vtype230, _size228) = iprot.readMapBegin()
-                    for _i232 in range(_size228):
-                        _key233 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val234 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key233] = _val234
+                    (_ktype256, _vtype257, _size255) = iprot.readMapBegin()
+                    for _i259 in range(_size255):
+                        _key260 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val261 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key260] = _val261
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -650,9 +884,9 @@ class GetFollowers_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter235, viter236 in self.carrier.items():
-                oprot.writeString(kiter235.encode('utf-8') if sys.version_info[0] == 2 else kiter235)
-                oprot.writeString(viter236.encode('utf-8') if sys.version_info[0] == 2 else viter236)
+            for kiter262, viter263 in self.carrier.items():
+                oprot.writeString(kiter262.encode('utf-8') if sys.version_info[0] == 2 else kiter262)
+                oprot.writeString(viter263.encode('utf-8') if sys.version_info[0] == 2 else viter263)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -705,10 +939,10 @@ class GetFollowers_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype240, _size237) = iprot.readListBegin()
-                    for _i241 in range(_size237):
-                        _elem242 = iprot.readI64()
-                        self.success.append(_elem242)
+                    (_etype267, _size264) = iprot.readListBegin()
+                    for _i268 in range(_size264):
+                        _elem269 = iprot.readI64()
+                        self.success.append(_elem269)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -730,8 +964,8 @@ class GetFollowers_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.I64, len(self.success))
-            for iter243 in self.success:
-                oprot.writeI64(iter243)
+            for iter270 in self.success:
+                oprot.writeI64(iter270)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
@@ -798,11 +1032,11 @@ class GetFollowees_args(object):
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype245, _vtype246, _size244) = iprot.readMapBegin()
-                    for _i248 in range(_size244):
-                        _key249 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val250 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key249] = _val250
+                    (_ktype272, _vtype273, _size271) = iprot.readMapBegin()
+                    for _i275 in range(_size271):
+                        _key276 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val277 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key276] = _val277
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -827,9 +1061,9 @@ class GetFollowees_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter251, viter252 in self.carrier.items():
-                oprot.writeString(kiter251.encode('utf-8') if sys.version_info[0] == 2 else kiter251)
-                oprot.writeString(viter252.encode('utf-8') if sys.version_info[0] == 2 else viter252)
+            for kiter278, viter279 in self.carrier.items():
+                oprot.writeString(kiter278.encode('utf-8') if sys.version_info[0] == 2 else kiter278)
+                oprot.writeString(viter279.encode('utf-8') if sys.version_info[0] == 2 else viter279)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -882,10 +1116,10 @@ class GetFollowees_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype256, _size253) = iprot.readListBegin()
-                    for _i257 in range(_size253):
-                        _elem258 = iprot.readI64()
-                        self.success.append(_elem258)
+                    (_etype283, _size280) = iprot.readListBegin()
+                    for _i284 in range(_size280):
+                        _elem285 = iprot.readI64()
+                        self.success.append(_elem285)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -907,8 +1141,8 @@ class GetFollowees_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.I64, len(self.success))
-            for iter259 in self.success:
-                oprot.writeI64(iter259)
+            for iter286 in self.success:
+                oprot.writeI64(iter286)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.se is not None:
@@ -982,11 +1216,11 @@ class Follow_args(object):
             elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype261, _vtype262, _size260) = iprot.readMapBegin()
-                    for _i264 in range(_size260):
-                        _key265 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val266 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key265] = _val266
+                    (_ktype288, _vtype289, _size287) = iprot.readMapBegin()
+                    for _i291 in range(_size287):
+                        _key292 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val293 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key292] = _val293
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1015,9 +1249,9 @@ class Follow_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter267, viter268 in self.carrier.items():
-                oprot.writeString(kiter267.encode('utf-8') if sys.version_info[0] == 2 else kiter267)
-                oprot.writeString(viter268.encode('utf-8') if sys.version_info[0] == 2 else viter268)
+            for kiter294, viter295 in self.carrier.items():
+                oprot.writeString(kiter294.encode('utf-8') if sys.version_info[0] == 2 else kiter294)
+                oprot.writeString(viter295.encode('utf-8') if sys.version_info[0] == 2 else viter295)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1152,11 +1386,11 @@ class Unfollow_args(object):
             elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype270, _vtype271, _size269) = iprot.readMapBegin()
-                    for _i273 in range(_size269):
-                        _key274 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val275 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key274] = _val275
+                    (_ktype297, _vtype298, _size296) = iprot.readMapBegin()
+                    for _i300 in range(_size296):
+                        _key301 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val302 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key301] = _val302
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1185,9 +1419,9 @@ class Unfollow_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter276, viter277 in self.carrier.items():
-                oprot.writeString(kiter276.encode('utf-8') if sys.version_info[0] == 2 else kiter276)
-                oprot.writeString(viter277.encode('utf-8') if sys.version_info[0] == 2 else viter277)
+            for kiter303, viter304 in self.carrier.items():
+                oprot.writeString(kiter303.encode('utf-8') if sys.version_info[0] == 2 else kiter303)
+                oprot.writeString(viter304.encode('utf-8') if sys.version_info[0] == 2 else viter304)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1322,11 +1556,11 @@ class FollowWithUsername_args(object):
             elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype279, _vtype280, _size278) = iprot.readMapBegin()
-                    for _i282 in range(_size278):
-                        _key283 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val284 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key283] = _val284
+                    (_ktype306, _vtype307, _size305) = iprot.readMapBegin()
+                    for _i309 in range(_size305):
+                        _key310 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val311 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key310] = _val311
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1355,9 +1589,9 @@ class FollowWithUsername_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter285, viter286 in self.carrier.items():
-                oprot.writeString(kiter285.encode('utf-8') if sys.version_info[0] == 2 else kiter285)
-                oprot.writeString(viter286.encode('utf-8') if sys.version_info[0] == 2 else viter286)
+            for kiter312, viter313 in self.carrier.items():
+                oprot.writeString(kiter312.encode('utf-8') if sys.version_info[0] == 2 else kiter312)
+                oprot.writeString(viter313.encode('utf-8') if sys.version_info[0] == 2 else viter313)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1492,11 +1726,11 @@ class UnfollowWithUsername_args(object):
             elif fid == 4:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype288, _vtype289, _size287) = iprot.readMapBegin()
-                    for _i291 in range(_size287):
-                        _key292 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val293 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key292] = _val293
+                    (_ktype315, _vtype316, _size314) = iprot.readMapBegin()
+                    for _i318 in range(_size314):
+                        _key319 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val320 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key319] = _val320
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1525,9 +1759,9 @@ class UnfollowWithUsername_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter294, viter295 in self.carrier.items():
-                oprot.writeString(kiter294.encode('utf-8') if sys.version_info[0] == 2 else kiter294)
-                oprot.writeString(viter295.encode('utf-8') if sys.version_info[0] == 2 else viter295)
+            for kiter321, viter322 in self.carrier.items():
+                oprot.writeString(kiter321.encode('utf-8') if sys.version_info[0] == 2 else kiter321)
+                oprot.writeString(viter322.encode('utf-8') if sys.version_info[0] == 2 else viter322)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1655,11 +1889,11 @@ class InsertUser_args(object):
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.carrier = {}
-                    (_ktype297, _vtype298, _size296) = iprot.readMapBegin()
-                    for _i300 in range(_size296):
-                        _key301 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        _val302 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.carrier[_key301] = _val302
+                    (_ktype324, _vtype325, _size323) = iprot.readMapBegin()
+                    for _i327 in range(_size323):
+                        _key328 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val329 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key328] = _val329
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -1684,9 +1918,9 @@ class InsertUser_args(object):
         if self.carrier is not None:
             oprot.writeFieldBegin('carrier', TType.MAP, 3)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
-            for kiter303, viter304 in self.carrier.items():
-                oprot.writeString(kiter303.encode('utf-8') if sys.version_info[0] == 2 else kiter303)
-                oprot.writeString(viter304.encode('utf-8') if sys.version_info[0] == 2 else viter304)
+            for kiter330, viter331 in self.carrier.items():
+                oprot.writeString(kiter330.encode('utf-8') if sys.version_info[0] == 2 else kiter330)
+                oprot.writeString(viter331.encode('utf-8') if sys.version_info[0] == 2 else viter331)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -1774,5 +2008,564 @@ InsertUser_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
 )
+
+
+class GetFollowersPage_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_id
+     - cursor
+     - limit
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_id=None, cursor=None, limit=None, carrier=None,):
+        self.req_id = req_id
+        self.user_id = user_id
+        self.cursor = cursor
+        self.limit = limit
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.cursor = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.limit = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype333, _vtype334, _size332) = iprot.readMapBegin()
+                    for _i336 in range(_size332):
+                        _key337 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val338 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key337] = _val338
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetFollowersPage_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.cursor is not None:
+            oprot.writeFieldBegin('cursor', TType.I64, 3)
+            oprot.writeI64(self.cursor)
+            oprot.writeFieldEnd()
+        if self.limit is not None:
+            oprot.writeFieldBegin('limit', TType.I32, 4)
+            oprot.writeI32(self.limit)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 5)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter339, viter340 in self.carrier.items():
+                oprot.writeString(kiter339.encode('utf-8') if sys.version_info[0] == 2 else kiter339)
+                oprot.writeString(viter340.encode('utf-8') if sys.version_info[0] == 2 else viter340)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetFollowersPage_args)
+GetFollowersPage_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.I64, 'cursor', None, None, ),  # 3
+    (4, TType.I32, 'limit', None, None, ),  # 4
+    (5, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 5
+)
+
+
+class GetFollowersPage_result(object):
+    """
+    Attributes:
+     - success
+     - se
+
+    """
+
+
+    def __init__(self, success=None, se=None,):
+        self.success = success
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype344, _size341) = iprot.readListBegin()
+                    for _i345 in range(_size341):
+                        _elem346 = iprot.readI64()
+                        self.success.append(_elem346)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetFollowersPage_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.I64, len(self.success))
+            for iter347 in self.success:
+                oprot.writeI64(iter347)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetFollowersPage_result)
+GetFollowersPage_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.I64, None, False), None, ),  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class GetFollowerCount_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_id
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_id=None, carrier=None,):
+        self.req_id = req_id
+        self.user_id = user_id
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype349, _vtype350, _size348) = iprot.readMapBegin()
+                    for _i352 in range(_size348):
+                        _key353 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val354 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key353] = _val354
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetFollowerCount_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 3)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter355, viter356 in self.carrier.items():
+                oprot.writeString(kiter355.encode('utf-8') if sys.version_info[0] == 2 else kiter355)
+                oprot.writeString(viter356.encode('utf-8') if sys.version_info[0] == 2 else viter356)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetFollowerCount_args)
+GetFollowerCount_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 3
+)
+
+
+class GetFollowerCount_result(object):
+    """
+    Attributes:
+     - success
+     - se
+
+    """
+
+
+    def __init__(self, success=None, se=None,):
+        self.success = success
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.I64:
+                    self.success = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetFollowerCount_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.I64, 0)
+            oprot.writeI64(self.success)
+            oprot.writeFieldEnd()
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetFollowerCount_result)
+GetFollowerCount_result.thrift_spec = (
+    (0, TType.I64, 'success', None, None, ),  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
+
+
+class GetHighFanoutFollowees_args(object):
+    """
+    Attributes:
+     - req_id
+     - user_id
+     - min_followers
+     - carrier
+
+    """
+
+
+    def __init__(self, req_id=None, user_id=None, min_followers=None, carrier=None,):
+        self.req_id = req_id
+        self.user_id = user_id
+        self.min_followers = min_followers
+        self.carrier = carrier
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.req_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.user_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.min_followers = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.MAP:
+                    self.carrier = {}
+                    (_ktype358, _vtype359, _size357) = iprot.readMapBegin()
+                    for _i361 in range(_size357):
+                        _key362 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        _val363 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.carrier[_key362] = _val363
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetHighFanoutFollowees_args')
+        if self.req_id is not None:
+            oprot.writeFieldBegin('req_id', TType.I64, 1)
+            oprot.writeI64(self.req_id)
+            oprot.writeFieldEnd()
+        if self.user_id is not None:
+            oprot.writeFieldBegin('user_id', TType.I64, 2)
+            oprot.writeI64(self.user_id)
+            oprot.writeFieldEnd()
+        if self.min_followers is not None:
+            oprot.writeFieldBegin('min_followers', TType.I64, 3)
+            oprot.writeI64(self.min_followers)
+            oprot.writeFieldEnd()
+        if self.carrier is not None:
+            oprot.writeFieldBegin('carrier', TType.MAP, 4)
+            oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.carrier))
+            for kiter364, viter365 in self.carrier.items():
+                oprot.writeString(kiter364.encode('utf-8') if sys.version_info[0] == 2 else kiter364)
+                oprot.writeString(viter365.encode('utf-8') if sys.version_info[0] == 2 else viter365)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetHighFanoutFollowees_args)
+GetHighFanoutFollowees_args.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'req_id', None, None, ),  # 1
+    (2, TType.I64, 'user_id', None, None, ),  # 2
+    (3, TType.I64, 'min_followers', None, None, ),  # 3
+    (4, TType.MAP, 'carrier', (TType.STRING, 'UTF8', TType.STRING, 'UTF8', False), None, ),  # 4
+)
+
+
+class GetHighFanoutFollowees_result(object):
+    """
+    Attributes:
+     - success
+     - se
+
+    """
+
+
+    def __init__(self, success=None, se=None,):
+        self.success = success
+        self.se = se
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype369, _size366) = iprot.readListBegin()
+                    for _i370 in range(_size366):
+                        _elem371 = iprot.readI64()
+                        self.success.append(_elem371)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.se = ServiceException.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('GetHighFanoutFollowees_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.I64, len(self.success))
+            for iter372 in self.success:
+                oprot.writeI64(iter372)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.se is not None:
+            oprot.writeFieldBegin('se', TType.STRUCT, 1)
+            self.se.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(GetHighFanoutFollowees_result)
+GetHighFanoutFollowees_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.I64, None, False), None, ),  # 0
+    (1, TType.STRUCT, 'se', [ServiceException, None], None, ),  # 1
+)
 fix_spec(all_structs)
 del all_structs
@@ -0,0 +1,27 @@
+#! /bin/bash
+# Regenerates gen-cpp, gen-py and gen-lua from social_network.thrift. Run it
+# after every IDL change and commit the output as is.
+#
+# Uses a local thrift if it is the version the bindings were generated with,
+# otherwise the one in the image the services are built on.
+
+set -e
+
+THRIFT_VERSION=0.12.0
+DEPS_IMAGE=yg397/thrift-microservice-deps:xenial
+
+cd "$(dirname "$0")/.."
+
+if command -v thrift > /dev/null &&
+    thrift --version | grep -q "$THRIFT_VERSION"; then
+  thrift_cmd=(thrift)
+elif command -v docker > /dev/null; then
+  thrift_cmd=(docker run --rm -u "$(id -u):$(id -g)" -v "$PWD:/src" -w /src
+              "$DEPS_IMAGE" thrift)
+else
+  echo "Needs thrift $THRIFT_VERSION or docker" >&2
+  exit 1
+fi
+
+rm -rf gen-cpp gen-py gen-lua
+"${thrift_cmd[@]}" --gen cpp --gen py --gen lua -o . social_network.thrift
@@ -78,6 +78,14 @@ service UniqueIdService {
       2: PostType post_type,
       3: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  // Leases count consecutive IDs and returns the first; the others are
+  // first + 1 .. first + count - 1.
+  i64 ComposeUniqueIds (
+      1: i64 req_id,
+      2: i32 count,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service TextService {
@@ -203,6 +211,14 @@ service UserTimelineService {
     4: i32 stop,
     5: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  map<i64, i64> ReadUserTimelineEntries(
+    1: i64 req_id,
+    2: i64 user_id,
+    3: i32 start,
+    4: i32 stop,
+    5: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service SocialGraphService{
@@ -251,6 +267,27 @@ service SocialGraphService{
       2: i64 user_id,
       3: map<string, string> carrier
   ) throws (1: ServiceException se)
+
+  list<i64> GetFollowersPage(
+      1: i64 req_id,
+      2: i64 user_id,
+      3: i64 cursor,
+      4: i32 limit,
+      5: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  i64 GetFollowerCount(
+      1: i64 req_id,
+      2: i64 user_id,
+      3: map<string, string> carrier
+  ) throws (1: ServiceException se)
+
+  list<i64> GetHighFanoutFollowees(
+      1: i64 req_id,
+      2: i64 user_id,
+      3: i64 min_followers,
+      4: map<string, string> carrier
+  ) throws (1: ServiceException se)
 }
 
 service UserMentionService {
@@ -2,6 +2,8 @@
 #define SOCIAL_NETWORK_MICROSERVICES_SRC_AMQPLIBEVENTHANDLER_H_
 
 #include <functional>
+#include <memory>
+#include <vector>
 #include <unistd.h>
 #include <amqpcpp.h>
 #include <event2/event.h>
@@ -56,10 +58,36 @@ class AmqpLibeventHandler {
     return is_running_;
   }
 
+  // Runs callback on the event loop thread every interval_ms, so it may use
+  // the connection and channels of this handler.
+  void SetTimer(int interval_ms, std::function<void()> callback)
+  {
+    auto callback_ptr = std::make_unique<std::function<void()>>(
+        std::move(callback));
+    EventPtrT timer(event_new(evbase_.get(), -1, EV_PERSIST, OnTimer,
+                              callback_ptr.get()),
+                    event_free);
+    struct timeval interval;
+    interval.tv_sec = interval_ms / 1000;
+    interval.tv_usec = (interval_ms % 1000) * 1000;
+    evtimer_add(timer.get(), &interval);
+    timers_.emplace_back(std::move(timer));
+    timer_callbacks_.emplace_back(std::move(callback_ptr));
+  }
+
  private:
+  static void OnTimer(evutil_socket_t, short, void *arg)
+  {
+    (*static_cast<std::function<void()> *>(arg))();
+  }
+
   EventBasePtrT evbase_;
   LibEventHandler evhandler_;
   bool is_running_;
+  std::vector<std::unique_ptr<std::function<void()>>> timer_callbacks_;
+  // Declared last so the timers are freed before their callbacks and the
+  // event base.
+  std::vector<EventPtrT> timers_;
 
 };
 
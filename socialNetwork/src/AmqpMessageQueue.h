@@ -0,0 +1,86 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_AMQPMESSAGEQUEUE_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_AMQPMESSAGEQUEUE_H_
+
+#include <functional>
+#include <string>
+
+#include "AmqpLibeventHandler.h"
+#include "MessageQueue.h"
+#include "logger.h"
+
+namespace social_network {
+
+// Consumes a durable RabbitMQ queue over its own connection and channel, on
+// an AmqpLibeventHandler event loop.
+class AmqpMessageQueueConsumer : public MessageQueueConsumer {
+ public:
+  AmqpMessageQueueConsumer(const std::string &addr, int port,
+                           const std::string &queue, int prefetch);
+
+  void Ack(uint64_t tag, bool multiple) override;
+  void Reject(uint64_t tag, bool multiple, bool requeue) override;
+  void SetTimer(int interval_ms, std::function<void()> callback) override;
+  void Run(MessageCallback callback) override;
+  void Stop() override;
+
+ private:
+  std::string _queue;
+  AmqpLibeventHandler _handler;
+  AMQP::TcpConnection _connection;
+  AMQP::TcpChannel _channel;
+};
+
+AmqpMessageQueueConsumer::AmqpMessageQueueConsumer(const std::string &addr,
+                                                   int port,
+                                                   const std::string &queue,
+                                                   int prefetch)
+    : _queue(queue),
+      _connection(_handler, AMQP::Address(addr, port,
+                                          AMQP::Login("guest", "guest"), "/")),
+      _channel(&_connection) {
+  _channel.onError([this](const char *message) {
+    LOG(error) << "Channel error: " << message;
+    _handler.Stop();
+  });
+  _channel.setQos(prefetch);
+  _channel.declareQueue(_queue, AMQP::durable)
+      .onSuccess([](const std::string &name, uint32_t messagecount,
+                    uint32_t consumercount) {
+        LOG(debug) << "Created queue: " << name;
+      });
+  _handler.SetTimer(30000, [this]() {
+    LOG(debug) << "Heartbeat sent";
+    _connection.heartbeat();
+  });
+}
+
+void AmqpMessageQueueConsumer::Ack(uint64_t tag, bool multiple) {
+  _channel.ack(tag, multiple ? AMQP::multiple : 0);
+}
+
+void AmqpMessageQueueConsumer::Reject(uint64_t tag, bool multiple,
+                                      bool requeue) {
+  _channel.reject(tag, (multiple ? AMQP::multiple : 0) |
+                           (requeue ? AMQP::requeue : 0));
+}
+
+void AmqpMessageQueueConsumer::SetTimer(int interval_ms,
+                                        std::function<void()> callback) {
+  _handler.SetTimer(interval_ms, std::move(callback));
+}
+
+void AmqpMessageQueueConsumer::Run(MessageCallback callback) {
+  _channel.consume(_queue).onReceived(
+      [callback](const AMQP::Message &msg, uint64_t tag, bool redelivered) {
+        callback(msg.body(), msg.bodySize(), tag);
+      });
+  _handler.Start();
+  LOG(debug) << "Closing connection.";
+  _connection.close();
+}
+
+void AmqpMessageQueueConsumer::Stop() { _handler.Stop(); }
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_AMQPMESSAGEQUEUE_H_
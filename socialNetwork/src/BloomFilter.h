@@ -0,0 +1,101 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_BLOOMFILTER_H
+#define SOCIAL_NETWORK_MICROSERVICES_BLOOMFILTER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace social_network {
+
+/*
+ * Set of strings that may report false positives but never false negatives.
+ * Bits are set with atomic fetch_or, so Add and MightContain can run from
+ * any number of threads without a lock. Nothing can be removed.
+ *
+ * The num_hashes probes are derived from one std::hash by double hashing
+ * (Kirsch and Mitzenmacher), and mapped onto the bits with a multiply
+ * instead of a modulo.
+ */
+class BloomFilter {
+ public:
+  // Sized for expected_items at the given false positive rate.
+  BloomFilter(size_t expected_items, double false_positive_rate);
+
+  BloomFilter(const BloomFilter &) = delete;
+  BloomFilter &operator=(const BloomFilter &) = delete;
+
+  void Add(const std::string &key);
+  bool MightContain(const std::string &key) const;
+
+  size_t NumBits() const { return _num_bits; }
+  int NumHashes() const { return _num_hashes; }
+
+ private:
+  std::unique_ptr<std::atomic<uint64_t>[]> _words;
+  size_t _num_bits;
+  int _num_hashes;
+
+  size_t _Bit(uint64_t h1, uint64_t h2, int i) const;
+  static void _Hash(const std::string &key, uint64_t *h1, uint64_t *h2);
+};
+
+BloomFilter::BloomFilter(size_t expected_items, double false_positive_rate) {
+  expected_items = std::max<size_t>(expected_items, 1);
+  false_positive_rate = std::min(std::max(false_positive_rate, 1e-9), 0.5);
+  double ln2 = std::log(2.0);
+  double bits = -double(expected_items) * std::log(false_positive_rate) /
+                (ln2 * ln2);
+  size_t num_words = std::max<size_t>((size_t(bits) + 63) / 64, 1);
+  _num_bits = num_words * 64;
+  _num_hashes = std::max(
+      1, int(std::round(double(_num_bits) / expected_items * ln2)));
+  _words.reset(new std::atomic<uint64_t>[num_words]);
+  for (size_t i = 0; i < num_words; ++i) {
+    _words[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void BloomFilter::Add(const std::string &key) {
+  uint64_t h1, h2;
+  _Hash(key, &h1, &h2);
+  for (int i = 0; i < _num_hashes; ++i) {
+    size_t bit = _Bit(h1, h2, i);
+    _words[bit / 64].fetch_or(uint64_t(1) << (bit % 64),
+                              std::memory_order_relaxed);
+  }
+}
+
+bool BloomFilter::MightContain(const std::string &key) const {
+  uint64_t h1, h2;
+  _Hash(key, &h1, &h2);
+  for (int i = 0; i < _num_hashes; ++i) {
+    size_t bit = _Bit(h1, h2, i);
+    if (!(_words[bit / 64].load(std::memory_order_relaxed) &
+          (uint64_t(1) << (bit % 64)))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t BloomFilter::_Bit(uint64_t h1, uint64_t h2, int i) const {
+  uint64_t h = h1 + uint64_t(i) * h2;
+  return size_t((static_cast<__uint128_t>(h) * _num_bits) >> 64);
+}
+
+void BloomFilter::_Hash(const std::string &key, uint64_t *h1, uint64_t *h2) {
+  *h1 = std::hash<std::string>()(key);
+  // splitmix64 finalizer, so h2 is not a linear function of h1.
+  uint64_t z = *h1 + 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  *h2 = (z ^ (z >> 31)) | 1;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_BLOOMFILTER_H
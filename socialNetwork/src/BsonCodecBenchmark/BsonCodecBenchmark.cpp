@@ -0,0 +1,207 @@
+// Compares the old ways of reading MongoDB documents in the services with
+// the single-pass decoders from bson_codec.h:
+//  - a social graph entry with a large "followers" array, read with
+//    bson_iter_find_descendant("followers.N.user_id") per element;
+//  - a stored post, rendered with bson_as_json and parsed back.
+//
+// Usage: BsonCodecBenchmark [iterations] [followers]
+
+#include <bson/bson.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../PostStorageService/PostCacheCodec.h"
+#include "../bson_codec.h"
+
+using namespace social_network;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+bson_t *MakeSocialGraphEntry(int followers) {
+  bson_t *doc = bson_new();
+  BSON_APPEND_INT64(doc, "user_id", 1234);
+  bson_t array;
+  BSON_APPEND_ARRAY_BEGIN(doc, "followers", &array);
+  for (int i = 0; i < followers; ++i) {
+    const char *key;
+    char buf[16];
+    bson_uint32_to_string(i, &key, buf, sizeof(buf));
+    bson_t follower;
+    BSON_APPEND_DOCUMENT_BEGIN(&array, key, &follower);
+    BSON_APPEND_INT64(&follower, "user_id", 100000 + i);
+    BSON_APPEND_INT64(&follower, "timestamp", 1603412345678 + i);
+    bson_append_document_end(&array, &follower);
+  }
+  bson_append_array_end(doc, &array);
+  return doc;
+}
+
+bson_t *MakePost() {
+  bson_t *doc = bson_new();
+  bson_oid_t oid;
+  bson_oid_init(&oid, nullptr);
+  BSON_APPEND_OID(doc, "_id", &oid);
+  BSON_APPEND_INT64(doc, "post_id", 4611686018427387904);
+  BSON_APPEND_INT64(doc, "timestamp", 1603412345678);
+  BSON_APPEND_UTF8(doc, "text", std::string(256, 'x').c_str());
+  BSON_APPEND_INT64(doc, "req_id", 8106395120138412983);
+  BSON_APPEND_INT32(doc, "post_type", PostType::POST);
+  bson_t creator;
+  BSON_APPEND_DOCUMENT_BEGIN(doc, "creator", &creator);
+  BSON_APPEND_INT64(&creator, "user_id", 1234);
+  BSON_APPEND_UTF8(&creator, "username", "username_1234");
+  bson_append_document_end(doc, &creator);
+
+  bson_t urls, user_mentions, media;
+  BSON_APPEND_ARRAY_BEGIN(doc, "urls", &urls);
+  for (int i = 0; i < 2; ++i) {
+    const char *key;
+    char buf[16];
+    bson_uint32_to_string(i, &key, buf, sizeof(buf));
+    bson_t url;
+    BSON_APPEND_DOCUMENT_BEGIN(&urls, key, &url);
+    BSON_APPEND_UTF8(&url, "shortened_url",
+                     ("http://short-url/abcdefghi" + std::to_string(i)).c_str());
+    BSON_APPEND_UTF8(
+        &url, "expanded_url",
+        ("http://www.example.com/some/long/path/" + std::to_string(i)).c_str());
+    bson_append_document_end(&urls, &url);
+  }
+  bson_append_array_end(doc, &urls);
+  BSON_APPEND_ARRAY_BEGIN(doc, "user_mentions", &user_mentions);
+  for (int i = 0; i < 2; ++i) {
+    const char *key;
+    char buf[16];
+    bson_uint32_to_string(i, &key, buf, sizeof(buf));
+    bson_t user_mention;
+    BSON_APPEND_DOCUMENT_BEGIN(&user_mentions, key, &user_mention);
+    BSON_APPEND_INT64(&user_mention, "user_id", 100 + i);
+    BSON_APPEND_UTF8(&user_mention, "username",
+                     ("username_" + std::to_string(100 + i)).c_str());
+    bson_append_document_end(&user_mentions, &user_mention);
+  }
+  bson_append_array_end(doc, &user_mentions);
+  BSON_APPEND_ARRAY_BEGIN(doc, "media", &media);
+  for (int i = 0; i < 2; ++i) {
+    const char *key;
+    char buf[16];
+    bson_uint32_to_string(i, &key, buf, sizeof(buf));
+    bson_t item;
+    BSON_APPEND_DOCUMENT_BEGIN(&media, key, &item);
+    BSON_APPEND_INT64(&item, "media_id", 5000 + i);
+    BSON_APPEND_UTF8(&item, "media_type", "png");
+    bson_append_document_end(&media, &item);
+  }
+  bson_append_array_end(doc, &media);
+  return doc;
+}
+
+// The loop SocialGraphHandler::GetFollowers used before bson_codec.h.
+void FindDescendantFollowers(const bson_t *doc,
+                             std::vector<std::pair<int64_t, int64_t>> *out) {
+  bson_iter_t iter_0;
+  bson_iter_t iter_1;
+  bson_iter_t user_id_child;
+  bson_iter_t timestamp_child;
+  int index = 0;
+  bson_iter_init(&iter_0, doc);
+  bson_iter_init(&iter_1, doc);
+  while (bson_iter_find_descendant(
+             &iter_0,
+             ("followers." + std::to_string(index) + ".user_id").c_str(),
+             &user_id_child) &&
+         BSON_ITER_HOLDS_INT64(&user_id_child) &&
+         bson_iter_find_descendant(
+             &iter_1,
+             ("followers." + std::to_string(index) + ".timestamp").c_str(),
+             &timestamp_child) &&
+         BSON_ITER_HOLDS_INT64(&timestamp_child)) {
+    out->emplace_back(bson_iter_int64(&user_id_child),
+                      bson_iter_int64(&timestamp_child));
+    bson_iter_init(&iter_0, doc);
+    bson_iter_init(&iter_1, doc);
+    index++;
+  }
+}
+
+// The decoding PostStorageHandler used before bson_codec.h.
+void JsonDecodePost(const bson_t *doc, Post *post) {
+  auto post_json_char = bson_as_json(doc, nullptr);
+  json post_json = json::parse(post_json_char);
+  bson_free(post_json_char);
+  post_from_json(post_json, *post);
+}
+
+template <class Fn>
+double Time(int iterations, Fn fn) {
+  auto start = steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    fn();
+  }
+  auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start);
+  return double(elapsed.count()) / iterations;
+}
+
+int main(int argc, char *argv[]) {
+  int iterations = argc > 1 ? std::stoi(argv[1]) : 200;
+  int followers = argc > 2 ? std::stoi(argv[2]) : 1000;
+
+  bson_t *graph_doc = MakeSocialGraphEntry(followers);
+  bson_t *post_doc = MakePost();
+
+  std::vector<std::pair<int64_t, int64_t>> expected, decoded;
+  FindDescendantFollowers(graph_doc, &expected);
+  bson_decode_timestamped_ids(graph_doc, "followers", "user_id", &decoded);
+  if (expected != decoded || expected.size() != static_cast<size_t>(followers)) {
+    std::cerr << "Followers mismatch" << std::endl;
+    return 1;
+  }
+  Post expected_post, decoded_post;
+  JsonDecodePost(post_doc, &expected_post);
+  if (!bson_decode_post(post_doc, &decoded_post) ||
+      !(expected_post == decoded_post)) {
+    std::cerr << "Post mismatch" << std::endl;
+    return 1;
+  }
+
+  size_t sink = 0;
+  auto find_descendant_ns = Time(iterations, [&]() {
+    std::vector<std::pair<int64_t, int64_t>> out;
+    FindDescendantFollowers(graph_doc, &out);
+    sink += out.size();
+  });
+  auto single_pass_ns = Time(iterations, [&]() {
+    std::vector<std::pair<int64_t, int64_t>> out;
+    bson_decode_timestamped_ids(graph_doc, "followers", "user_id", &out);
+    sink += out.size();
+  });
+  int post_iterations = iterations * 1000;
+  auto json_post_ns = Time(post_iterations, [&]() {
+    Post post;
+    JsonDecodePost(post_doc, &post);
+    sink += post.text.size();
+  });
+  auto bson_post_ns = Time(post_iterations, [&]() {
+    Post post;
+    bson_decode_post(post_doc, &post);
+    sink += post.text.size();
+  });
+
+  std::cout << "iterations=" << iterations << " followers=" << followers
+            << " (" << sink << ")" << std::endl;
+  std::cout << "followers find_descendant: " << find_descendant_ns / 1000
+            << " us/doc, single pass: " << single_pass_ns / 1000 << " us/doc"
+            << std::endl;
+  std::cout << "post bson_as_json+parse: " << json_post_ns
+            << " ns/post, single pass: " << bson_post_ns << " ns/post"
+            << std::endl;
+
+  bson_destroy(graph_doc);
+  bson_destroy(post_doc);
+  return 0;
+}
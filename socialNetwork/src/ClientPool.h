@@ -1,19 +1,35 @@
 #ifndef SOCIAL_NETWORK_MICROSERVICES_CLIENTPOOL_H
 #define SOCIAL_NETWORK_MICROSERVICES_CLIENTPOOL_H
 
-#include <vector>
+#include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <condition_variable>
-#include <deque>
 #include <chrono>
 #include <string>
+#include <thread>
 #include <nlohmann/json.hpp>
 
+#include "MpmcQueue.h"
 #include "logger.h"
 
 namespace social_network {
 using json = nlohmann::json;
 
+struct ClientPoolStats {
+  uint64_t waits;
+  uint64_t timeouts;
+  uint64_t creations;
+  uint64_t evictions;
+};
+
+// Idle clients live in a lock-free free list, so Pop and Push on a non-empty
+// pool never take a lock. The mutex and condition variable are only used by
+// callers that have to wait for a client because the pool is at max size.
+// A maintenance thread connects clients up to min_size ahead of time, adds a
+// connected spare whenever Pop takes the last idle client, and evicts idle
+// clients that outlived keepalive_ms or lost their connection, so Pop only
+// connects when a burst outruns it.
 template<class TClient>
 class ClientPool {
  public:
@@ -31,81 +47,111 @@ class ClientPool {
   void Push(TClient *);
   void Keepalive(TClient *);
   void Remove(TClient *);
+  ClientPoolStats GetStats() const;
 
  private:
-  std::deque<TClient *> _pool;
+  MpmcQueue<TClient *> _pool;
   std::string _addr;
   std::string _client_type;
   int _port;
   int _min_pool_size{};
   int _max_pool_size{};
-  int _curr_pool_size{};
+  std::atomic<int> _curr_pool_size{};
   int _timeout_ms;
   int _keepalive_ms;
   std::mutex _mtx;
   std::condition_variable _cv;
+  std::atomic<int> _waiters{};
   const json *_config_json;
 
+  std::atomic<uint64_t> _waits{};
+  std::atomic<uint64_t> _timeouts{};
+  std::atomic<uint64_t> _creations{};
+  std::atomic<uint64_t> _evictions{};
+
+  std::mutex _maintenance_mtx;
+  std::condition_variable _maintenance_cv;
+  bool _stopped{};
+  // Set by Pop when it took the last idle client.
+  std::atomic<bool> _spare_wanted{};
+  std::thread _maintenance_thread;
+
+  bool _Reserve();
+  void _Release();
+  void _NotifyWaiters();
+  bool _IsExpired(TClient *) const;
+  void _Maintain();
+  void _Run();
 };
 
 template<class TClient>
 ClientPool<TClient>::ClientPool(const std::string &client_type,
     const std::string &addr, int port, int min_pool_size,
     int max_pool_size, int timeout_ms, int keepalive_ms,
-    const json &config_json) {
+    const json &config_json) : _pool(2 * std::max(max_pool_size, 1)) {
   _addr = addr;
   _port = port;
-  _min_pool_size = min_pool_size;
+  _min_pool_size = std::min(min_pool_size, max_pool_size);
   _max_pool_size = max_pool_size;
   _timeout_ms = timeout_ms;
   _client_type = client_type;
   _keepalive_ms = keepalive_ms;
   _config_json = &config_json;
+  _curr_pool_size = 0;
 
-  for (int i = 0; i < min_pool_size; ++i) {
-    TClient *client = new TClient(addr, port, keepalive_ms, config_json);
-    _pool.emplace_back(client);
-  }
-  _curr_pool_size = min_pool_size;
+  _maintenance_thread = std::thread(&ClientPool<TClient>::_Run, this);
 }
 
 template<class TClient>
 ClientPool<TClient>::~ClientPool() {
-  while (!_pool.empty()) {
-    delete _pool.front();
-    _pool.pop_front();
+  {
+    std::unique_lock<std::mutex> lock(_maintenance_mtx);
+    _stopped = true;
+  }
+  _maintenance_cv.notify_one();
+  if (_maintenance_thread.joinable()) {
+    _maintenance_thread.join();
+  }
+  TClient *client;
+  while (_pool.Dequeue(client)) {
+    delete client;
   }
 }
 
 template<class TClient>
 TClient * ClientPool<TClient>::Pop() {
   TClient * client = nullptr;
-  {
-    std::unique_lock<std::mutex> cv_lock(_mtx);
-    while (_pool.size() == 0 && _curr_pool_size == _max_pool_size) {
-      // Create a new a client if current pool size is less than
-      // the max pool size.
-      auto wait_time = std::chrono::system_clock::now() +
-          std::chrono::milliseconds(_timeout_ms);
-      bool wait_success = _cv.wait_until(cv_lock, wait_time,
-            [this] { return _pool.size() > 0 || _curr_pool_size < _max_pool_size; });
-      if (!wait_success) {
-        LOG(warning) << "ClientPool pop timeout";
-        LOG(info) << _pool.size() << " " << _curr_pool_size;
-        cv_lock.unlock();
-        return nullptr;
-      }
-    }
-    if (_pool.size() > 0) {
-      client = _pool.front();
-      _pool.pop_front();
-    } else {
+  auto wait_time = std::chrono::system_clock::now() +
+      std::chrono::milliseconds(_timeout_ms);
+  while (!_pool.Dequeue(client)) {
+    // Create a new a client if current pool size is less than
+    // the max pool size.
+    if (_Reserve()) {
       client = new TClient(_addr, _port, _keepalive_ms, *_config_json);
-      _curr_pool_size++;
+      _creations++;
+      break;
+    }
+    _waits++;
+    std::unique_lock<std::mutex> cv_lock(_mtx);
+    _waiters++;
+    // Pairs with the fence in _NotifyWaiters, so either the pusher sees this
+    // waiter or the predicate below sees the pushed client.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool wait_success = _cv.wait_until(cv_lock, wait_time,
+        [this] { return !_pool.Empty() || _curr_pool_size < _max_pool_size; });
+    _waiters--;
+    if (!wait_success) {
+      _timeouts++;
+      LOG(warning) << "ClientPool pop timeout";
+      LOG(info) << _pool.Size() << " " << _curr_pool_size;
+      return nullptr;
     }
-  cv_lock.unlock();
-  } // cv_lock(_mtx)
+  }
 
+  if (_pool.Empty() && _curr_pool_size < _max_pool_size &&
+      !_spare_wanted.exchange(true)) {
+    _maintenance_cv.notify_one();
+  }
 
   if (client) {
     try {
@@ -121,34 +167,139 @@ TClient * ClientPool<TClient>::Pop() {
 
 template<class TClient>
 void ClientPool<TClient>::Push(TClient *client) {
-  std::unique_lock<std::mutex> cv_lock(_mtx);
-  _pool.push_back(client);
-  cv_lock.unlock();
-  _cv.notify_one();
+  // At most max_size clients exist, but Enqueue can still see a cell that a
+  // consumer one lap behind has claimed and not yet released. The queue has
+  // twice that headroom, so this only spins while such a consumer finishes.
+  while (!_pool.Enqueue(client)) {
+    std::this_thread::yield();
+  }
+  _NotifyWaiters();
 }
 
 template<class TClient>
 void ClientPool<TClient>::Remove(TClient *client) {
   // No need to delete it from _pool because the *client has been poped out
   delete client;
-  std::unique_lock<std::mutex> cv_lock(_mtx);
-  _curr_pool_size--;
-  cv_lock.unlock();
-  _cv.notify_one();
+  _evictions++;
+  _Release();
 }
 
 template<class TClient>
 void ClientPool<TClient>::Keepalive(TClient *client) {
-  long curr_timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
-          std::chrono::system_clock::now().time_since_epoch()).count();
-  if (curr_timestamp - client->_connect_timestamp > client->_keepalive_ms) {
+  if (_IsExpired(client)) {
     Remove(client);
   } else {
     Push(client);
   }
 }
 
+template<class TClient>
+ClientPoolStats ClientPool<TClient>::GetStats() const {
+  return {_waits.load(), _timeouts.load(), _creations.load(),
+          _evictions.load()};
+}
+
+template<class TClient>
+bool ClientPool<TClient>::_Reserve() {
+  int curr = _curr_pool_size.load();
+  while (curr < _max_pool_size) {
+    if (_curr_pool_size.compare_exchange_weak(curr, curr + 1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template<class TClient>
+void ClientPool<TClient>::_Release() {
+  _curr_pool_size--;
+  _NotifyWaiters();
+  if (_curr_pool_size < _min_pool_size) {
+    _maintenance_cv.notify_one();
+  }
+}
+
+template<class TClient>
+void ClientPool<TClient>::_NotifyWaiters() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_waiters.load(std::memory_order_relaxed) > 0) {
+    // Taking the lock makes sure the waiter is already blocked on _cv.
+    std::unique_lock<std::mutex> cv_lock(_mtx);
+    cv_lock.unlock();
+    _cv.notify_one();
+  }
+}
+
+template<class TClient>
+bool ClientPool<TClient>::_IsExpired(TClient *client) const {
+  long curr_timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch()).count();
+  return curr_timestamp - client->_connect_timestamp > client->_keepalive_ms;
+}
+
+template<class TClient>
+void ClientPool<TClient>::_Maintain() {
+  // Health-check the clients that are idle right now, one at a time so the
+  // free list never drains because of the check. The list is FIFO, so each
+  // idle client comes up once per pass.
+  TClient *client;
+  for (size_t n = _pool.Size(); n > 0 && _pool.Dequeue(client); --n) {
+    if (_IsExpired(client) || !client->IsConnected()) {
+      Remove(client);
+    } else {
+      Push(client);
+    }
+  }
+
+  // Pre-warm up to min_size, plus a spare when Pop took the last idle
+  // client, so requests find connected clients.
+  bool spare = _spare_wanted.exchange(false);
+  while ((_curr_pool_size < _min_pool_size || (spare && _pool.Empty())) &&
+         _Reserve()) {
+    client = new TClient(_addr, _port, _keepalive_ms, *_config_json);
+    _creations++;
+    try {
+      client->Connect();
+    } catch (...) {
+      LOG(warning) << "Failed to pre-connect " << _client_type;
+      delete client;
+      _Release();
+      break;
+    }
+    Push(client);
+    spare = false;
+  }
+}
+
+template<class TClient>
+void ClientPool<TClient>::_Run() {
+  auto interval = std::chrono::milliseconds(
+      std::max(std::min(_keepalive_ms, 1000), 100));
+  auto last_stats = GetStats();
+  auto next_report = std::chrono::steady_clock::now() + std::chrono::minutes(1);
+  std::unique_lock<std::mutex> lock(_maintenance_mtx);
+  while (!_stopped) {
+    lock.unlock();
+    _Maintain();
+    if (std::chrono::steady_clock::now() >= next_report) {
+      auto stats = GetStats();
+      if (stats.waits != last_stats.waits ||
+          stats.timeouts != last_stats.timeouts) {
+        LOG(info) << "ClientPool " << _client_type << " size "
+                  << _curr_pool_size << "/" << _max_pool_size << " waits "
+                  << stats.waits << " timeouts " << stats.timeouts
+                  << " creations " << stats.creations << " evictions "
+                  << stats.evictions;
+      }
+      last_stats = stats;
+      next_report = std::chrono::steady_clock::now() + std::chrono::minutes(1);
+    }
+    lock.lock();
+    _maintenance_cv.wait_for(lock, interval);
+  }
+}
+
 } // namespace social_network
 
 
-#endif //SOCIAL_NETWORK_MICROSERVICES_CLIENTPOOL_H
\ No newline at end of file
+#endif //SOCIAL_NETWORK_MICROSERVICES_CLIENTPOOL_H
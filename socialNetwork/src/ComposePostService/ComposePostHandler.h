@@ -1,13 +1,13 @@
 #ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_COMPOSEPOSTSERVICE_COMPOSEPOSTHANDLER_H_
 #define SOCIAL_NETWORK_MICROSERVICES_SRC_COMPOSEPOSTSERVICE_COMPOSEPOSTHANDLER_H_
 
+#include <algorithm>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
-#include <regex>
 #include <future>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../../gen-cpp/ComposePostService.h"
@@ -20,10 +20,14 @@
 #include "../../gen-cpp/UserTimelineService.h"
 #include "../../gen-cpp/social_network_types.h"
 #include "../ClientPool.h"
+#include "../Executor.h"
 #include "../ThriftClient.h"
+#include "../TimeoutTable.h"
+#include "../UniqueIdGenerator.h"
 #include "../logger.h"
 #include "../tracing.h"
-#include <fstream>
+#include "../WriteHomeTimelineService/HomeTimelineMessage.h"
+#include "RabbitmqClient.h"
 
 using namespace std::chrono_literals;
 
@@ -32,12 +36,15 @@ using std::chrono::duration_cast;
 using std::chrono::milliseconds;
 using std::chrono::system_clock;
 
-std::string formatTimePoint(const std::chrono::system_clock::time_point& tp) {
-    auto time_t = std::chrono::system_clock::to_time_t(tp);
-    std::ostringstream oss;
-    oss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
-    return oss.str();
-}
+// Where the testbed's injected per-future wait times are applied.
+//   OFF:        not applied.
+//   INLINE:     the handler sleeps after each future is ready, adding the
+//               wait to the response latency.
+//   BACKGROUND: the wait starts when the stage is issued and runs alongside
+//               its calls; the handler waits until the later of the result
+//               and the stage start plus the wait. The waits of one stage
+//               overlap, and no executor worker is held for them.
+enum class InjectedWaitMode { OFF, INLINE, BACKGROUND };
 
 class ComposePostHandler : public ComposePostServiceIf {
  public:
@@ -47,7 +54,10 @@ class ComposePostHandler : public ComposePostServiceIf {
                      ClientPool<ThriftClient<UniqueIdServiceClient>> *,
                      ClientPool<ThriftClient<MediaServiceClient>> *,
                      ClientPool<ThriftClient<TextServiceClient>> *,
-                     ClientPool<ThriftClient<HomeTimelineServiceClient>> *);
+                     ClientPool<ThriftClient<HomeTimelineServiceClient>> *,
+                     ClientPool<RabbitmqClient> *, TimeoutTable *, int,
+                     InjectedWaitMode, Executor *, int, int,
+                     UniqueIdGenerator *);
   ~ComposePostHandler() override = default;
 
   void ComposePost(int64_t req_id, const std::string &username, int64_t user_id,
@@ -69,6 +79,42 @@ class ComposePostHandler : public ComposePostServiceIf {
   ClientPool<ThriftClient<TextServiceClient>> *_text_service_client_pool;
   ClientPool<ThriftClient<HomeTimelineServiceClient>>
       *_home_timeline_client_pool;
+  // Set when home timelines are written by WriteHomeTimelineService from the
+  // write-home-timeline queue rather than by WriteHomeTimeline.
+  ClientPool<RabbitmqClient> *_rabbitmq_client_pool;
+
+  TimeoutTable *_timeout_table;
+  int _text_future_slot;
+  int _creator_future_slot;
+  int _media_future_slot;
+  int _unique_id_future_slot;
+  int _post_future_slot;
+  int _user_timeline_future_slot;
+  int _home_timeline_future_slot;
+
+  int _fanout_deadline_ms;
+  InjectedWaitMode _injected_wait_mode;
+  Executor *_executor;
+
+  // Post IDs leased from unique-id-service with ComposeUniqueIds, handed out
+  // locally until the range runs out or is older than the ttl. A lease size
+  // of 1 asks unique-id-service for every post.
+  int _unique_id_lease_size;
+  std::chrono::milliseconds _unique_id_lease_ttl;
+  std::mutex _unique_id_lease_lock;
+  int64_t _unique_id_lease_next;
+  int64_t _unique_id_lease_end;
+  std::chrono::steady_clock::time_point _unique_id_lease_expiry;
+  // Set when post IDs are generated in process (unique_id_mode "embedded"),
+  // without unique-id-service or the lease above.
+  UniqueIdGenerator *_unique_id_generator;
+
+  template <class T>
+  T _AwaitFuture(Future<T> &future, int slot, const char *name,
+                 const system_clock::time_point &start,
+                 const system_clock::time_point &deadline);
+  void _RecordLatency(int slot, const char *name,
+                      const std::chrono::system_clock::time_point &start);
 
   void _UploadUserTimelineHelper(
       int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
@@ -81,6 +127,10 @@ class ComposePostHandler : public ComposePostServiceIf {
       int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
       const std::vector<int64_t> &user_mentions_id,
       const std::map<std::string, std::string> &carrier);
+  void _PublishHomeTimelineHelper(
+      int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
+      const std::vector<int64_t> &user_mentions_id,
+      const std::map<std::string, std::string> &carrier);
 
   Creator _ComposeCreaterHelper(
       int64_t req_id, int64_t user_id, const std::string &username,
@@ -108,7 +158,12 @@ ComposePostHandler::ComposePostHandler(
     ClientPool<ThriftClient<MediaServiceClient>> *media_service_client_pool,
     ClientPool<ThriftClient<TextServiceClient>> *text_service_client_pool,
     ClientPool<ThriftClient<HomeTimelineServiceClient>>
-        *home_timeline_client_pool) {
+        *home_timeline_client_pool,
+    ClientPool<RabbitmqClient> *rabbitmq_client_pool,
+    TimeoutTable *timeout_table, int fanout_deadline_ms,
+    InjectedWaitMode injected_wait_mode, Executor *executor,
+    int unique_id_lease_size, int unique_id_lease_ttl_ms,
+    UniqueIdGenerator *unique_id_generator) {
   _post_storage_client_pool = post_storage_client_pool;
   _user_timeline_client_pool = user_timeline_client_pool;
   _user_service_client_pool = user_service_client_pool;
@@ -116,6 +171,79 @@ ComposePostHandler::ComposePostHandler(
   _media_service_client_pool = media_service_client_pool;
   _text_service_client_pool = text_service_client_pool;
   _home_timeline_client_pool = home_timeline_client_pool;
+  _rabbitmq_client_pool = rabbitmq_client_pool;
+  _timeout_table = timeout_table;
+  _fanout_deadline_ms = fanout_deadline_ms;
+  _injected_wait_mode = injected_wait_mode;
+  _executor = executor;
+  // unique-id-service leases at most 4096 IDs, one millisecond's worth.
+  _unique_id_lease_size = std::min(std::max(unique_id_lease_size, 1), 4096);
+  _unique_id_lease_ttl = milliseconds(std::max(unique_id_lease_ttl_ms, 1));
+  _unique_id_lease_next = 0;
+  _unique_id_lease_end = 0;
+  _unique_id_generator = unique_id_generator;
+  _text_future_slot =
+      _timeout_table->Register("ComposePostService-text_future");
+  _creator_future_slot =
+      _timeout_table->Register("ComposePostService-creator_future");
+  _media_future_slot =
+      _timeout_table->Register("ComposePostService-media_future");
+  _unique_id_future_slot =
+      _timeout_table->Register("ComposePostService-unique_id_future");
+  _post_future_slot =
+      _timeout_table->Register("ComposePostService-post_future");
+  _user_timeline_future_slot =
+      _timeout_table->Register("ComposePostService-user_timeline_future");
+  _home_timeline_future_slot =
+      _timeout_table->Register("ComposePostService-home_timeline_future");
+}
+
+// Waits for the future until the stage deadline. The per-future timeout from
+// the timeout table only controls how often a slow future is reported.
+template <class T>
+T ComposePostHandler::_AwaitFuture(Future<T> &future, int slot,
+                                   const char *name,
+                                   const system_clock::time_point &start,
+                                   const system_clock::time_point &deadline) {
+  auto timeout = _timeout_table->Timeout(slot);
+  while (true) {
+    auto now = system_clock::now();
+    if (now >= deadline) {
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+      se.message = std::string("Deadline exceeded waiting for ") + name;
+      LOG(error) << se.message;
+      throw se;
+    }
+    if (timeout <= 0ms && deadline == system_clock::time_point::max()) {
+      future.wait();
+      break;
+    }
+    auto until = deadline;
+    if (timeout > 0ms && now + timeout < deadline) {
+      until = now + timeout;
+    }
+    if (future.wait_until(until) == std::future_status::ready) {
+      break;
+    }
+    LOG(info) << "Timeout waiting for " << name;
+  }
+  _RecordLatency(slot, name, start);
+  if (_injected_wait_mode == InjectedWaitMode::INLINE) {
+    std::this_thread::sleep_for(_timeout_table->WaitTime(slot));
+  } else if (_injected_wait_mode == InjectedWaitMode::BACKGROUND) {
+    std::this_thread::sleep_until(start + _timeout_table->WaitTime(slot));
+  }
+  return future.get();
+}
+
+void ComposePostHandler::_RecordLatency(
+    int slot, const char *name,
+    const std::chrono::system_clock::time_point &start) {
+  auto latency = duration_cast<milliseconds>(system_clock::now() - start);
+  LOG(debug) << "ComposePost " << name << " latency: " << latency.count()
+             << " ms";
+  _timeout_table->RecordLatency(slot, latency.count());
 }
 
 Creator ComposePostHandler::_ComposeCreaterHelper(
@@ -234,6 +362,14 @@ std::vector<Media> ComposePostHandler::_ComposeMediaHelper(
 int64_t ComposePostHandler::_ComposeUniqueIdHelper(
     int64_t req_id, const PostType::type post_type,
     const std::map<std::string, std::string> &carrier) {
+  if (_unique_id_lease_size > 1) {
+    std::lock_guard<std::mutex> lock(_unique_id_lease_lock);
+    if (_unique_id_lease_next < _unique_id_lease_end &&
+        std::chrono::steady_clock::now() < _unique_id_lease_expiry) {
+      return _unique_id_lease_next++;
+    }
+  }
+
   TextMapReader reader(carrier);
   auto parent_span = opentracing::Tracer::Global()->Extract(reader);
   auto span = opentracing::Tracer::Global()->StartSpan(
@@ -255,8 +391,13 @@ int64_t ComposePostHandler::_ComposeUniqueIdHelper(
   auto unique_id_client = unique_id_client_wrapper->GetClient();
   int64_t _return_unique_id;
   try {
-    _return_unique_id =
-        unique_id_client->ComposeUniqueId(req_id, post_type, writer_text_map);
+    if (_unique_id_lease_size > 1) {
+      _return_unique_id = unique_id_client->ComposeUniqueIds(
+          req_id, _unique_id_lease_size, writer_text_map);
+    } else {
+      _return_unique_id =
+          unique_id_client->ComposeUniqueId(req_id, post_type, writer_text_map);
+    }
   } catch (...) {
     LOG(error) << "Failed to send compose-unique_id to unique_id-service";
     _unique_id_service_client_pool->Remove(unique_id_client_wrapper);
@@ -264,6 +405,16 @@ int64_t ComposePostHandler::_ComposeUniqueIdHelper(
     throw;
   }
   _unique_id_service_client_pool->Keepalive(unique_id_client_wrapper);
+  if (_unique_id_lease_size > 1) {
+    // Requests that missed the range at the same time each lease their own;
+    // the last one to get here replaces the others' leftovers, which are
+    // simply never used.
+    std::lock_guard<std::mutex> lock(_unique_id_lease_lock);
+    _unique_id_lease_next = _return_unique_id + 1;
+    _unique_id_lease_end = _return_unique_id + _unique_id_lease_size;
+    _unique_id_lease_expiry =
+        std::chrono::steady_clock::now() + _unique_id_lease_ttl;
+  }
   span->Finish();
   return _return_unique_id;
 }
@@ -338,6 +489,11 @@ void ComposePostHandler::_UploadHomeTimelineHelper(
     int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
     const std::vector<int64_t> &user_mentions_id,
     const std::map<std::string, std::string> &carrier) {
+  if (_rabbitmq_client_pool) {
+    _PublishHomeTimelineHelper(req_id, post_id, user_id, timestamp,
+                               user_mentions_id, carrier);
+    return;
+  }
   TextMapReader reader(carrier);
   auto parent_span = opentracing::Tracer::Global()->Extract(reader);
   auto span = opentracing::Tracer::Global()->StartSpan(
@@ -369,6 +525,46 @@ void ComposePostHandler::_UploadHomeTimelineHelper(
   span->Finish();
 }
 
+void ComposePostHandler::_PublishHomeTimelineHelper(
+    int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
+    const std::vector<int64_t> &user_mentions_id,
+    const std::map<std::string, std::string> &carrier) {
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "write_home_timeline_publish_client",
+      {opentracing::ChildOf(parent_span->get())});
+  HomeTimelineMessage msg{req_id, post_id, user_id, timestamp,
+                          user_mentions_id, {}};
+  TextMapWriter writer(msg.carrier);
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  auto rabbitmq_client_wrapper = _rabbitmq_client_pool->Pop();
+  if (!rabbitmq_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_RABBITMQ_CONN_ERROR;
+    se.message = "Failed to connect to write-home-timeline-rabbitmq";
+    LOG(error) << se.message;
+    throw se;
+  }
+  // Persistent, so posts accepted here survive a broker restart before they
+  // are fanned out.
+  auto amqp_msg =
+      AmqpClient::BasicMessage::Create(encode_home_timeline_message(msg));
+  amqp_msg->DeliveryMode(AmqpClient::BasicMessage::dm_persistent);
+  try {
+    rabbitmq_client_wrapper->GetChannel()->BasicPublish(
+        "", "write-home-timeline", amqp_msg);
+  } catch (...) {
+    _rabbitmq_client_pool->Remove(rabbitmq_client_wrapper);
+    LOG(error) << "Failed to publish to write-home-timeline-rabbitmq";
+    throw;
+  }
+  _rabbitmq_client_pool->Keepalive(rabbitmq_client_wrapper);
+
+  span->Finish();
+}
+
 void ComposePostHandler::ComposePost(
     const int64_t req_id, const std::string &username, int64_t user_id,
     const std::string &text, const std::vector<int64_t> &media_ids,
@@ -382,208 +578,31 @@ void ComposePostHandler::ComposePost(
     TextMapWriter writer(writer_text_map);
     opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-    std::ifstream times_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
-    std::map<std::string, std::string> times;
-    std::string line;
-
-    while (std::getline(times_file, line)) {
-        if (line.empty() || line.find(':') == std::string::npos) {
-            continue;
-        }
-        std::istringstream line_stream(line);
-        std::string key, value;
-        if (std::getline(line_stream, key, ':') && std::getline(line_stream, value)) {
-            key.erase(key.find_last_not_of(" \t") + 1);
-            key.erase(0, key.find_first_not_of(" \t"));
-            value.erase(value.find_last_not_of(" \t") + 1);
-            value.erase(0, value.find_first_not_of(" \t"));
-            times[key] = value;
-            LOG(info) << key << " " << value;
-        }
+    // The four compose calls are independent, so they are issued together
+    // and the stage completes when the slowest one does.
+    auto compose_start = system_clock::now();
+    auto compose_deadline = _fanout_deadline_ms > 0
+        ? compose_start + milliseconds(_fanout_deadline_ms)
+        : system_clock::time_point::max();
+    auto text_future = _executor->Submit([=]() {
+      return _ComposeTextHelper(req_id, text, writer_text_map);
+    });
+    auto creator_future = _executor->Submit([=]() {
+      return _ComposeCreaterHelper(req_id, user_id, username, writer_text_map);
+    });
+    auto media_future = _executor->Submit([=]() {
+      return _ComposeMediaHelper(req_id, media_types, media_ids,
+                                 writer_text_map);
+    });
+    // An embedded generator is cheaper to call inline than to hand to the
+    // executor.
+    Future<int64_t> unique_id_future;
+    if (!_unique_id_generator) {
+      unique_id_future = _executor->Submit([=]() {
+        return _ComposeUniqueIdHelper(req_id, post_type, writer_text_map);
+      });
     }
 
-    times_file.close();
-
-    std::ifstream waittimes_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/wait_times.txt");
-    std::map<std::string, std::string> waittimes;
-    std::string line2;
-
-    while (std::getline(waittimes_file, line2)) {
-        if (line2.empty() || line2.find(':') == std::string::npos) {
-            continue;
-        }
-        std::istringstream line_stream2(line2);
-        std::string key, value;
-        if (std::getline(line_stream2, key, ':') && std::getline(line_stream2, value)) {
-            key.erase(key.find_last_not_of(" \t") + 1);
-            key.erase(0, key.find_first_not_of(" \t"));
-            value.erase(value.find_last_not_of(" \t") + 1);
-            value.erase(0, value.find_first_not_of(" \t"));
-            waittimes[key] = value;
-            LOG(info) << key << " " << value;
-        }
-    }
-
-    waittimes_file.close();
-
-    // Handle text_future
-    std::future_status text_future_status;
-    auto text_future =
-        std::async(std::launch::async, &ComposePostHandler::_ComposeTextHelper,
-                    this, req_id, text, writer_text_map);
-
-    std::chrono::milliseconds timeout_ms_text_future(0);
-    auto time_str1 = times["ComposePostService-text_future"];
-    if (time_str1.empty() || !std::all_of(time_str1.begin(), time_str1.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str1;
-    } else {
-        std::chrono::milliseconds timeout_ms_text_future(std::stoi(time_str1));
-    }
-
-    std::chrono::milliseconds wait_time_text_future(0);
-    auto time_str12 = waittimes["ComposePostService-text_future"];
-    if (time_str12.empty() || !std::all_of(time_str12.begin(), time_str12.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str12;
-    } else {
-        std::chrono::milliseconds wait_time_text_future(std::stoi(time_str12));
-    }
-
-    do {
-        text_future_status = text_future.wait_for(timeout_ms_text_future);
-
-        switch (text_future_status) {
-            case std::future_status::deferred:
-                LOG(info) << "Deferred text_future";
-                break;
-            case std::future_status::timeout:
-                LOG(info) << "Timeout waiting for text_future";
-                break;
-            case std::future_status::ready:
-                LOG(info) << "Ready text_future";
-                std::this_thread::sleep_for(wait_time_text_future);
-                LOG(info) << "Forced extra time text_future";
-                break;
-        }
-    } while (text_future_status != std::future_status::ready);
-
-    // Handle creator_future
-    std::future_status creator_future_status;
-    auto creator_future =
-        std::async(std::launch::async, &ComposePostHandler::_ComposeCreaterHelper,
-                    this, req_id, user_id, username, writer_text_map);
-
-    std::chrono::milliseconds timeout_ms_creator_future(0);
-    auto time_str2 = times["ComposePostService-creator_future"];
-    if (time_str2.empty() || !std::all_of(time_str2.begin(), time_str2.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str2;
-    } else {
-        std::chrono::milliseconds timeout_ms_creator_future(std::stoi(time_str2));
-    }
-
-    std::chrono::milliseconds wait_time_creator_future(0);
-    auto time_str22 = times["ComposePostService-creator_future"];
-    if (time_str22.empty() || !std::all_of(time_str22.begin(), time_str22.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str22;
-    } else {
-        std::chrono::milliseconds wait_time_creator_future(std::stoi(time_str22));
-    }
-
-    do {
-        creator_future_status = creator_future.wait_for(timeout_ms_creator_future);
-
-        switch (creator_future_status) {
-            case std::future_status::deferred:
-                LOG(info) << "Deferred creator_future";
-                break;
-            case std::future_status::timeout:
-                LOG(info) << "Timeout waiting for creator_future";
-                break;
-            case std::future_status::ready:
-                LOG(info) << "Ready creator_future";
-                std::this_thread::sleep_for(wait_time_creator_future);
-                LOG(info) << "Forced extra time creator_future";
-                break;
-        }
-    } while (creator_future_status != std::future_status::ready);
-
-    // Handle media_future
-    std::future_status media_future_status;
-    auto media_future =
-        std::async(std::launch::async, &ComposePostHandler::_ComposeMediaHelper,
-                    this, req_id, media_types, media_ids, writer_text_map);
-    
-    std::chrono::milliseconds timeout_ms_media_future(0);
-    auto time_str3 = times["ComposePostService-media_future"];
-    if (time_str3.empty() || !std::all_of(time_str3.begin(), time_str3.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str3;
-    } else {
-        std::chrono::milliseconds timeout_ms_media_future(std::stoi(time_str3));
-    }
-
-    std::chrono::milliseconds wait_time_media_future(0);
-    auto time_str32 = times["ComposePostService-media_future"];
-    if (time_str32.empty() || !std::all_of(time_str32.begin(), time_str32.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str32;
-    } else {
-        std::chrono::milliseconds wait_time_media_future(std::stoi(time_str32));
-    }
-
-    do {
-        media_future_status = media_future.wait_for(timeout_ms_media_future);
-
-        switch (media_future_status) {
-            case std::future_status::deferred:
-                LOG(info) << "Deferred media_future";
-                break;
-            case std::future_status::timeout:
-                LOG(info) << "Timeout waiting for media_future";
-                break;
-            case std::future_status::ready:
-                LOG(info) << "Ready media_future";
-                std::this_thread::sleep_for(wait_time_media_future);
-                LOG(info) << "Forced extra time media_future";
-                break;
-        }
-    } while (media_future_status != std::future_status::ready);
-
-    // Handle unique_id_future
-    std::future_status unique_id_future_status;
-    auto unique_id_future = std::async(std::launch::async, &ComposePostHandler::_ComposeUniqueIdHelper, this, req_id, post_type, writer_text_map);
-
-    std::chrono::milliseconds timeout_ms_unique_id_future(0);
-    auto time_str4 = times["ComposePostService-unique_id_future"];
-    if (time_str4.empty() || !std::all_of(time_str4.begin(), time_str4.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str4;
-    } else {
-        std::chrono::milliseconds timeout_ms_unique_id_future(std::stoi(time_str4));
-    }
-
-    std::chrono::milliseconds wait_time_unique_id_future(0);
-    auto time_str42 = times["ComposePostService-unique_id_future"];
-    if (time_str42.empty() || !std::all_of(time_str42.begin(), time_str42.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str42;
-    } else {
-        std::chrono::milliseconds wait_time_unique_id_future(std::stoi(time_str42));
-    }
-
-    do {
-        unique_id_future_status = unique_id_future.wait_for(timeout_ms_unique_id_future);
-
-        switch (unique_id_future_status) {
-            case std::future_status::deferred:
-                LOG(info) << "Deferred unique_id_future";
-                break;
-            case std::future_status::timeout:
-                LOG(info) << "Timeout waiting for unique_id_future";
-                break;
-            case std::future_status::ready:
-                LOG(info) << "Ready unique_id_future";
-                std::this_thread::sleep_for(wait_time_unique_id_future);
-                LOG(info) << "Forced extra time unique_id_future";
-                break;
-        }
-    } while (unique_id_future_status != std::future_status::ready);
-
     Post post;
     auto timestamp =
         duration_cast<milliseconds>(system_clock::now().time_since_epoch())
@@ -591,78 +610,25 @@ void ComposePostHandler::ComposePost(
     post.timestamp = timestamp;
 
     try {
-        auto start_time_unique_id_future = std::chrono::system_clock::now();
-        LOG(info) << formatTimePoint(start_time_unique_id_future);
-        post.post_id = unique_id_future.get();
-        auto end_time_unique_id_future = std::chrono::system_clock::now();
-        LOG(info) << formatTimePoint(end_time_unique_id_future);
-        auto latency_unique_id_future = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_unique_id_future - start_time_unique_id_future).count();
-        LOG(info) << "ComposePost unique_id_future latency: " << latency_unique_id_future << " ms";
-        times["ComposePostService-unique_id_future"] = std::to_string(latency_unique_id_future) + "ms";
-        std::ofstream output_times_file_unique_id_future("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
-        for (const auto& pair : times) {
-            const auto& key = pair.first;
-            const auto& value = pair.second;
-            output_times_file_unique_id_future << key << ": " << value << std::endl;
-        }
-        output_times_file_unique_id_future.close();
-
-
-        auto start_time_creator_future = std::chrono::system_clock::now();
-        LOG(info) << formatTimePoint(start_time_creator_future);
-        post.creator = creator_future.get();
-        auto end_time_creator_future = std::chrono::system_clock::now();
-        LOG(info) << formatTimePoint(end_time_creator_future);
-        auto latency_creator_future = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_creator_future - start_time_creator_future).count();
-        LOG(info) << "ComposePost creator_future latency: " << latency_creator_future << " ms";
-        times["ComposePostService-creator_future"] = std::to_string(latency_creator_future) + "ms";
-        std::ofstream output_times_file_creator_future("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
-        for (const auto& pair : times) {
-            const auto& key = pair.first;
-            const auto& value = pair.second;
-            output_times_file_creator_future << key << ": " << value << std::endl;
-        }
-        output_times_file_creator_future.close();
-
-    
-        auto start_time_media_future = std::chrono::system_clock::now();
-        LOG(info) << formatTimePoint(start_time_media_future);
-        post.media = media_future.get();
-        auto end_time_media_future = std::chrono::system_clock::now();
-        LOG(info) << formatTimePoint(end_time_media_future);
-        auto latency_media_future = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_media_future - start_time_media_future).count();
-        LOG(info) << "ComposePost media_future latency: " << latency_media_future << " ms";
-        times["ComposePostService-media_future"] = std::to_string(latency_media_future) + "ms";
-        std::ofstream output_times_file_media_future("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
-        for (const auto& pair : times) {
-            const auto& key = pair.first;
-            const auto& value = pair.second;
-            output_times_file_media_future << key << ": " << value << std::endl;
-        }
-        output_times_file_media_future.close();
-
-
-        auto start_time_text_future = std::chrono::system_clock::now();
-        LOG(info) << formatTimePoint(start_time_text_future);
-        auto text_return = text_future.get();
+        post.post_id = _unique_id_generator
+            ? _unique_id_generator->Next(1)
+            : _AwaitFuture(unique_id_future, _unique_id_future_slot,
+                           "unique_id_future", compose_start,
+                           compose_deadline);
+        post.creator = _AwaitFuture(creator_future, _creator_future_slot,
+                                    "creator_future", compose_start,
+                                    compose_deadline);
+        post.media = _AwaitFuture(media_future, _media_future_slot,
+                                  "media_future", compose_start,
+                                  compose_deadline);
+        auto text_return = _AwaitFuture(text_future, _text_future_slot,
+                                        "text_future", compose_start,
+                                        compose_deadline);
         post.text = text_return.text;
         post.urls = text_return.urls;
         post.user_mentions = text_return.user_mentions;
         post.req_id = req_id;
         post.post_type = post_type;
-        auto end_time_text_future = std::chrono::system_clock::now();
-        LOG(info) << formatTimePoint(end_time_text_future);
-        auto latency_text_future = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_text_future - start_time_text_future).count();
-        LOG(info) << "ComposePost text_future latency: " << latency_text_future << " ms";
-        times["ComposePostService-text_future"] = std::to_string(latency_text_future) + "ms";
-        std::ofstream output_times_file_text_future("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
-        for (const auto& pair : times) {
-            const auto& key = pair.first;
-            const auto& value = pair.second;
-            output_times_file_text_future << key << ": " << value << std::endl;
-        }
-        output_times_file_text_future.close();
-
     }
     catch (const std::exception& e) {
         LOG(error) << "Error while composing post: " << e.what();
@@ -674,175 +640,31 @@ void ComposePostHandler::ComposePost(
         user_mention_ids.emplace_back(item.user_id);
     }
 
-    // Handle post_future
-    std::future_status post_future_status;
-    auto post_future = std::async(std::launch::async, &ComposePostHandler::_UploadPostHelper,
-                                  this, req_id, post, writer_text_map);
-
-    std::chrono::milliseconds timeout_ms_post_future(0);
-    auto time_str5 = times["ComposePostService-post_future"];
-    if (time_str5.empty() || !std::all_of(time_str5.begin(), time_str5.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str5;
-    } else {
-        std::chrono::milliseconds timeout_ms_post_future(std::stoi(time_str5));
-    }
-
-    std::chrono::milliseconds wait_time_post_future(0);
-    auto time_str52 = times["ComposePostService-post_future"];
-    if (time_str52.empty() || !std::all_of(time_str52.begin(), time_str52.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str52;
-    } else {
-        std::chrono::milliseconds wait_time_post_future(std::stoi(time_str52));
-    }
-
-    do {
-        post_future_status = post_future.wait_for(timeout_ms_post_future);
-
-        switch (post_future_status) {
-            case std::future_status::deferred:
-                LOG(info) << "Deferred post_future";
-                break;
-            case std::future_status::timeout:
-                LOG(info) << "Timeout waiting for post_future";
-                break;
-            case std::future_status::ready:
-                LOG(info) << "Ready post_future";
-                std::this_thread::sleep_for(wait_time_post_future);
-                LOG(info) << "Forced extra time post_future";
-                break;
-        }
-    } while (post_future_status != std::future_status::ready);
-
-
-    // Handle user_timeline_future
-    std::future_status user_timeline_future_status;
-    auto user_timeline_future = std::async(
-        std::launch::deferred, &ComposePostHandler::_UploadUserTimelineHelper, this,
-        req_id, post.post_id, user_id, timestamp, writer_text_map);
-
-    std::chrono::milliseconds timeout_ms_user_timeline_future(0);
-    auto time_str6 = times["ComposePostService-user_timeline_future"];
-    if (time_str6.empty() || !std::all_of(time_str6.begin(), time_str6.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str6;
-    } else {
-        std::chrono::milliseconds timeout_ms_user_timeline_future(std::stoi(time_str6));
-    }
-
-    std::chrono::milliseconds wait_time_user_timeline_future(0);
-    auto time_str62 = times["ComposePostService-user_timeline_future"];
-    if (time_str6.empty() || !std::all_of(time_str62.begin(), time_str62.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str62;
-    } else {
-        std::chrono::milliseconds wait_time_user_timeline_future(std::stoi(time_str62));
-    }
-
-    do {
-        user_timeline_future_status = user_timeline_future.wait_for(timeout_ms_user_timeline_future);
-
-        switch (user_timeline_future_status) {
-            case std::future_status::deferred:
-                LOG(info) << "Deferred user_timeline_future";
-                break;
-            case std::future_status::timeout:
-                LOG(info) << "Timeout waiting for user_timeline_future";
-                break;
-            case std::future_status::ready:
-                LOG(info) << "Ready user_timeline_future";
-                std::this_thread::sleep_for(wait_time_user_timeline_future);
-                LOG(info) << "Forced extra time user_timeline_future";
-                break;
-        }
-    } while (user_timeline_future_status != std::future_status::ready);
-
-
-    // Handle home_timeline_future
-    std::future_status home_timeline_future_status;
-    auto home_timeline_future = std::async(
-        std::launch::deferred, &ComposePostHandler::_UploadHomeTimelineHelper, this,
-        req_id, post.post_id, user_id, timestamp, user_mention_ids,
-        writer_text_map);
-
-    std::chrono::milliseconds timeout_ms_home_timeline_future(0);
-    auto time_str7 = times["ComposePostService-home_timeline_future"];
-    if (time_str7.empty() || !std::all_of(time_str7.begin(), time_str7.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str7;
-    } else {
-        std::chrono::milliseconds timeout_ms_home_timeline_future(std::stoi(time_str7));
-    }
-
-    std::chrono::milliseconds wait_time_home_timeline_future(0);
-    auto time_str72 = times["ComposePostService-home_timeline_future"];
-    if (time_str72.empty() || !std::all_of(time_str72.begin(), time_str72.end(), ::isdigit)) {
-        LOG(error) << "Invalid timeout value: " << time_str72;
-    } else {
-        std::chrono::milliseconds wait_time_home_timeline_future(std::stoi(time_str72));
-    }
-
-    do {
-        home_timeline_future_status = home_timeline_future.wait_for(timeout_ms_home_timeline_future);
-
-        switch (home_timeline_future_status) {
-            case std::future_status::deferred:
-                LOG(info) << "Deferred home_timeline_future";
-                break;
-            case std::future_status::timeout:
-                LOG(info) << "Timeout waiting for home_timeline_future";
-                break;
-            case std::future_status::ready:
-                LOG(info) << "Ready home_timeline_future";
-                std::this_thread::sleep_for(wait_time_home_timeline_future);
-                LOG(info) << "Forced extra time home_timeline_future";
-                break;
-        }
-    } while (home_timeline_future_status != std::future_status::ready);
-
-    auto start_time_post_future = std::chrono::system_clock::now();
-    LOG(info) << formatTimePoint(start_time_post_future);
-    post_future.get();
-    auto end_time_post_future = std::chrono::system_clock::now();
-    LOG(info) << formatTimePoint(end_time_post_future);
-    auto latency_post_future = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_post_future - start_time_post_future).count();
-    LOG(info) << "ComposePost post_future latency: " << latency_post_future << " ms";
-    times["ComposePostService-post_future"] = std::to_string(latency_post_future) + "ms";
-    std::ofstream output_times_file_post_future("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
-    for (const auto& pair : times) {
-        const auto& key = pair.first;
-        const auto& value = pair.second;
-        output_times_file_post_future << key << ": " << value << std::endl;
-    }
-    output_times_file_post_future.close();
-
-    auto start_time_user_timeline_future = std::chrono::system_clock::now();
-    LOG(info) << formatTimePoint(start_time_user_timeline_future);
-    user_timeline_future.get();
-    auto end_time_user_timeline_future = std::chrono::system_clock::now();
-    LOG(info) << formatTimePoint(end_time_user_timeline_future);
-    auto latency_user_timeline_future = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_user_timeline_future - start_time_user_timeline_future).count();
-    LOG(info) << "ComposePost user_timeline_future latency: " << latency_user_timeline_future << " ms";
-    times["ComposePostService-user_timeline_future"] = std::to_string(latency_user_timeline_future) + "ms";
-    std::ofstream output_times_file_user_timeline_future("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
-    for (const auto& pair : times) {
-        const auto& key = pair.first;
-        const auto& value = pair.second;
-        output_times_file_user_timeline_future << key << ": " << value << std::endl;
-    }
-    output_times_file_user_timeline_future.close();
-
-    auto start_time_home_timeline_future = std::chrono::system_clock::now();
-    LOG(info) << formatTimePoint(start_time_home_timeline_future);
-    home_timeline_future.get();
-    auto end_time_home_timeline_future = std::chrono::system_clock::now();
-    LOG(info) << formatTimePoint(end_time_home_timeline_future);
-    auto latency_home_timeline_future = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_home_timeline_future - start_time_home_timeline_future).count();
-    LOG(info) << "ComposePost home_timeline_future latency: " << latency_home_timeline_future << " ms";
-    times["ComposePostService-home_timeline_future"] = std::to_string(latency_home_timeline_future) + "ms";
-    std::ofstream output_times_file_home_timeline_future("/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
-    for (const auto& pair : times) {
-        const auto& key = pair.first;
-        const auto& value = pair.second;
-        output_times_file_home_timeline_future << key << ": " << value << std::endl;
-    }
-    output_times_file_home_timeline_future.close();
+    // Storing the post and writing both timelines only depend on the composed
+    // post, so they are also issued together under one deadline.
+    auto upload_start = system_clock::now();
+    auto upload_deadline = _fanout_deadline_ms > 0
+        ? upload_start + milliseconds(_fanout_deadline_ms)
+        : system_clock::time_point::max();
+    auto post_id = post.post_id;
+    auto post_future = _executor->Submit([=]() {
+      _UploadPostHelper(req_id, post, writer_text_map);
+    });
+    auto user_timeline_future = _executor->Submit([=]() {
+      _UploadUserTimelineHelper(req_id, post_id, user_id, timestamp,
+                                writer_text_map);
+    });
+    auto home_timeline_future = _executor->Submit([=]() {
+      _UploadHomeTimelineHelper(req_id, post_id, user_id, timestamp,
+                                user_mention_ids, writer_text_map);
+    });
+
+    _AwaitFuture(post_future, _post_future_slot, "post_future", upload_start,
+                 upload_deadline);
+    _AwaitFuture(user_timeline_future, _user_timeline_future_slot,
+                 "user_timeline_future", upload_start, upload_deadline);
+    _AwaitFuture(home_timeline_future, _home_timeline_future_slot,
+                 "home_timeline_future", upload_start, upload_deadline);
 
     span->Finish();
 }
@@ -1,17 +1,11 @@
 #include <signal.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
+
+#include <memory>
 
 #include "../utils.h"
 #include "../utils_thrift.h"
 #include "ComposePostHandler.h"
 
-using apache::thrift::protocol::TBinaryProtocolFactory;
-using apache::thrift::server::TThreadedServer;
-using apache::thrift::transport::TFramedTransportFactory;
-using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
 void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
@@ -28,9 +22,40 @@ int main(int argc, char *argv[]) {
 
   int port = config_json["compose-post-service"]["port"];
 
+  auto &compose_post_config = config_json["compose-post-service"];
+  std::string timeout_values_path = compose_post_config.value(
+      "timeout_values_path",
+      "/mydata/adrita/socialnetwork-testbed/socialNetwork/src/timeout_values.txt");
+  std::string wait_times_path = compose_post_config.value(
+      "wait_times_path",
+      "/mydata/adrita/socialnetwork-testbed/socialNetwork/src/wait_times.txt");
+  std::string latency_stats_path = compose_post_config.value(
+      "latency_stats_path",
+      "/mydata/adrita/socialnetwork-testbed/socialNetwork/src/latency_stats.txt");
+  int latency_flush_ms = compose_post_config.value("latency_flush_ms", 1000);
+  int timeouts_poll_ms = compose_post_config.value("timeouts_poll_ms", 1000);
+  int executor_threads = compose_post_config.value("executor_threads", 64);
+  int executor_max_queued = compose_post_config.value("executor_max_queued", 0);
+  int fanout_deadline_ms = compose_post_config.value("fanout_deadline_ms", 0);
+  std::string injected_wait_mode_str =
+      compose_post_config.value("injected_wait_mode", "off");
+  InjectedWaitMode injected_wait_mode;
+  if (injected_wait_mode_str == "off") {
+    injected_wait_mode = InjectedWaitMode::OFF;
+  } else if (injected_wait_mode_str == "inline") {
+    injected_wait_mode = InjectedWaitMode::INLINE;
+  } else if (injected_wait_mode_str == "background") {
+    injected_wait_mode = InjectedWaitMode::BACKGROUND;
+  } else {
+    LOG(error) << "Unknown injected_wait_mode " << injected_wait_mode_str;
+    exit(EXIT_FAILURE);
+  }
+
   int post_storage_port = config_json["post-storage-service"]["port"];
   std::string post_storage_addr = config_json["post-storage-service"]["addr"];
   int post_storage_conns = config_json["post-storage-service"]["connections"];
+  int post_storage_min_conns =
+      config_json["post-storage-service"].value("min_connections", 0);
   int post_storage_timeout = config_json["post-storage-service"]["timeout_ms"];
   int post_storage_keepalive =
       config_json["post-storage-service"]["keepalive_ms"];
@@ -38,6 +63,8 @@ int main(int argc, char *argv[]) {
   int user_timeline_port = config_json["user-timeline-service"]["port"];
   std::string user_timeline_addr = config_json["user-timeline-service"]["addr"];
   int user_timeline_conns = config_json["user-timeline-service"]["connections"];
+  int user_timeline_min_conns =
+      config_json["user-timeline-service"].value("min_connections", 0);
   int user_timeline_timeout =
       config_json["user-timeline-service"]["timeout_ms"];
   int user_timeline_keepalive =
@@ -46,69 +73,145 @@ int main(int argc, char *argv[]) {
   int text_port = config_json["text-service"]["port"];
   std::string text_addr = config_json["text-service"]["addr"];
   int text_conns = config_json["text-service"]["connections"];
+  int text_min_conns = config_json["text-service"].value("min_connections", 0);
   int text_timeout = config_json["text-service"]["timeout_ms"];
   int text_keepalive = config_json["text-service"]["keepalive_ms"];
 
   int user_port = config_json["user-service"]["port"];
   std::string user_addr = config_json["user-service"]["addr"];
   int user_conns = config_json["user-service"]["connections"];
+  int user_min_conns = config_json["user-service"].value("min_connections", 0);
   int user_timeout = config_json["user-service"]["timeout_ms"];
   int user_keepalive = config_json["user-service"]["keepalive_ms"];
 
   int media_port = config_json["media-service"]["port"];
   std::string media_addr = config_json["media-service"]["addr"];
   int media_conns = config_json["media-service"]["connections"];
+  int media_min_conns =
+      config_json["media-service"].value("min_connections", 0);
   int media_timeout = config_json["media-service"]["timeout_ms"];
   int media_keepalive = config_json["media-service"]["keepalive_ms"];
 
   int home_timeline_port = config_json["home-timeline-service"]["port"];
   std::string home_timeline_addr = config_json["home-timeline-service"]["addr"];
   int home_timeline_conns = config_json["home-timeline-service"]["connections"];
+  int home_timeline_min_conns =
+      config_json["home-timeline-service"].value("min_connections", 0);
   int home_timeline_timeout =
       config_json["home-timeline-service"]["timeout_ms"];
   int home_timeline_keepalive =
       config_json["home-timeline-service"]["keepalive_ms"];
 
+  // "rpc": WriteHomeTimeline on home-timeline-service, within the request.
+  // "rabbitmq": publish to the write-home-timeline queue, and let
+  // WriteHomeTimelineService do the fan-out.
+  std::string home_timeline_write_mode =
+      compose_post_config.value("home_timeline_write_mode", "rpc");
+  if (home_timeline_write_mode != "rpc" &&
+      home_timeline_write_mode != "rabbitmq") {
+    LOG(error) << "Unknown home_timeline_write_mode "
+               << home_timeline_write_mode;
+    exit(EXIT_FAILURE);
+  }
+
   int unique_id_port = config_json["unique-id-service"]["port"];
   std::string unique_id_addr = config_json["unique-id-service"]["addr"];
   int unique_id_conns = config_json["unique-id-service"]["connections"];
+  int unique_id_min_conns =
+      config_json["unique-id-service"].value("min_connections", 0);
   int unique_id_timeout = config_json["unique-id-service"]["timeout_ms"];
   int unique_id_keepalive = config_json["unique-id-service"]["keepalive_ms"];
+  // Post IDs taken from unique-id-service per ComposeUniqueIds call; 1 keeps
+  // one ComposeUniqueId call per post.
+  int unique_id_lease_size =
+      compose_post_config.value("unique_id_lease_size", 1);
+  int unique_id_lease_ttl_ms =
+      compose_post_config.value("unique_id_lease_ttl_ms", 1000);
+
+  // "remote": ask unique-id-service for post IDs.
+  // "embedded": generate them in process, with a machine ID hashed from the
+  // MAC address of netif and this process's PID.
+  std::string unique_id_mode =
+      compose_post_config.value("unique_id_mode", "remote");
+  std::unique_ptr<UniqueIdGenerator> unique_id_generator;
+  if (unique_id_mode == "embedded") {
+    std::string netif = compose_post_config.value("netif", "eth0");
+    std::string machine_id = GetMachineId(netif);
+    if (machine_id == "") {
+      exit(EXIT_FAILURE);
+    }
+    LOG(info) << "machine_id = " << machine_id;
+    unique_id_generator = std::make_unique<UniqueIdGenerator>(machine_id);
+  } else if (unique_id_mode != "remote") {
+    LOG(error) << "Unknown unique_id_mode " << unique_id_mode;
+    exit(EXIT_FAILURE);
+  }
 
   ClientPool<ThriftClient<PostStorageServiceClient>> post_storage_client_pool(
-      "post-storage-client", post_storage_addr, post_storage_port, 0,
-      post_storage_conns, post_storage_timeout, post_storage_keepalive, config_json);
+      "post-storage-client", post_storage_addr, post_storage_port,
+      post_storage_min_conns, post_storage_conns, post_storage_timeout,
+      post_storage_keepalive, config_json);
   ClientPool<ThriftClient<UserTimelineServiceClient>> user_timeline_client_pool(
-      "user-timeline-client", user_timeline_addr, user_timeline_port, 0,
-      user_timeline_conns, user_timeline_timeout, user_timeline_keepalive, config_json);
+      "user-timeline-client", user_timeline_addr, user_timeline_port,
+      user_timeline_min_conns, user_timeline_conns, user_timeline_timeout,
+      user_timeline_keepalive, config_json);
   ClientPool<ThriftClient<TextServiceClient>> text_client_pool(
-      "text-service-client", text_addr, text_port, 0, text_conns, text_timeout,
-      text_keepalive, config_json);
+      "text-service-client", text_addr, text_port, text_min_conns, text_conns,
+      text_timeout, text_keepalive, config_json);
   ClientPool<ThriftClient<UserServiceClient>> user_client_pool(
-      "user-service-client", user_addr, user_port, 0, user_conns, user_timeout,
-      user_keepalive, config_json);
+      "user-service-client", user_addr, user_port, user_min_conns, user_conns,
+      user_timeout, user_keepalive, config_json);
   ClientPool<ThriftClient<MediaServiceClient>> media_client_pool(
-      "media-service-client", media_addr, media_port, 0, media_conns,
-      media_timeout, media_keepalive, config_json);
+      "media-service-client", media_addr, media_port, media_min_conns,
+      media_conns, media_timeout, media_keepalive, config_json);
   ClientPool<ThriftClient<HomeTimelineServiceClient>> home_timeline_client_pool(
-      "home-timeline-service-client", home_timeline_addr, home_timeline_port, 0,
-      home_timeline_conns, home_timeline_timeout, home_timeline_keepalive, config_json);
+      "home-timeline-service-client", home_timeline_addr, home_timeline_port,
+      home_timeline_min_conns, home_timeline_conns, home_timeline_timeout,
+      home_timeline_keepalive, config_json);
   ClientPool<ThriftClient<UniqueIdServiceClient>> unique_id_client_pool(
-      "unique-id-service-client", unique_id_addr, unique_id_port, 0,
-      unique_id_conns, unique_id_timeout, unique_id_keepalive, config_json);
+      "unique-id-service-client", unique_id_addr, unique_id_port,
+      unique_id_min_conns, unique_id_conns, unique_id_timeout,
+      unique_id_keepalive, config_json);
+
+  std::unique_ptr<ClientPool<RabbitmqClient>> rabbitmq_client_pool;
+  if (home_timeline_write_mode == "rabbitmq") {
+    std::string rabbitmq_addr =
+        config_json["write-home-timeline-rabbitmq"]["addr"];
+    int rabbitmq_port = config_json["write-home-timeline-rabbitmq"]["port"];
+    int rabbitmq_conns =
+        config_json["write-home-timeline-rabbitmq"]["connections"];
+    int rabbitmq_min_conns =
+        config_json["write-home-timeline-rabbitmq"].value("min_connections", 0);
+    int rabbitmq_timeout =
+        config_json["write-home-timeline-rabbitmq"]["timeout_ms"];
+    int rabbitmq_keepalive =
+        config_json["write-home-timeline-rabbitmq"]["keepalive_ms"];
+    rabbitmq_client_pool = std::make_unique<ClientPool<RabbitmqClient>>(
+        "rabbitmq-client", rabbitmq_addr, rabbitmq_port, rabbitmq_min_conns,
+        rabbitmq_conns, rabbitmq_timeout, rabbitmq_keepalive, config_json);
+  }
+
+  Executor executor("compose-post-service", executor_threads,
+                    executor_max_queued);
+
+  TimeoutTable compose_post_timeout_table(timeout_values_path, wait_times_path,
+                                         latency_stats_path, latency_flush_ms);
+  InstallSighupReload();
 
-  std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
-  TThreadedServer server(
+  auto server = get_server(
+      config_json, "compose-post-service",
       std::make_shared<ComposePostServiceProcessor>(
           std::make_shared<ComposePostHandler>(
               &post_storage_client_pool, &user_timeline_client_pool,
               &user_client_pool, &unique_id_client_pool, &media_client_pool,
-              &text_client_pool, &home_timeline_client_pool)),
-      server_socket,
-      std::make_shared<TFramedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
+              &text_client_pool, &home_timeline_client_pool,
+              rabbitmq_client_pool.get(), &compose_post_timeout_table, fanout_deadline_ms,
+              injected_wait_mode, &executor, unique_id_lease_size,
+              unique_id_lease_ttl_ms, unique_id_generator.get())),
+      "0.0.0.0", port);
+  compose_post_timeout_table.Start(timeouts_poll_ms);
   LOG(info) << "Starting the compose-post-service server ...";
   LOG(info) << "Initial update message ...";
-  server.serve();
+  server->serve();
   LOG(info) << "Updated ComposePostService Test ...";
 }
\ No newline at end of file
@@ -3,13 +3,20 @@
 
 #include <SimpleAmqpClient/SimpleAmqpClient.h>
 
+#include <chrono>
+#include <nlohmann/json.hpp>
+#include <string>
+
 #include "../GenericClient.h"
 
 namespace social_network {
+using json = nlohmann::json;
 
+// A channel that publishes to the write-home-timeline queue.
 class RabbitmqClient : public GenericClient {
  public:
-  RabbitmqClient(const std::string &addr, int port);
+  RabbitmqClient(const std::string &addr, int port, int keepalive_ms,
+                 const json &config_json);
   RabbitmqClient(const RabbitmqClient &) = delete;
   RabbitmqClient &operator=(const RabbitmqClient &) = delete;
   RabbitmqClient(RabbitmqClient &&) = default;
@@ -19,54 +26,44 @@ class RabbitmqClient : public GenericClient {
 
   void Connect() override;
   void Disconnect() override;
-  void KeepAlive() override;
-  void KeepAlive(int timeout_ms) override;
   bool IsConnected() override;
 
   AmqpClient::Channel::ptr_t GetChannel();
 
  private:
-  std::string _addr;
-  int _port;
   AmqpClient::Channel::ptr_t _channel;
   bool _is_connected;
 };
 
-RabbitmqClient::RabbitmqClient(const std::string &addr, int port) {
+RabbitmqClient::RabbitmqClient(const std::string &addr, int port,
+                               int keepalive_ms, const json &config_json) {
   _addr = addr;
   _port = port;
-  _channel = AmqpClient::Channel::Create(addr, port);
   _is_connected = false;
+  _connect_timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::system_clock::now().time_since_epoch())
+                           .count();
+  _keepalive_ms = keepalive_ms;
 }
 
 RabbitmqClient::~RabbitmqClient() { Disconnect(); }
 
 void RabbitmqClient::Connect() {
   if (!IsConnected()) {
-    try {
-      _channel->DeclareQueue("write-home-timeline", false, true, false, false);
-    } catch (...) {
-      throw;
-    }
+    _channel = AmqpClient::Channel::Create(_addr, _port);
+    // Same arguments as the consumers in WriteHomeTimelineService: durable,
+    // not exclusive, not auto-deleted.
+    _channel->DeclareQueue("write-home-timeline", false, true, false, false);
     _is_connected = true;
   }
 }
 
 void RabbitmqClient::Disconnect() {
-  if (IsConnected()) {
-    try {
-      _channel->DeleteQueue("write-home-timeline");
-      _is_connected = false;
-    } catch (...) {
-      throw;
-    }
-  }
+  // The queue outlives its publishers; it holds posts not yet fanned out.
+  _channel.reset();
+  _is_connected = false;
 }
 
-void RabbitmqClient::KeepAlive() {}
-
-void RabbitmqClient::KeepAlive(int timeout_ms) {}
-
 bool RabbitmqClient::IsConnected() { return _is_connected; }
 
 AmqpClient::Channel::ptr_t RabbitmqClient::GetChannel() { return _channel; }
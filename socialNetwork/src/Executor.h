@@ -0,0 +1,309 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_EXECUTOR_H
+#define SOCIAL_NETWORK_MICROSERVICES_EXECUTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "logger.h"
+
+namespace social_network {
+
+class Executor;
+
+/*
+ * Result of a task submitted to an Executor.
+ *
+ * get/wait/wait_for/wait_until/valid behave like std::future, so call sites
+ * written against std::async keep working. Unlike a std::async future, the
+ * destructor never blocks. Then() chains a continuation that runs on the
+ * executor once this future is ready.
+ */
+template <class T>
+class Future {
+ public:
+  Future() = default;
+  Future(Future &&) = default;
+  Future &operator=(Future &&) = default;
+
+  T get() { return _future.get(); }
+  bool valid() const { return _future.valid(); }
+  void wait() const { _future.wait(); }
+  template <class Rep, class Period>
+  std::future_status wait_for(
+      const std::chrono::duration<Rep, Period> &timeout) const {
+    return _future.wait_for(timeout);
+  }
+  template <class Clock, class Duration>
+  std::future_status wait_until(
+      const std::chrono::time_point<Clock, Duration> &deadline) const {
+    return _future.wait_until(deadline);
+  }
+
+  // fn receives this future, already ready. This future is left invalid.
+  template <class F>
+  Future<typename std::result_of<F(Future<T>)>::type> Then(F &&fn);
+
+ private:
+  friend class Executor;
+  template <class U>
+  friend class Future;
+
+  struct State {
+    std::mutex mtx;
+    bool done = false;
+    std::vector<std::function<void()>> callbacks;
+
+    void Complete();
+    void OnComplete(std::function<void()> callback);
+  };
+
+  Future(std::future<T> future, std::shared_ptr<State> state,
+         Executor *executor)
+      : _future(std::move(future)),
+        _state(std::move(state)),
+        _executor(executor) {}
+
+  std::future<T> _future;
+  std::shared_ptr<State> _state;
+  Executor *_executor = nullptr;
+};
+
+/*
+ * Bounded work-stealing thread pool shared by the handlers of a service.
+ *
+ * Every worker owns a deque. Tasks submitted from a worker go to the back of
+ * its own deque and are popped LIFO; tasks from other threads are spread
+ * round-robin. An idle worker steals from the front of the other deques.
+ * When max_queued tasks are already waiting, Submit runs the task on the
+ * calling thread instead, which bounds memory and pushes back on the caller.
+ */
+class Executor {
+ public:
+  Executor(const std::string &name, int num_threads, int max_queued);
+  ~Executor();
+
+  Executor(const Executor &) = delete;
+  Executor &operator=(const Executor &) = delete;
+
+  template <class F>
+  Future<typename std::result_of<F()>::type> Submit(F &&fn);
+  void Post(std::function<void()> task);
+  int NumThreads() const;
+
+ private:
+  struct Worker {
+    std::mutex mtx;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::string _name;
+  int _max_queued;
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::vector<std::thread> _threads;
+
+  std::mutex _mtx;
+  std::condition_variable _cv;
+  std::atomic<int> _queued;
+  std::atomic<unsigned> _next;
+  std::atomic<bool> _stopped;
+
+  static Executor *&_CurrentExecutor();
+  static int &_CurrentWorker();
+
+  bool _Pop(int index, std::function<void()> &task);
+  bool _Steal(int index, std::function<void()> &task);
+  void _Run(int index);
+};
+
+template <class T>
+void Future<T>::State::Complete() {
+  std::vector<std::function<void()>> pending;
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    done = true;
+    pending.swap(callbacks);
+  }
+  for (auto &callback : pending) {
+    callback();
+  }
+}
+
+template <class T>
+void Future<T>::State::OnComplete(std::function<void()> callback) {
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (!done) {
+      callbacks.emplace_back(std::move(callback));
+      return;
+    }
+  }
+  callback();
+}
+
+template <class T>
+template <class F>
+Future<typename std::result_of<F(Future<T>)>::type> Future<T>::Then(F &&fn) {
+  using R = typename std::result_of<F(Future<T>)>::type;
+  auto executor = _executor;
+  auto prev_state = _state;
+  auto prev = std::make_shared<Future<T>>(std::move(*this));
+  auto task = std::make_shared<std::packaged_task<R()>>(
+      [prev, fn = std::forward<F>(fn)]() mutable {
+        return fn(std::move(*prev));
+      });
+  auto next_state = std::make_shared<typename Future<R>::State>();
+  Future<R> next(task->get_future(), next_state, executor);
+  prev_state->OnComplete([executor, task, next_state]() {
+    executor->Post([task, next_state]() {
+      (*task)();
+      next_state->Complete();
+    });
+  });
+  return next;
+}
+
+Executor::Executor(const std::string &name, int num_threads,
+                   int max_queued) {
+  _name = name;
+  _max_queued = max_queued;
+  _queued = 0;
+  _next = 0;
+  _stopped = false;
+  if (num_threads <= 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    _workers.emplace_back(new Worker);
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    _threads.emplace_back(&Executor::_Run, this, i);
+  }
+  LOG(info) << "Started executor " << _name << " with " << num_threads
+            << " threads";
+}
+
+Executor::~Executor() {
+  {
+    std::unique_lock<std::mutex> lock(_mtx);
+    _stopped = true;
+  }
+  _cv.notify_all();
+  for (auto &thread : _threads) {
+    thread.join();
+  }
+}
+
+template <class F>
+Future<typename std::result_of<F()>::type> Executor::Submit(F &&fn) {
+  using R = typename std::result_of<F()>::type;
+  using State = typename Future<R>::State;
+  auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+  auto state = std::make_shared<State>();
+  Future<R> future(task->get_future(), state, this);
+  Post([task, state]() {
+    (*task)();
+    state->Complete();
+  });
+  return future;
+}
+
+void Executor::Post(std::function<void()> task) {
+  if (_max_queued > 0 && _queued.load(std::memory_order_relaxed) >=
+      _max_queued) {
+    task();
+    return;
+  }
+  int index;
+  if (_CurrentExecutor() == this) {
+    index = _CurrentWorker();
+  } else {
+    index = _next.fetch_add(1, std::memory_order_relaxed) % _workers.size();
+  }
+  {
+    std::unique_lock<std::mutex> lock(_workers[index]->mtx);
+    _workers[index]->tasks.emplace_back(std::move(task));
+    _queued.fetch_add(1);
+  }
+  {
+    // Taking the lock orders the increment with a worker about to sleep.
+    std::unique_lock<std::mutex> lock(_mtx);
+  }
+  _cv.notify_one();
+}
+
+int Executor::NumThreads() const { return _threads.size(); }
+
+Executor *&Executor::_CurrentExecutor() {
+  static thread_local Executor *executor = nullptr;
+  return executor;
+}
+
+int &Executor::_CurrentWorker() {
+  static thread_local int index = -1;
+  return index;
+}
+
+bool Executor::_Pop(int index, std::function<void()> &task) {
+  auto &worker = _workers[index];
+  std::unique_lock<std::mutex> lock(worker->mtx);
+  if (worker->tasks.empty()) {
+    return false;
+  }
+  task = std::move(worker->tasks.back());
+  worker->tasks.pop_back();
+  _queued.fetch_sub(1);
+  return true;
+}
+
+bool Executor::_Steal(int index, std::function<void()> &task) {
+  for (int i = 1; i < _workers.size(); ++i) {
+    auto &victim = _workers[(index + i) % _workers.size()];
+    std::unique_lock<std::mutex> lock(victim->mtx, std::try_to_lock);
+    if (!lock.owns_lock() || victim->tasks.empty()) {
+      continue;
+    }
+    task = std::move(victim->tasks.front());
+    victim->tasks.pop_front();
+    _queued.fetch_sub(1);
+    return true;
+  }
+  return false;
+}
+
+void Executor::_Run(int index) {
+  _CurrentExecutor() = this;
+  _CurrentWorker() = index;
+  while (true) {
+    std::function<void()> task;
+    if (_Pop(index, task) || _Steal(index, task)) {
+      try {
+        task();
+      } catch (...) {
+        // Submit() captures exceptions in the future; this only catches
+        // exceptions escaping a raw Post().
+        LOG(error) << "Uncaught exception in executor " << _name;
+      }
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(_mtx);
+    if (_stopped && _queued == 0) {
+      return;
+    }
+    _cv.wait(lock, [this]() { return _queued > 0 || _stopped; });
+  }
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_EXECUTOR_H
@@ -0,0 +1,60 @@
+// Compares the per-call cost of std::async(std::launch::async), which creates
+// a thread for every call, with submitting the same task to an Executor.
+//
+// Usage: ExecutorBenchmark [num_tasks] [num_threads] [batch_size]
+
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Executor.h"
+#include "../logger.h"
+
+using namespace social_network;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+template <class Launch>
+double Run(int num_tasks, int batch_size, Launch launch) {
+  std::atomic<int64_t> sum(0);
+  auto start = steady_clock::now();
+  for (int i = 0; i < num_tasks; i += batch_size) {
+    // Keep batch_size calls in flight, like a handler fanning out sub-calls.
+    std::vector<decltype(launch(sum, i))> futures;
+    for (int j = i; j < i + batch_size && j < num_tasks; ++j) {
+      futures.emplace_back(launch(sum, j));
+    }
+    for (auto &future : futures) {
+      future.get();
+    }
+  }
+  auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start);
+  return double(elapsed.count()) / num_tasks;
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+  int num_tasks = argc > 1 ? std::stoi(argv[1]) : 100000;
+  int num_threads = argc > 2 ? std::stoi(argv[2]) : 0;
+  int batch_size = argc > 3 ? std::stoi(argv[3]) : 4;
+
+  auto async_ns = Run(num_tasks, batch_size, [](std::atomic<int64_t> &sum,
+                                                int i) {
+    return std::async(std::launch::async, [&sum, i]() { sum += i; });
+  });
+
+  Executor executor("benchmark", num_threads, 0);
+  auto executor_ns = Run(num_tasks, batch_size,
+                         [&executor](std::atomic<int64_t> &sum, int i) {
+    return executor.Submit([&sum, i]() { sum += i; });
+  });
+
+  std::cout << "tasks=" << num_tasks << " batch=" << batch_size
+            << " executor_threads=" << executor.NumThreads() << std::endl;
+  std::cout << "std::async:        " << async_ns << " ns/task" << std::endl;
+  std::cout << "Executor::Submit:  " << executor_ns << " ns/task" << std::endl;
+  return 0;
+}
@@ -0,0 +1,154 @@
+// Runs the write-home-timeline consumers on a LocalMessageQueue, so the
+// asynchronous fan-out path can be measured on one machine without RabbitMQ,
+// Redis or the social graph. The home timeline write is replaced by a sleep
+// of write_us per batch, standing in for one round trip of pipelines.
+//
+// Reports throughput and the latency from publish to write, once with every
+// message written alone and once with batches of up to batch_size.
+//
+// Usage: FanoutQueueBenchmark [num_messages] [producers] [consumers]
+//                             [batch_size] [prefetch] [write_us]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../MessageQueue.h"
+#include "../WriteHomeTimelineService/HomeTimelineConsumer.h"
+#include "../logger.h"
+
+using namespace social_network;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+struct Options {
+  int num_messages;
+  int producers;
+  int consumers;
+  int batch_size;
+  int prefetch;
+  int write_us;
+};
+
+struct Result {
+  double msgs_per_sec;
+  double p50_us;
+  double p99_us;
+};
+
+int64_t NowNs() {
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void Produce(LocalMessageQueue *queue, int begin, int end) {
+  HomeTimelineMessage msg;
+  msg.user_mentions_id = {1001, 1002};
+  msg.carrier["uber-trace-id"] = "4bf92f3577b34da6:a3ce929d0e0e4736:0:1";
+  for (int i = begin; i < end; ++i) {
+    msg.req_id = i;
+    msg.post_id = i;
+    msg.user_id = i % 1000;
+    // Not a post timestamp here: the publish time that latency is measured
+    // from.
+    msg.timestamp = NowNs();
+    auto body = encode_home_timeline_message(msg);
+    while (!queue->Publish(body)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+Result Run(const Options &options, int batch_size) {
+  LocalMessageQueue queue(65536);
+  std::vector<std::unique_ptr<LocalMessageQueueConsumer>> queue_consumers;
+  for (int i = 0; i < options.consumers; ++i) {
+    queue_consumers.emplace_back(
+        new LocalMessageQueueConsumer(&queue, options.prefetch));
+  }
+  std::vector<std::vector<int64_t>> latencies(options.consumers);
+  std::atomic<int> written(0);
+
+  auto start = steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < options.consumers; ++i) {
+    threads.emplace_back([&, i]() {
+      auto &consumer_latencies = latencies[i];
+      HomeTimelineConsumer consumer(
+          queue_consumers[i].get(),
+          [&](const std::vector<HomeTimelineMessage> &msgs) {
+            if (options.write_us > 0) {
+              std::this_thread::sleep_for(microseconds(options.write_us));
+            }
+            int64_t now = NowNs();
+            for (auto &msg : msgs) {
+              consumer_latencies.push_back(now - msg.timestamp);
+            }
+            if (written.fetch_add(msgs.size()) + int(msgs.size()) >=
+                options.num_messages) {
+              for (auto &queue_consumer : queue_consumers) {
+                queue_consumer->Stop();
+              }
+            }
+          },
+          batch_size, 1, 1, 1);
+      consumer.Run();
+    });
+  }
+  int per_producer = (options.num_messages + options.producers - 1) /
+                     options.producers;
+  for (int i = 0; i < options.producers; ++i) {
+    int begin = i * per_producer;
+    int end = std::min(begin + per_producer, options.num_messages);
+    threads.emplace_back(Produce, &queue, begin, end);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start);
+
+  std::vector<int64_t> all;
+  for (auto &consumer_latencies : latencies) {
+    all.insert(all.end(), consumer_latencies.begin(), consumer_latencies.end());
+  }
+  std::sort(all.begin(), all.end());
+  Result result;
+  result.msgs_per_sec = double(all.size()) * 1e9 / elapsed.count();
+  result.p50_us = all.empty() ? 0 : all[all.size() / 2] / 1000.0;
+  result.p99_us = all.empty() ? 0 : all[all.size() * 99 / 100] / 1000.0;
+  return result;
+}
+
+void Print(const std::string &name, const Result &result) {
+  std::cout << name << ": " << result.msgs_per_sec << " msgs/s, p50 "
+            << result.p50_us << " us, p99 " << result.p99_us << " us"
+            << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+  Options options;
+  options.num_messages = argc > 1 ? std::stoi(argv[1]) : 200000;
+  options.producers = std::max(argc > 2 ? std::stoi(argv[2]) : 2, 1);
+  options.consumers = std::max(argc > 3 ? std::stoi(argv[3]) : 4, 1);
+  options.batch_size = std::max(argc > 4 ? std::stoi(argv[4]) : 64, 1);
+  options.prefetch = std::max(argc > 5 ? std::stoi(argv[5]) : 256, 1);
+  options.write_us = argc > 6 ? std::stoi(argv[6]) : 50;
+
+  std::cout << "messages=" << options.num_messages
+            << " producers=" << options.producers
+            << " consumers=" << options.consumers
+            << " prefetch=" << options.prefetch
+            << " write_us=" << options.write_us << std::endl;
+  Print("batch=1", Run(options, 1));
+  Print("batch=" + std::to_string(options.batch_size),
+        Run(options, options.batch_size));
+  return 0;
+}
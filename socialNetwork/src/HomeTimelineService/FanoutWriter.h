@@ -0,0 +1,239 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_HOMETIMELINESERVICE_FANOUTWRITER_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_HOMETIMELINESERVICE_FANOUTWRITER_H_
+
+#include <sw/redis++/redis++.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Executor.h"
+#include "../logger.h"
+
+using namespace sw::redis;
+namespace social_network {
+
+// Redis Cluster hash slot of key: CRC16/XMODEM of the key, or of its hash
+// tag (the part between the first '{' and the next '}', if not empty),
+// modulo 16384.
+uint16_t redis_key_slot(const std::string &key) {
+  size_t begin = 0;
+  size_t end = key.size();
+  size_t open = key.find('{');
+  if (open != std::string::npos) {
+    size_t close = key.find('}', open + 1);
+    if (close != std::string::npos && close > open + 1) {
+      begin = open + 1;
+      end = close;
+    }
+  }
+  uint16_t crc = 0;
+  for (size_t i = begin; i < end; ++i) {
+    crc ^= static_cast<uint16_t>(static_cast<uint8_t>(key[i])) << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021)
+                           : static_cast<uint16_t>(crc << 1);
+    }
+  }
+  return crc & 0x3fff;
+}
+
+// A post and the home timelines it goes to.
+struct FanoutPost {
+  std::vector<int64_t> user_ids;
+  std::string post_id_str;
+  int64_t timestamp;
+};
+
+/*
+ * Adds posts to the home timelines of many users.
+ *
+ * Keys are grouped by the Redis node that owns their hash slot, and every
+ * group is cut into pipelines of at most chunk_size users, so one post from a
+ * popular user never queues millions of replies on a single connection.
+ * Up to max_in_flight pipelines run at once on the executor. With
+ * max_timeline_len > 0 every ZADD is followed by a ZREMRANGEBYRANK that keeps
+ * only the newest max_timeline_len posts of that timeline.
+ */
+class FanoutWriter {
+ public:
+  FanoutWriter(Redis *redis, Executor *executor, int chunk_size,
+               int max_in_flight, int64_t max_timeline_len);
+  FanoutWriter(RedisCluster *redis_cluster, Executor *executor,
+               int chunk_size, int max_in_flight, int64_t max_timeline_len);
+
+  // Zset key: user_id, Zset value: post_id_str, Zset score: timestamp.
+  // Throws the first error after every pipeline has finished.
+  void Write(const std::vector<int64_t> &user_ids,
+             const std::string &post_id_str, int64_t timestamp);
+  // Writes several posts with shared pipelines.
+  void Write(const std::vector<FanoutPost> &posts);
+
+ private:
+  // One ZADD: the timeline key and the post it gets.
+  struct Entry {
+    std::string key;
+    const FanoutPost *post;
+  };
+  struct Chunk {
+    const std::vector<Entry> *entries;
+    size_t begin;
+    size_t end;
+  };
+
+  Redis *_redis;
+  RedisCluster *_redis_cluster;
+  Executor *_executor;
+  size_t _chunk_size;
+  size_t _max_in_flight;
+  int64_t _max_timeline_len;
+
+  std::vector<std::vector<Entry>> _GroupByNode(
+      const std::vector<FanoutPost> &posts);
+  void _WriteChunk(const Chunk &chunk);
+};
+
+FanoutWriter::FanoutWriter(Redis *redis, Executor *executor, int chunk_size,
+                           int max_in_flight, int64_t max_timeline_len) {
+  _redis = redis;
+  _redis_cluster = nullptr;
+  _executor = executor;
+  _chunk_size = std::max(chunk_size, 1);
+  _max_in_flight = std::max(max_in_flight, 1);
+  _max_timeline_len = max_timeline_len;
+}
+
+FanoutWriter::FanoutWriter(RedisCluster *redis_cluster, Executor *executor,
+                           int chunk_size, int max_in_flight,
+                           int64_t max_timeline_len) {
+  _redis = nullptr;
+  _redis_cluster = redis_cluster;
+  _executor = executor;
+  _chunk_size = std::max(chunk_size, 1);
+  _max_in_flight = std::max(max_in_flight, 1);
+  _max_timeline_len = max_timeline_len;
+}
+
+void FanoutWriter::Write(const std::vector<int64_t> &user_ids,
+                         const std::string &post_id_str, int64_t timestamp) {
+  if (user_ids.empty()) {
+    return;
+  }
+  Write(std::vector<FanoutPost>{{user_ids, post_id_str, timestamp}});
+}
+
+void FanoutWriter::Write(const std::vector<FanoutPost> &posts) {
+  auto groups = _GroupByNode(posts);
+  std::vector<Chunk> chunks;
+  for (auto &entries : groups) {
+    for (size_t begin = 0; begin < entries.size(); begin += _chunk_size) {
+      size_t end = std::min(begin + _chunk_size, entries.size());
+      chunks.push_back({&entries, begin, end});
+    }
+  }
+  if (chunks.size() <= 1 || _max_in_flight == 1) {
+    for (auto &chunk : chunks) {
+      _WriteChunk(chunk);
+    }
+    return;
+  }
+
+  // The tasks reference chunks, groups and posts, so every one of them is
+  // waited for before returning, even after a failure.
+  std::deque<Future<void>> in_flight;
+  std::exception_ptr error;
+  auto wait_oldest = [&]() {
+    try {
+      in_flight.front().get();
+    } catch (...) {
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+    in_flight.pop_front();
+  };
+  for (auto &chunk : chunks) {
+    if (in_flight.size() >= _max_in_flight) {
+      wait_oldest();
+    }
+    in_flight.emplace_back(
+        _executor->Submit([this, &chunk]() { _WriteChunk(chunk); }));
+  }
+  while (!in_flight.empty()) {
+    wait_oldest();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+std::vector<std::vector<FanoutWriter::Entry>> FanoutWriter::_GroupByNode(
+    const std::vector<FanoutPost> &posts) {
+  std::vector<std::vector<Entry>> groups;
+  if (_redis) {
+    size_t size = 0;
+    for (auto &post : posts) {
+      size += post.user_ids.size();
+    }
+    groups.emplace_back();
+    groups[0].reserve(size);
+    for (auto &post : posts) {
+      for (auto user_id : post.user_ids) {
+        groups[0].push_back({std::to_string(user_id), &post});
+      }
+    }
+    return groups;
+  }
+
+  // Look the node up once per hash slot rather than once per key.
+  auto *shards_pool = _redis_cluster->get_shards_pool();
+  std::unordered_map<uint16_t, size_t> slot_groups;
+  std::map<std::shared_ptr<ConnectionPool>, size_t> node_groups;
+  for (auto &post : posts) {
+    for (auto user_id : post.user_ids) {
+      std::string key = std::to_string(user_id);
+      uint16_t slot = redis_key_slot(key);
+      auto it = slot_groups.find(slot);
+      if (it == slot_groups.end()) {
+        auto node = node_groups.emplace(shards_pool->fetch(key), groups.size());
+        if (node.second) {
+          groups.emplace_back();
+        }
+        it = slot_groups.emplace(slot, node.first->second).first;
+      }
+      groups[it->second].push_back({std::move(key), &post});
+    }
+  }
+  return groups;
+}
+
+void FanoutWriter::_WriteChunk(const Chunk &chunk) {
+  auto &entries = *chunk.entries;
+  auto pipe = _redis
+                  ? _redis->pipeline(false)
+                  : _redis_cluster->pipeline(entries[chunk.begin].key, false);
+  for (size_t i = chunk.begin; i < chunk.end; ++i) {
+    auto &entry = entries[i];
+    pipe.zadd(entry.key, entry.post->post_id_str, entry.post->timestamp,
+              UpdateType::NOT_EXIST);
+    if (_max_timeline_len > 0) {
+      pipe.zremrangebyrank(entry.key, 0, -(_max_timeline_len + 1));
+    }
+  }
+  try {
+    pipe.exec();
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw;
+  }
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_SRC_HOMETIMELINESERVICE_FANOUTWRITER_H_
@@ -3,35 +3,53 @@
 
 #include <sw/redis++/redis++.h>
 
+#include <algorithm>
+#include <chrono>
 #include <future>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "../../gen-cpp/HomeTimelineService.h"
 #include "../../gen-cpp/PostStorageService.h"
 #include "../../gen-cpp/SocialGraphService.h"
+#include "../../gen-cpp/UserTimelineService.h"
 #include "../ClientPool.h"
+#include "../Executor.h"
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "FanoutWriter.h"
+#include "TimelineMerge.h"
 
 using namespace sw::redis;
+
+#define HIGH_FANOUT_FOLLOWEES_CACHE_SIZE 100000
+
 namespace social_network {
 class HomeTimelineHandler : public HomeTimelineServiceIf {
  public:
   HomeTimelineHandler(Redis *,
                       ClientPool<ThriftClient<PostStorageServiceClient>> *,
-                      ClientPool<ThriftClient<SocialGraphServiceClient>> *);
+                      ClientPool<ThriftClient<SocialGraphServiceClient>> *,
+                      ClientPool<ThriftClient<UserTimelineServiceClient>> *,
+                      Executor *, FanoutWriter *, int, int64_t, int);
 
 
   HomeTimelineHandler(Redis *,Redis *,
       ClientPool<ThriftClient<PostStorageServiceClient>>*,
-      ClientPool<ThriftClient<SocialGraphServiceClient>>*);
+      ClientPool<ThriftClient<SocialGraphServiceClient>>*,
+      ClientPool<ThriftClient<UserTimelineServiceClient>>*,
+      Executor *, FanoutWriter *, int, int64_t, int);
 
 
   HomeTimelineHandler(RedisCluster *,
                       ClientPool<ThriftClient<PostStorageServiceClient>> *,
-                      ClientPool<ThriftClient<SocialGraphServiceClient>> *);
+                      ClientPool<ThriftClient<SocialGraphServiceClient>> *,
+                      ClientPool<ThriftClient<UserTimelineServiceClient>> *,
+                      Executor *, FanoutWriter *, int, int64_t, int);
   ~HomeTimelineHandler() override = default;
 
   bool IsRedisReplicationEnabled();
@@ -50,32 +68,85 @@ class HomeTimelineHandler : public HomeTimelineServiceIf {
      RedisCluster *_redis_cluster_client_pool;
      ClientPool<ThriftClient<PostStorageServiceClient>> *_post_client_pool;
      ClientPool<ThriftClient<SocialGraphServiceClient>> *_social_graph_client_pool;
+     ClientPool<ThriftClient<UserTimelineServiceClient>> *_user_timeline_client_pool;
+     Executor *_executor;
+     FanoutWriter *_fanout_writer;
+     int _followers_page_size;
+     // Posts of users with at least this many followers are not pushed to
+     // home timelines but merged in by ReadHomeTimeline. 0 pushes all posts.
+     int64_t _fanout_threshold;
+     // How long the high-fanout followees of a user are reused by
+     // ReadHomeTimeline before social-graph-service is asked again. A user
+     // who crosses _fanout_threshold is merged or pushed by the wrong path
+     // for at most this long. 0 asks on every read.
+     std::chrono::milliseconds _high_fanout_followees_ttl;
+
+     struct CachedFollowees {
+       std::vector<int64_t> followees;
+       std::chrono::steady_clock::time_point expiry;
+     };
+     std::mutex _high_fanout_followees_mtx;
+     std::unordered_map<int64_t, CachedFollowees> _high_fanout_followees;
+
+     void _WriteHomeTimelines(const std::vector<int64_t> &, const std::string &,
+                              int64_t, opentracing::Span *);
+     std::vector<int64_t> _GetHighFanoutFollowees(
+         int64_t, int64_t, const std::map<std::string, std::string> &);
+     void _ReadMergedHomeTimeline(std::vector<Post> &, int64_t, int64_t, int,
+                                  int, const std::vector<int64_t> &,
+                                  const std::map<std::string, std::string> &);
+     std::vector<TimelineEntry> _ReadUserTimelineEntries(
+         int64_t, int64_t, int, const std::map<std::string, std::string> &);
+     void _ReadPosts(std::vector<Post> &, int64_t, const std::vector<int64_t> &,
+                     const std::map<std::string, std::string> &);
 };
 
 HomeTimelineHandler::HomeTimelineHandler(
     Redis *redis_pool,
     ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool,
     ClientPool<ThriftClient<SocialGraphServiceClient>>
-        *social_graph_client_pool) {
+        *social_graph_client_pool,
+    ClientPool<ThriftClient<UserTimelineServiceClient>>
+        *user_timeline_client_pool,
+    Executor *executor, FanoutWriter *fanout_writer, int followers_page_size,
+    int64_t fanout_threshold, int high_fanout_followees_ttl_ms) {
     _redis_primary_pool = nullptr;
     _redis_replica_pool = nullptr;
     _redis_client_pool = redis_pool;
     _redis_cluster_client_pool = nullptr;
     _post_client_pool = post_client_pool;
     _social_graph_client_pool = social_graph_client_pool;
+    _user_timeline_client_pool = user_timeline_client_pool;
+    _executor = executor;
+    _fanout_writer = fanout_writer;
+    _followers_page_size = followers_page_size;
+    _fanout_threshold = fanout_threshold;
+    _high_fanout_followees_ttl =
+        std::chrono::milliseconds(high_fanout_followees_ttl_ms);
 }
 
 HomeTimelineHandler::HomeTimelineHandler(
     RedisCluster *redis_pool,
     ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool,
     ClientPool<ThriftClient<SocialGraphServiceClient>>
-        *social_graph_client_pool) {
+        *social_graph_client_pool,
+    ClientPool<ThriftClient<UserTimelineServiceClient>>
+        *user_timeline_client_pool,
+    Executor *executor, FanoutWriter *fanout_writer, int followers_page_size,
+    int64_t fanout_threshold, int high_fanout_followees_ttl_ms) {
     _redis_primary_pool = nullptr;
     _redis_replica_pool = nullptr;
     _redis_client_pool = nullptr;
     _redis_cluster_client_pool = redis_pool; 
     _post_client_pool = post_client_pool;
     _social_graph_client_pool = social_graph_client_pool;
+    _user_timeline_client_pool = user_timeline_client_pool;
+    _executor = executor;
+    _fanout_writer = fanout_writer;
+    _followers_page_size = followers_page_size;
+    _fanout_threshold = fanout_threshold;
+    _high_fanout_followees_ttl =
+        std::chrono::milliseconds(high_fanout_followees_ttl_ms);
 }
 
 HomeTimelineHandler::HomeTimelineHandler(
@@ -83,13 +154,24 @@ HomeTimelineHandler::HomeTimelineHandler(
     Redis *redis_primary_pool,
     ClientPool<ThriftClient<PostStorageServiceClient>>* post_client_pool,
     ClientPool<ThriftClient<SocialGraphServiceClient>>
-    * social_graph_client_pool) {
+    * social_graph_client_pool,
+    ClientPool<ThriftClient<UserTimelineServiceClient>>
+    * user_timeline_client_pool,
+    Executor* executor, FanoutWriter* fanout_writer, int followers_page_size,
+    int64_t fanout_threshold, int high_fanout_followees_ttl_ms) {
     _redis_primary_pool = redis_primary_pool;
     _redis_replica_pool = redis_replica_pool;
     _redis_client_pool = nullptr;
     _redis_cluster_client_pool = nullptr;
     _post_client_pool = post_client_pool;
     _social_graph_client_pool = social_graph_client_pool;
+    _user_timeline_client_pool = user_timeline_client_pool;
+    _executor = executor;
+    _fanout_writer = fanout_writer;
+    _followers_page_size = followers_page_size;
+    _fanout_threshold = fanout_threshold;
+    _high_fanout_followees_ttl =
+        std::chrono::milliseconds(high_fanout_followees_ttl_ms);
 }
 
 bool HomeTimelineHandler::IsRedisReplicationEnabled() {
@@ -106,12 +188,11 @@ void HomeTimelineHandler::WriteHomeTimeline(
   auto span = opentracing::Tracer::Global()->StartSpan(
       "write_home_timeline_server", {opentracing::ChildOf(parent_span->get())});
 
-  // Find followers of the user
-  auto followers_span = opentracing::Tracer::Global()->StartSpan(
-      "get_followers_client", {opentracing::ChildOf(&span->context())});
-  std::map<std::string, std::string> writer_text_map;
-  TextMapWriter writer(writer_text_map);
-  opentracing::Tracer::Global()->Inject(followers_span->context(), writer);
+  std::string post_id_str = std::to_string(post_id);
+
+  // A mentioned user who also follows the author is written twice, which
+  // ZADD NX makes harmless.
+  _WriteHomeTimelines(user_mentions_id, post_id_str, timestamp, span.get());
 
   auto social_graph_client_wrapper = _social_graph_client_pool->Pop();
   if (!social_graph_client_wrapper) {
@@ -121,96 +202,81 @@ void HomeTimelineHandler::WriteHomeTimeline(
     throw se;
   }
   auto social_graph_client = social_graph_client_wrapper->GetClient();
+
+  if (_fanout_threshold > 0) {
+    std::map<std::string, std::string> writer_text_map;
+    TextMapWriter writer(writer_text_map);
+    opentracing::Tracer::Global()->Inject(span->context(), writer);
+    int64_t followers_count;
+    try {
+      followers_count = social_graph_client->GetFollowerCount(
+          req_id, user_id, writer_text_map);
+    } catch (...) {
+      LOG(error) << "Failed to get follower count from social-network-service";
+      _social_graph_client_pool->Remove(social_graph_client_wrapper);
+      throw;
+    }
+    if (followers_count >= _fanout_threshold) {
+      // Followers pull this post from the user timeline when they read
+      // their home timeline.
+      _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
+      span->Finish();
+      return;
+    }
+  }
+
+  // Fetch the followers a page at a time and write each page before asking
+  // for the next one, so a user with millions of followers neither holds
+  // the whole list in memory nor waits for it before the first write.
   std::vector<int64_t> followers_id;
-  try {
-    social_graph_client->GetFollowers(followers_id, req_id, user_id,
-                                      writer_text_map);
-  } catch (...) {
-    LOG(error) << "Failed to get followers from social-network-service";
-    _social_graph_client_pool->Remove(social_graph_client_wrapper);
-    throw;
+  for (int64_t cursor = 0;; cursor = followers_id.back() + 1) {
+    auto followers_span = opentracing::Tracer::Global()->StartSpan(
+        "get_followers_page_client", {opentracing::ChildOf(&span->context())});
+    std::map<std::string, std::string> writer_text_map;
+    TextMapWriter writer(writer_text_map);
+    opentracing::Tracer::Global()->Inject(followers_span->context(), writer);
+    followers_id.clear();
+    try {
+      social_graph_client->GetFollowersPage(followers_id, req_id, user_id,
+                                            cursor, _followers_page_size,
+                                            writer_text_map);
+    } catch (...) {
+      LOG(error) << "Failed to get followers from social-network-service";
+      _social_graph_client_pool->Remove(social_graph_client_wrapper);
+      throw;
+    }
+    followers_span->Finish();
+
+    try {
+      _WriteHomeTimelines(followers_id, post_id_str, timestamp, span.get());
+    } catch (...) {
+      _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
+      throw;
+    }
+    if (followers_id.size() < static_cast<size_t>(_followers_page_size)) {
+      break;
+    }
   }
   _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
-  followers_span->Finish();
-
-  std::set<int64_t> followers_id_set(followers_id.begin(), followers_id.end());
-  followers_id_set.insert(user_mentions_id.begin(), user_mentions_id.end());
+  span->Finish();
+}
 
-  // Update Redis ZSet
-  // Zset key: follower_id, Zset value: post_id_str, Zset score: timestamp_str
+// Adds post_id_str to the home timelines of user_ids, see FanoutWriter.
+// Zset key: follower_id, Zset value: post_id_str, Zset score: timestamp_str
+void HomeTimelineHandler::_WriteHomeTimelines(
+    const std::vector<int64_t> &user_ids, const std::string &post_id_str,
+    int64_t timestamp, opentracing::Span *parent_span) {
+  if (user_ids.empty()) {
+    return;
+  }
   auto redis_span = opentracing::Tracer::Global()->StartSpan(
       "write_home_timeline_redis_update_client",
-      {opentracing::ChildOf(&span->context())});
-  std::string post_id_str = std::to_string(post_id);
+      {opentracing::ChildOf(&parent_span->context())});
 
-  {
-    if (_redis_client_pool) {
-      auto pipe = _redis_client_pool->pipeline(false);
-      for (auto &follower_id : followers_id_set) {
-        pipe.zadd(std::to_string(follower_id), post_id_str, timestamp,
-                  UpdateType::NOT_EXIST);
-      }
-      try {
-        auto replies = pipe.exec();
-      } catch (const Error &err) {
-        LOG(error) << err.what();
-        throw err;
-      }
-    }
-    
-    else if (IsRedisReplicationEnabled()) {
-        auto pipe = _redis_primary_pool->pipeline(false);
-        for (auto& follower_id : followers_id_set) {
-            pipe.zadd(std::to_string(follower_id), post_id_str, timestamp,
-                UpdateType::NOT_EXIST);
-        }
-        try {
-            auto replies = pipe.exec();
-        }
-        catch (const Error& err) {
-            LOG(error) << err.what();
-            throw err;
-        }
-    }
-    
-    else {
-      // Create multi-pipeline that match with shards pool
-      std::map<std::shared_ptr<ConnectionPool>, std::shared_ptr<Pipeline>> pipe_map;
-      auto *shards_pool = _redis_cluster_client_pool->get_shards_pool();
-
-      for (auto &follower_id : followers_id_set) {
-        auto conn = shards_pool->fetch(std::to_string(follower_id));
-        auto pipe = pipe_map.find(conn);
-        if(pipe == pipe_map.end()) {//Not found, create new pipeline and insert
-          auto new_pipe = std::make_shared<Pipeline>(_redis_cluster_client_pool->pipeline(std::to_string(follower_id), false));
-          pipe_map.insert(make_pair(conn, new_pipe));
-          auto *_pipe = new_pipe.get();
-          _pipe->zadd(std::to_string(follower_id), post_id_str, timestamp,
-                  UpdateType::NOT_EXIST);
-        }else{//Found, use exist pipeline
-          std::pair<std::shared_ptr<ConnectionPool>, std::shared_ptr<Pipeline>> found = *pipe;
-          auto *_pipe = found.second.get();
-          _pipe->zadd(std::to_string(follower_id), post_id_str, timestamp,
-                  UpdateType::NOT_EXIST);
-        }
-      }
-      // LOG(info) <<"followers_id_set items:" << followers_id_set.size()<<"; pipeline items:" << pipe_map.size();
-      try {
-        for(auto const &it : pipe_map) {
-          auto _pipe = it.second.get();
-          _pipe->exec();
-        }
-
-      } catch (const Error &err) {
-        LOG(error) << err.what();
-        throw err;
-      }
-    }
-  }
+  _fanout_writer->Write(user_ids, post_id_str, timestamp);
   redis_span->Finish();
 }
 
-
 void HomeTimelineHandler::ReadHomeTimeline(
     std::vector<Post> &_return, int64_t req_id, int64_t user_id, int start_idx,
     int stop_idx, const std::map<std::string, std::string> &carrier) {
@@ -227,6 +293,17 @@ void HomeTimelineHandler::ReadHomeTimeline(
     return;
   }
 
+  if (_fanout_threshold > 0) {
+    auto high_fanout_followees =
+        _GetHighFanoutFollowees(req_id, user_id, writer_text_map);
+    if (!high_fanout_followees.empty()) {
+      _ReadMergedHomeTimeline(_return, req_id, user_id, start_idx, stop_idx,
+                              high_fanout_followees, writer_text_map);
+      span->Finish();
+      return;
+    }
+  }
+
   auto redis_span = opentracing::Tracer::Global()->StartSpan(
       "read_home_timeline_redis_find_client",
       {opentracing::ChildOf(&span->context())});
@@ -260,6 +337,192 @@ void HomeTimelineHandler::ReadHomeTimeline(
     post_ids.emplace_back(std::stoul(post_id_str));
   }
 
+  _ReadPosts(_return, req_id, post_ids, writer_text_map);
+  span->Finish();
+}
+
+std::vector<int64_t> HomeTimelineHandler::_GetHighFanoutFollowees(
+    int64_t req_id, int64_t user_id,
+    const std::map<std::string, std::string> &writer_text_map) {
+  auto now = std::chrono::steady_clock::now();
+  {
+    std::unique_lock<std::mutex> lock(_high_fanout_followees_mtx);
+    auto it = _high_fanout_followees.find(user_id);
+    if (it != _high_fanout_followees.end()) {
+      if (now < it->second.expiry) {
+        return it->second.followees;
+      }
+      _high_fanout_followees.erase(it);
+    }
+  }
+
+  auto social_graph_client_wrapper = _social_graph_client_pool->Pop();
+  if (!social_graph_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to social-graph-service";
+    throw se;
+  }
+  auto social_graph_client = social_graph_client_wrapper->GetClient();
+  std::vector<int64_t> followees;
+  try {
+    social_graph_client->GetHighFanoutFollowees(
+        followees, req_id, user_id, _fanout_threshold, writer_text_map);
+  } catch (...) {
+    LOG(error) << "Failed to get followees from social-network-service";
+    _social_graph_client_pool->Remove(social_graph_client_wrapper);
+    throw;
+  }
+  _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
+
+  if (_high_fanout_followees_ttl.count() > 0) {
+    std::unique_lock<std::mutex> lock(_high_fanout_followees_mtx);
+    if (_high_fanout_followees.size() >= HIGH_FANOUT_FOLLOWEES_CACHE_SIZE) {
+      for (auto it = _high_fanout_followees.begin();
+           it != _high_fanout_followees.end();) {
+        it = now < it->second.expiry ? std::next(it)
+                                     : _high_fanout_followees.erase(it);
+      }
+      if (_high_fanout_followees.size() >= HIGH_FANOUT_FOLLOWEES_CACHE_SIZE) {
+        _high_fanout_followees.clear();
+      }
+    }
+    _high_fanout_followees[user_id] = {followees,
+                                       now + _high_fanout_followees_ttl};
+  }
+  return followees;
+}
+
+// Merges the materialized home timeline of user_id with the user timelines
+// of the high-fanout accounts it follows. Each of them can contribute any of
+// the first stop_idx merged posts, so all are read from their head. Only ids
+// and timestamps are merged; the posts that make the page are read once.
+void HomeTimelineHandler::_ReadMergedHomeTimeline(
+    std::vector<Post> &_return, int64_t req_id, int64_t user_id, int start_idx,
+    int stop_idx, const std::vector<int64_t> &high_fanout_followees,
+    const std::map<std::string, std::string> &writer_text_map) {
+  std::vector<Future<std::vector<TimelineEntry>>> user_timeline_futures;
+  for (auto followee_id : high_fanout_followees) {
+    user_timeline_futures.emplace_back(_executor->Submit(
+        [this, req_id, followee_id, stop_idx, writer_text_map]() {
+          return _ReadUserTimelineEntries(req_id, followee_id, stop_idx,
+                                          writer_text_map);
+        }));
+  }
+
+  std::vector<std::pair<std::string, double>> post_ids_str;
+  try {
+    if (_redis_client_pool) {
+      _redis_client_pool->zrevrange(std::to_string(user_id), 0, stop_idx - 1,
+                                    std::back_inserter(post_ids_str));
+    } else if (IsRedisReplicationEnabled()) {
+      _redis_replica_pool->zrevrange(std::to_string(user_id), 0, stop_idx - 1,
+                                     std::back_inserter(post_ids_str));
+    } else {
+      _redis_cluster_client_pool->zrevrange(std::to_string(user_id), 0,
+                                            stop_idx - 1,
+                                            std::back_inserter(post_ids_str));
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+
+  auto newest_first = [](const TimelineEntry &a, const TimelineEntry &b) {
+    return a.timestamp > b.timestamp ||
+           (a.timestamp == b.timestamp && a.post_id > b.post_id);
+  };
+  std::vector<std::vector<TimelineEntry>> timelines(1);
+  for (auto &post_id_str : post_ids_str) {
+    timelines[0].push_back({static_cast<int64_t>(std::stoul(post_id_str.first)),
+                            static_cast<int64_t>(post_id_str.second)});
+  }
+  std::sort(timelines[0].begin(), timelines[0].end(), newest_first);
+
+  // A page without the posts of a followed account would look complete but
+  // be wrong, so a user timeline that cannot be read fails the read.
+  std::exception_ptr error;
+  int64_t failed_followee_id = 0;
+  for (size_t i = 0; i < user_timeline_futures.size(); ++i) {
+    std::vector<TimelineEntry> timeline;
+    try {
+      timeline = user_timeline_futures[i].get();
+    } catch (...) {
+      if (!error) {
+        error = std::current_exception();
+        failed_followee_id = high_fanout_followees[i];
+      }
+      continue;
+    }
+    std::sort(timeline.begin(), timeline.end(), newest_first);
+    timelines.emplace_back(std::move(timeline));
+  }
+  if (error) {
+    LOG(error) << "Failed to read the user timeline of "
+               << failed_followee_id << " for the home timeline of "
+               << user_id;
+    std::rethrow_exception(error);
+  }
+
+  auto merged = merge_timelines(timelines, start_idx, stop_idx);
+  if (merged.empty()) {
+    return;
+  }
+  std::vector<int64_t> post_ids;
+  post_ids.reserve(merged.size());
+  for (auto &entry : merged) {
+    post_ids.emplace_back(entry.post_id);
+  }
+  std::vector<Post> posts;
+  _ReadPosts(posts, req_id, post_ids, writer_text_map);
+
+  // ReadPosts does not promise to keep the order of post_ids.
+  std::unordered_map<int64_t, Post> posts_by_id;
+  for (auto &post : posts) {
+    posts_by_id.emplace(post.post_id, std::move(post));
+  }
+  _return.reserve(merged.size());
+  for (auto &entry : merged) {
+    auto it = posts_by_id.find(entry.post_id);
+    if (it != posts_by_id.end()) {
+      _return.emplace_back(std::move(it->second));
+    }
+  }
+}
+
+std::vector<TimelineEntry> HomeTimelineHandler::_ReadUserTimelineEntries(
+    int64_t req_id, int64_t user_id, int stop_idx,
+    const std::map<std::string, std::string> &writer_text_map) {
+  auto user_timeline_client_wrapper = _user_timeline_client_pool->Pop();
+  if (!user_timeline_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to user-timeline-service";
+    throw se;
+  }
+  auto user_timeline_client = user_timeline_client_wrapper->GetClient();
+  std::map<int64_t, int64_t> entries;
+  try {
+    user_timeline_client->ReadUserTimelineEntries(entries, req_id, user_id, 0,
+                                                  stop_idx, writer_text_map);
+  } catch (...) {
+    _user_timeline_client_pool->Remove(user_timeline_client_wrapper);
+    LOG(error) << "Failed to read user timeline from user-timeline-service";
+    throw;
+  }
+  _user_timeline_client_pool->Keepalive(user_timeline_client_wrapper);
+  std::vector<TimelineEntry> timeline;
+  timeline.reserve(entries.size());
+  for (auto &entry : entries) {
+    timeline.push_back({entry.first, entry.second});
+  }
+  return timeline;
+}
+
+void HomeTimelineHandler::_ReadPosts(
+    std::vector<Post> &_return, int64_t req_id,
+    const std::vector<int64_t> &post_ids,
+    const std::map<std::string, std::string> &writer_text_map) {
   auto post_client_wrapper = _post_client_pool->Pop();
   if (!post_client_wrapper) {
     ServiceException se;
@@ -276,7 +539,6 @@ void HomeTimelineHandler::ReadHomeTimeline(
     throw;
   }
   _post_client_pool->Keepalive(post_client_wrapper);
-  span->Finish();
 }
 
 }  // namespace social_network
@@ -1,12 +1,10 @@
 #include <signal.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
+#include <algorithm>
 #include <boost/program_options.hpp>
 
 #include "../ClientPool.h"
+#include "../Executor.h"
 #include "../logger.h"
 #include "../tracing.h"
 #include "../utils.h"
@@ -14,10 +12,6 @@
 #include "../utils_thrift.h"
 #include "HomeTimelineHandler.h"
 
-using apache::thrift::protocol::TBinaryProtocolFactory;
-using apache::thrift::server::TThreadedServer;
-using apache::thrift::transport::TFramedTransportFactory;
-using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
 void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
@@ -65,6 +59,8 @@ int main(int argc, char *argv[]) {
   int post_storage_port = config_json["post-storage-service"]["port"];
   std::string post_storage_addr = config_json["post-storage-service"]["addr"];
   int post_storage_conns = config_json["post-storage-service"]["connections"];
+  int post_storage_min_conns =
+      config_json["post-storage-service"].value("min_connections", 0);
   int post_storage_timeout = config_json["post-storage-service"]["timeout_ms"];
   int post_storage_keepalive =
       config_json["post-storage-service"]["keepalive_ms"];
@@ -72,9 +68,38 @@ int main(int argc, char *argv[]) {
   int social_graph_port = config_json["social-graph-service"]["port"];
   std::string social_graph_addr = config_json["social-graph-service"]["addr"];
   int social_graph_conns = config_json["social-graph-service"]["connections"];
+  int social_graph_min_conns =
+      config_json["social-graph-service"].value("min_connections", 0);
   int social_graph_timeout = config_json["social-graph-service"]["timeout_ms"];
   int social_graph_keepalive =
       config_json["social-graph-service"]["keepalive_ms"];
+  int user_timeline_port = config_json["user-timeline-service"]["port"];
+  std::string user_timeline_addr = config_json["user-timeline-service"]["addr"];
+  int user_timeline_conns = config_json["user-timeline-service"]["connections"];
+  int user_timeline_min_conns =
+      config_json["user-timeline-service"].value("min_connections", 0);
+  int user_timeline_timeout =
+      config_json["user-timeline-service"]["timeout_ms"];
+  int user_timeline_keepalive =
+      config_json["user-timeline-service"]["keepalive_ms"];
+
+  int followers_page_size = std::max(
+      config_json["home-timeline-service"].value("followers_page_size", 1000),
+      1);
+  int64_t fanout_threshold =
+      config_json["home-timeline-service"].value("fanout_threshold", 0);
+  int high_fanout_followees_ttl_ms = config_json["home-timeline-service"].value(
+      "high_fanout_followees_ttl_ms", 10000);
+  int executor_threads =
+      config_json["home-timeline-service"].value("executor_threads", 64);
+  int executor_max_queued =
+      config_json["home-timeline-service"].value("executor_max_queued", 0);
+  int fanout_chunk_size =
+      config_json["home-timeline-service"].value("fanout_chunk_size", 256);
+  int fanout_max_in_flight =
+      config_json["home-timeline-service"].value("fanout_max_in_flight", 4);
+  int64_t home_timeline_max_len =
+      config_json["home-timeline-service"].value("home_timeline_max_len", 0);
 
   if (redis_replica_config_flag && (redis_cluster_config_flag || redis_cluster_flag)) {
       LOG(error) << "Can't start service when Redis Cluster and Redis Replica are enabled at the same time";
@@ -82,34 +107,44 @@ int main(int argc, char *argv[]) {
   }
 
   ClientPool<ThriftClient<PostStorageServiceClient>> post_storage_client_pool(
-      "post-storage-client", post_storage_addr, post_storage_port, 0,
-      post_storage_conns, post_storage_timeout, post_storage_keepalive,
-      config_json);
+      "post-storage-client", post_storage_addr, post_storage_port,
+      post_storage_min_conns, post_storage_conns, post_storage_timeout,
+      post_storage_keepalive, config_json);
 
   ClientPool<ThriftClient<SocialGraphServiceClient>> social_graph_client_pool(
-      "social-graph-client", social_graph_addr, social_graph_port, 0,
-      social_graph_conns, social_graph_timeout, social_graph_keepalive,
-      config_json);
+      "social-graph-client", social_graph_addr, social_graph_port,
+      social_graph_min_conns, social_graph_conns, social_graph_timeout,
+      social_graph_keepalive, config_json);
 
-  std::shared_ptr<TServerSocket> server_socket =
-      get_server_socket(config_json, "0.0.0.0", port);
+  ClientPool<ThriftClient<UserTimelineServiceClient>> user_timeline_client_pool(
+      "user-timeline-client", user_timeline_addr, user_timeline_port,
+      user_timeline_min_conns, user_timeline_conns, user_timeline_timeout,
+      user_timeline_keepalive, config_json);
 
+  Executor executor("home-timeline-service", executor_threads,
+                    executor_max_queued);
 
   if (redis_replica_config_flag) {
           Redis redis_replica_client_pool = init_redis_replica_client_pool(config_json, "redis-replica");
           Redis redis_primary_client_pool = init_redis_replica_client_pool(config_json, "redis-primary");
+          FanoutWriter fanout_writer(&redis_primary_client_pool, &executor,
+                                     fanout_chunk_size, fanout_max_in_flight,
+                                     home_timeline_max_len);
 
-          TThreadedServer server(
+          auto server = get_server(
+              config_json, "home-timeline-service",
               std::make_shared<HomeTimelineServiceProcessor>(
                   std::make_shared<HomeTimelineHandler>(&redis_replica_client_pool,
                       &redis_primary_client_pool,
                       &post_storage_client_pool,
-                      &social_graph_client_pool)),
-              server_socket, std::make_shared<TFramedTransportFactory>(),
-              std::make_shared<TBinaryProtocolFactory>());
+                      &social_graph_client_pool,
+                      &user_timeline_client_pool, &executor,
+                      &fanout_writer, followers_page_size, fanout_threshold,
+                      high_fanout_followees_ttl_ms)),
+              "0.0.0.0", port);
 
           LOG(info) << "Starting the home-timeline-service server with replicated Redis support...";
-          server.serve();
+          server->serve();
 
       
   }
@@ -117,28 +152,46 @@ int main(int argc, char *argv[]) {
   else if (redis_cluster_flag || redis_cluster_config_flag) {
     RedisCluster redis_cluster_client_pool =
         init_redis_cluster_client_pool(config_json, "home-timeline");
-    TThreadedServer server(
+    FanoutWriter fanout_writer(&redis_cluster_client_pool, &executor,
+                               fanout_chunk_size, fanout_max_in_flight,
+                               home_timeline_max_len);
+    auto server = get_server(
+        config_json, "home-timeline-service",
         std::make_shared<HomeTimelineServiceProcessor>(
             std::make_shared<HomeTimelineHandler>(&redis_cluster_client_pool,
                                                   &post_storage_client_pool,
-                                                  &social_graph_client_pool)),
-        server_socket, std::make_shared<TFramedTransportFactory>(),
-        std::make_shared<TBinaryProtocolFactory>());
+                                                  &social_graph_client_pool,
+                                                  &user_timeline_client_pool,
+                                                  &executor,
+                                                  &fanout_writer,
+                                                  followers_page_size,
+                                                  fanout_threshold,
+                                                  high_fanout_followees_ttl_ms)),
+        "0.0.0.0", port);
 
     LOG(info) << "Starting the home-timeline-service server with Redis Cluster support...";
-    server.serve();
+    server->serve();
   } else {
     Redis redis_client_pool =
         init_redis_client_pool(config_json, "home-timeline");
-    TThreadedServer server(
+    FanoutWriter fanout_writer(&redis_client_pool, &executor,
+                               fanout_chunk_size, fanout_max_in_flight,
+                               home_timeline_max_len);
+    auto server = get_server(
+        config_json, "home-timeline-service",
         std::make_shared<HomeTimelineServiceProcessor>(
             std::make_shared<HomeTimelineHandler>(&redis_client_pool,
                                                   &post_storage_client_pool,
-                                                  &social_graph_client_pool)),
-        server_socket, std::make_shared<TFramedTransportFactory>(),
-        std::make_shared<TBinaryProtocolFactory>());
+                                                  &social_graph_client_pool,
+                                                  &user_timeline_client_pool,
+                                                  &executor,
+                                                  &fanout_writer,
+                                                  followers_page_size,
+                                                  fanout_threshold,
+                                                  high_fanout_followees_ttl_ms)),
+        "0.0.0.0", port);
 
     LOG(info) << "Starting the home-timeline-service server...";
-    server.serve();
+    server->serve();
   }
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_HOMETIMELINESERVICE_TIMELINEMERGE_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_HOMETIMELINESERVICE_TIMELINEMERGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+namespace social_network {
+
+struct TimelineEntry {
+  int64_t post_id;
+  int64_t timestamp;
+};
+
+// Merges timelines that are each sorted newest first and returns the entries
+// in [start, stop) of the result, newest first. Ties on timestamp are broken
+// by post_id, so a post that appears in several timelines, such as a
+// celebrity post pushed before the celebrity crossed the fan-out threshold,
+// comes out once.
+std::vector<TimelineEntry> merge_timelines(
+    const std::vector<std::vector<TimelineEntry>> &timelines, size_t start,
+    size_t stop) {
+  std::vector<TimelineEntry> merged;
+  if (stop <= start) {
+    return merged;
+  }
+  // (timestamp, post_id, timeline, position), largest on top.
+  using Head = std::tuple<int64_t, int64_t, size_t, size_t>;
+  std::priority_queue<Head> heads;
+  for (size_t i = 0; i < timelines.size(); ++i) {
+    if (!timelines[i].empty()) {
+      heads.emplace(timelines[i][0].timestamp, timelines[i][0].post_id, i, 0);
+    }
+  }
+
+  merged.reserve(stop - start);
+  size_t taken = 0;
+  bool has_last = false;
+  int64_t last_post_id = 0;
+  while (!heads.empty() && taken < stop) {
+    Head head = heads.top();
+    heads.pop();
+    size_t timeline = std::get<2>(head);
+    size_t next = std::get<3>(head) + 1;
+    if (next < timelines[timeline].size()) {
+      auto &entry = timelines[timeline][next];
+      heads.emplace(entry.timestamp, entry.post_id, timeline, next);
+    }
+
+    int64_t post_id = std::get<1>(head);
+    if (has_last && post_id == last_post_id) {
+      continue;
+    }
+    has_last = true;
+    last_post_id = post_id;
+    if (taken++ >= start) {
+      merged.push_back({post_id, std::get<0>(head)});
+    }
+  }
+  return merged;
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_SRC_HOMETIMELINESERVICE_TIMELINEMERGE_H_
@@ -0,0 +1,269 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_MESSAGEQUEUE_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_MESSAGEQUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MpmcQueue.h"
+
+namespace social_network {
+
+/*
+ * One consumer of a message queue, with AMQP's delivery model: deliveries
+ * carry increasing tags, at most prefetch of them are unsettled at a time, and
+ * each is settled by an ack or a reject, either alone or together with every
+ * earlier delivery (multiple). Callbacks run on the thread that calls Run, and
+ * Ack, Reject, SetTimer and Stop are called from that thread too.
+ *
+ * AmqpMessageQueueConsumer (AmqpMessageQueue.h) consumes from RabbitMQ, and
+ * LocalMessageQueueConsumer from a LocalMessageQueue in the same process.
+ */
+class MessageQueueConsumer {
+ public:
+  // body is only valid until the callback returns.
+  using MessageCallback =
+      std::function<void(const char *body, size_t size, uint64_t tag)>;
+
+  virtual ~MessageQueueConsumer() = default;
+
+  virtual void Ack(uint64_t tag, bool multiple) = 0;
+  virtual void Reject(uint64_t tag, bool multiple, bool requeue) = 0;
+  // Runs callback every interval_ms while Run is running.
+  virtual void SetTimer(int interval_ms, std::function<void()> callback) = 0;
+  // Delivers messages to callback until Stop is called.
+  virtual void Run(MessageCallback callback) = 0;
+  virtual void Stop() = 0;
+};
+
+/*
+ * In-process stand-in for a RabbitMQ queue, so the asynchronous fan-out path
+ * can run without a broker. Messages sit in a lock-free MpmcQueue; consumers
+ * only take the mutex to sleep while it is empty.
+ */
+class LocalMessageQueue {
+ public:
+  explicit LocalMessageQueue(size_t capacity);
+
+  LocalMessageQueue(const LocalMessageQueue &) = delete;
+  LocalMessageQueue &operator=(const LocalMessageQueue &) = delete;
+
+  // Returns false if the queue is full.
+  bool Publish(std::string body);
+  size_t Size() const;
+
+ private:
+  friend class LocalMessageQueueConsumer;
+
+  bool _Pop(std::string &body);
+  void _WaitUntil(const std::chrono::steady_clock::time_point &deadline,
+                  const std::atomic<bool> &stopped);
+  void _NotifyAll();
+
+  MpmcQueue<std::string> _queue;
+  std::mutex _mtx;
+  std::condition_variable _cv;
+  std::atomic<int> _waiters;
+};
+
+LocalMessageQueue::LocalMessageQueue(size_t capacity)
+    : _queue(capacity), _waiters(0) {}
+
+bool LocalMessageQueue::Publish(std::string body) {
+  if (!_queue.Enqueue(std::move(body))) {
+    return false;
+  }
+  // Same handshake as ClientPool: either the consumer sees the message, or
+  // this sees the consumer waiting.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_waiters.load(std::memory_order_relaxed) > 0) {
+    std::unique_lock<std::mutex> cv_lock(_mtx);
+    cv_lock.unlock();
+    _cv.notify_one();
+  }
+  return true;
+}
+
+size_t LocalMessageQueue::Size() const { return _queue.Size(); }
+
+bool LocalMessageQueue::_Pop(std::string &body) { return _queue.Dequeue(body); }
+
+void LocalMessageQueue::_WaitUntil(
+    const std::chrono::steady_clock::time_point &deadline,
+    const std::atomic<bool> &stopped) {
+  std::unique_lock<std::mutex> cv_lock(_mtx);
+  _waiters++;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  _cv.wait_until(cv_lock, deadline,
+                 [&] { return !_queue.Empty() || stopped.load(); });
+  _waiters--;
+}
+
+void LocalMessageQueue::_NotifyAll() {
+  std::unique_lock<std::mutex> cv_lock(_mtx);
+  cv_lock.unlock();
+  _cv.notify_all();
+}
+
+/*
+ * Consumer of a LocalMessageQueue. Rejected messages that are requeued go
+ * back to this consumer ahead of the queue, rather than to the tail of the
+ * shared queue, so a full queue never blocks a requeue. Unlike the AMQP
+ * consumer, Stop may also be called from other threads.
+ */
+class LocalMessageQueueConsumer : public MessageQueueConsumer {
+ public:
+  LocalMessageQueueConsumer(LocalMessageQueue *queue, int prefetch);
+
+  void Ack(uint64_t tag, bool multiple) override;
+  void Reject(uint64_t tag, bool multiple, bool requeue) override;
+  void SetTimer(int interval_ms, std::function<void()> callback) override;
+  void Run(MessageCallback callback) override;
+  void Stop() override;
+
+ private:
+  struct Delivery {
+    uint64_t tag;
+    std::string body;
+    bool settled;
+    bool requeue;
+  };
+  struct Timer {
+    std::chrono::milliseconds interval;
+    std::chrono::steady_clock::time_point next;
+    std::function<void()> callback;
+  };
+
+  LocalMessageQueue *_queue;
+  size_t _prefetch;
+  std::atomic<bool> _stopped;
+  uint64_t _next_tag;
+  // Deliveries in tag order. Settled ones are only removed once the current
+  // callback returns, so the body it was given stays valid.
+  std::deque<Delivery> _deliveries;
+  size_t _unsettled;
+  std::deque<std::string> _redeliveries;
+  std::vector<Timer> _timers;
+
+  void _Settle(uint64_t tag, bool multiple, bool requeue);
+  void _RemoveSettled();
+  bool _Next(std::string &body);
+  std::chrono::steady_clock::time_point _RunTimers();
+};
+
+LocalMessageQueueConsumer::LocalMessageQueueConsumer(LocalMessageQueue *queue,
+                                                     int prefetch)
+    : _queue(queue), _prefetch(std::max(prefetch, 1)), _stopped(false),
+      _next_tag(1), _unsettled(0) {}
+
+void LocalMessageQueueConsumer::Ack(uint64_t tag, bool multiple) {
+  _Settle(tag, multiple, false);
+}
+
+void LocalMessageQueueConsumer::Reject(uint64_t tag, bool multiple,
+                                       bool requeue) {
+  _Settle(tag, multiple, requeue);
+}
+
+void LocalMessageQueueConsumer::_Settle(uint64_t tag, bool multiple,
+                                        bool requeue) {
+  if (_deliveries.empty() || tag < _deliveries.front().tag ||
+      tag > _deliveries.back().tag) {
+    return;
+  }
+  size_t last = tag - _deliveries.front().tag;
+  size_t first = multiple ? 0 : last;
+  for (size_t i = first; i <= last; ++i) {
+    auto &delivery = _deliveries[i];
+    if (!delivery.settled) {
+      delivery.settled = true;
+      delivery.requeue = requeue;
+      --_unsettled;
+    }
+  }
+}
+
+void LocalMessageQueueConsumer::_RemoveSettled() {
+  while (!_deliveries.empty() && _deliveries.front().settled) {
+    if (_deliveries.front().requeue) {
+      _redeliveries.emplace_back(std::move(_deliveries.front().body));
+    }
+    _deliveries.pop_front();
+  }
+}
+
+void LocalMessageQueueConsumer::SetTimer(int interval_ms,
+                                         std::function<void()> callback) {
+  std::chrono::milliseconds interval(std::max(interval_ms, 1));
+  _timers.push_back({interval, std::chrono::steady_clock::now() + interval,
+                     std::move(callback)});
+}
+
+bool LocalMessageQueueConsumer::_Next(std::string &body) {
+  if (!_redeliveries.empty()) {
+    body = std::move(_redeliveries.front());
+    _redeliveries.pop_front();
+    return true;
+  }
+  return _queue->_Pop(body);
+}
+
+// Runs the timers that are due and returns when the next one is.
+std::chrono::steady_clock::time_point LocalMessageQueueConsumer::_RunTimers() {
+  auto now = std::chrono::steady_clock::now();
+  auto next = now + std::chrono::milliseconds(100);
+  for (auto &timer : _timers) {
+    if (timer.next <= now) {
+      timer.callback();
+      _RemoveSettled();
+      timer.next = now + timer.interval;
+    }
+    next = std::min(next, timer.next);
+  }
+  return next;
+}
+
+void LocalMessageQueueConsumer::Run(MessageCallback callback) {
+  std::string body;
+  while (!_stopped.load()) {
+    auto next_timer = _RunTimers();
+    bool delivered = false;
+    while (!_stopped.load() && _unsettled < _prefetch && _Next(body)) {
+      uint64_t tag = _next_tag++;
+      _deliveries.push_back({tag, std::move(body), false, false});
+      ++_unsettled;
+      auto &delivery = _deliveries.back();
+      callback(delivery.body.data(), delivery.body.size(), tag);
+      _RemoveSettled();
+      delivered = true;
+      if (std::chrono::steady_clock::now() >= next_timer) {
+        break;
+      }
+    }
+    if (!delivered && !_stopped.load()) {
+      if (_unsettled < _prefetch) {
+        _queue->_WaitUntil(next_timer, _stopped);
+      } else {
+        // Only a timer can settle deliveries now.
+        std::this_thread::sleep_until(next_timer);
+      }
+    }
+  }
+}
+
+void LocalMessageQueueConsumer::Stop() {
+  _stopped = true;
+  _queue->_NotifyAll();
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_MESSAGEQUEUE_H_
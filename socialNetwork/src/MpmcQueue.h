@@ -0,0 +1,128 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_MPMCQUEUE_H
+#define SOCIAL_NETWORK_MICROSERVICES_MPMCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace social_network {
+
+/*
+ * Bounded lock-free multi-producer multi-consumer queue (Vyukov's array
+ * queue). Every cell carries a sequence number that tells producers and
+ * consumers whether it is free or full for their current lap, so Enqueue and
+ * Dequeue each cost one CAS on the shared position plus one release store.
+ * The capacity is rounded up to a power of two.
+ */
+template <class T>
+class MpmcQueue {
+ public:
+  explicit MpmcQueue(size_t capacity);
+
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+  bool Enqueue(T value);
+  bool Dequeue(T &value);
+  bool Empty() const;
+  size_t Size() const;
+  size_t Capacity() const;
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  // Keep the producer and consumer positions on separate cache lines.
+  alignas(64) std::atomic<size_t> _enqueue_pos;
+  alignas(64) std::atomic<size_t> _dequeue_pos;
+  alignas(64) size_t _mask;
+  std::unique_ptr<Cell[]> _cells;
+};
+
+template <class T>
+MpmcQueue<T>::MpmcQueue(size_t capacity) {
+  size_t size = 2;
+  while (size < capacity) {
+    size <<= 1;
+  }
+  _mask = size - 1;
+  _cells.reset(new Cell[size]);
+  for (size_t i = 0; i < size; ++i) {
+    _cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  _enqueue_pos.store(0, std::memory_order_relaxed);
+  _dequeue_pos.store(0, std::memory_order_relaxed);
+}
+
+template <class T>
+bool MpmcQueue<T>::Enqueue(T value) {
+  Cell *cell;
+  size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+  while (true) {
+    cell = &_cells[pos & _mask];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+    intptr_t diff = intptr_t(seq) - intptr_t(pos);
+    if (diff == 0) {
+      if (_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;  // full
+    } else {
+      pos = _enqueue_pos.load(std::memory_order_relaxed);
+    }
+  }
+  cell->value = std::move(value);
+  cell->sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+template <class T>
+bool MpmcQueue<T>::Dequeue(T &value) {
+  Cell *cell;
+  size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+  while (true) {
+    cell = &_cells[pos & _mask];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+    intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+    if (diff == 0) {
+      if (_dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;  // empty
+    } else {
+      pos = _dequeue_pos.load(std::memory_order_relaxed);
+    }
+  }
+  value = std::move(cell->value);
+  cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+  return true;
+}
+
+// Empty() and Size() are snapshots and may be stale by the time they return.
+template <class T>
+bool MpmcQueue<T>::Empty() const {
+  return Size() == 0;
+}
+
+template <class T>
+size_t MpmcQueue<T>::Size() const {
+  size_t dequeue_pos = _dequeue_pos.load(std::memory_order_acquire);
+  size_t enqueue_pos = _enqueue_pos.load(std::memory_order_acquire);
+  return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+}
+
+template <class T>
+size_t MpmcQueue<T>::Capacity() const {
+  return _mask + 1;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_MPMCQUEUE_H
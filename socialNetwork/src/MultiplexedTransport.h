@@ -0,0 +1,456 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_MULTIPLEXEDTRANSPORT_H
+#define SOCIAL_NETWORK_MICROSERVICES_MULTIPLEXEDTRANSPORT_H
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <thrift/transport/TSocket.h>
+#include <thrift/transport/TSSLSocket.h>
+#include <thrift/transport/TTransportException.h>
+#include <thrift/transport/TVirtualTransport.h>
+#include <nlohmann/json.hpp>
+
+#include "logger.h"
+
+// Same limit as TFramedTransport's default maxFrameSize. A larger length
+// prefix means the stream is corrupt, so the connection is dropped.
+#define MULTIPLEXED_MAX_FRAME_SIZE (256 * 1024 * 1024)
+
+namespace social_network {
+
+using apache::thrift::transport::TSocket;
+using apache::thrift::transport::TSSLSocketFactory;
+using apache::thrift::transport::TTransportException;
+using apache::thrift::transport::TVirtualTransport;
+using json = nlohmann::json;
+
+std::shared_ptr<TSocket> get_client_socket(const json &config_json,
+                                           const std::string &addr, int port) {
+  std::shared_ptr<TSocket> socket;
+  bool ssl_enabled = config_json["ssl"]["enabled"];
+  if (ssl_enabled) {
+    std::string ca_path = config_json["ssl"]["caPath"];
+    std::string ciphers = config_json["ssl"]["ciphers"];
+
+    std::shared_ptr<TSSLSocketFactory> factory;
+    factory = std::make_shared<TSSLSocketFactory>();
+    factory->ciphers(ciphers);
+    factory->loadTrustedCertificates(ca_path.c_str());
+
+    // if (config_json["ssl"]["verifyClient"]) {
+    //   std::string cert_path = config_json["ssl"]["clientCertPath"];
+    //   std::string key_path = config_json["ssl"]["clientKeyPath"];
+    //   factory->loadCertificate(cert_path.c_str());
+    //   factory->loadPrivateKey(key_path.c_str());
+    // }
+    // Need verify server
+    factory->authenticate(true);
+    socket = factory->createSocket(addr, port);
+  } else {
+    socket = std::make_shared<TSocket>(addr, port);
+  }
+  socket->setKeepAlive(true);
+  return socket;
+}
+
+/*
+ * One framed binary-protocol connection shared by many concurrent callers.
+ * Send() rewrites the sequence id of an outgoing call frame to a
+ * connection-unique value and returns a future for the reply. A reader
+ * thread reads reply frames in whatever order the server finishes them and
+ * completes the future registered under the reply's sequence id.
+ *
+ * The generated *ServiceClient classes always send sequence id 0 and never
+ * check the one in the reply, so rewriting it underneath them is invisible.
+ * The server must process requests of one connection concurrently for this
+ * to help; see the "pipelined" server_mode in utils_thrift.h.
+ *
+ * The socket is only closed by the reader, or by Open() and the destructor
+ * once the reader has exited, always under the write lock. Writers that
+ * fail shut it down instead, which wakes the reader.
+ */
+class MultiplexedConnection {
+ public:
+  MultiplexedConnection(const std::string &addr, int port,
+                        const json &config_json);
+  ~MultiplexedConnection();
+
+  MultiplexedConnection(const MultiplexedConnection &) = delete;
+  MultiplexedConnection &operator=(const MultiplexedConnection &) = delete;
+
+  // Returns one of the "connections" shared connections to addr:port,
+  // round-robin. Connections are created on first use and live until exit.
+  static std::shared_ptr<MultiplexedConnection> Get(const std::string &addr,
+                                                    int port, int connections,
+                                                    const json &config_json);
+
+  void Open();
+  bool IsOpen() const;
+  // Stores the sequence id the call was sent under in *seqid, so a caller
+  // that gives up on the reply can Cancel() it.
+  std::future<std::string> Send(std::string frame, int32_t *seqid);
+  void Cancel(int32_t seqid);
+  size_t NumPending();
+
+  // Offset of the sequence id in a binary-protocol message, or 0 if the
+  // message header is malformed.
+  static size_t SeqidOffset(const std::string &message);
+
+ private:
+  std::string _addr;
+  int _port;
+  std::shared_ptr<TSocket> _socket;
+  std::atomic<bool> _open{};
+  std::atomic<int32_t> _next_seqid{};
+
+  std::mutex _connect_mtx;
+  std::mutex _write_mtx;
+  std::mutex _pending_mtx;
+  std::unordered_map<int32_t, std::promise<std::string>> _pending;
+  std::thread _reader_thread;
+
+  void _ReadLoop();
+  void _FailPending(const std::string &reason);
+  void _Shutdown();
+};
+
+MultiplexedConnection::MultiplexedConnection(const std::string &addr, int port,
+                                             const json &config_json) {
+  _addr = addr;
+  _port = port;
+  _socket = get_client_socket(config_json, addr, port);
+}
+
+MultiplexedConnection::~MultiplexedConnection() {
+  std::unique_lock<std::mutex> lock(_connect_mtx);
+  _Shutdown();
+  if (_reader_thread.joinable()) {
+    _reader_thread.join();
+  }
+  _socket->close();
+}
+
+std::shared_ptr<MultiplexedConnection> MultiplexedConnection::Get(
+    const std::string &addr, int port, int connections,
+    const json &config_json) {
+  struct Peer {
+    std::vector<std::shared_ptr<MultiplexedConnection>> connections;
+    std::atomic<uint64_t> next{};
+  };
+  static std::mutex peers_mtx;
+  static std::map<std::string, std::unique_ptr<Peer>> peers;
+
+  Peer *peer;
+  {
+    std::unique_lock<std::mutex> lock(peers_mtx);
+    auto &entry = peers[addr + ":" + std::to_string(port)];
+    if (!entry) {
+      entry.reset(new Peer());
+      for (int i = 0; i < std::max(connections, 1); ++i) {
+        entry->connections.emplace_back(
+            std::make_shared<MultiplexedConnection>(addr, port, config_json));
+      }
+      LOG(info) << "Multiplexing calls to " << addr << ":" << port << " over "
+                << entry->connections.size() << " connections";
+    }
+    peer = entry.get();
+  }
+  return peer->connections[peer->next++ % peer->connections.size()];
+}
+
+void MultiplexedConnection::Open() {
+  if (_open) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(_connect_mtx);
+  if (_open) {
+    return;
+  }
+  // A reader that saw the connection fail has already failed its pending
+  // calls and is about to exit.
+  if (_reader_thread.joinable()) {
+    _reader_thread.join();
+  }
+  {
+    std::unique_lock<std::mutex> write_lock(_write_mtx);
+    _socket->close();
+    _socket->open();
+  }
+  _open = true;
+  _reader_thread = std::thread(&MultiplexedConnection::_ReadLoop, this);
+}
+
+bool MultiplexedConnection::IsOpen() const {
+  return _open;
+}
+
+std::future<std::string> MultiplexedConnection::Send(std::string frame,
+                                                     int32_t *seqid) {
+  size_t offset = SeqidOffset(frame);
+  if (offset == 0) {
+    throw TTransportException(TTransportException::CORRUPTED_DATA,
+                              "Malformed Thrift message header");
+  }
+  if (!_open) {
+    throw TTransportException(TTransportException::NOT_OPEN,
+                              "Multiplexed connection is not open");
+  }
+
+  *seqid = _next_seqid++;
+  uint32_t net_seqid = htonl(static_cast<uint32_t>(*seqid));
+  memcpy(&frame[offset], &net_seqid, sizeof(net_seqid));
+
+  std::future<std::string> reply;
+  {
+    std::unique_lock<std::mutex> lock(_pending_mtx);
+    reply = _pending[*seqid].get_future();
+  }
+  if (!_open) {
+    // The reader may have failed the pending calls before this one was added.
+    Cancel(*seqid);
+    throw TTransportException(TTransportException::NOT_OPEN,
+                              "Multiplexed connection is not open");
+  }
+
+  uint32_t net_size = htonl(static_cast<uint32_t>(frame.size()));
+  try {
+    std::unique_lock<std::mutex> lock(_write_mtx);
+    if (!_open) {
+      throw TTransportException(TTransportException::NOT_OPEN,
+                                "Multiplexed connection is not open");
+    }
+    _socket->write(reinterpret_cast<const uint8_t *>(&net_size),
+                   sizeof(net_size));
+    _socket->write(reinterpret_cast<const uint8_t *>(frame.data()),
+                   static_cast<uint32_t>(frame.size()));
+    _socket->flush();
+  } catch (...) {
+    Cancel(*seqid);
+    // A partial frame leaves the stream unusable. Shutting it down makes the
+    // reader fail every other pending call, and the next Open() reconnects.
+    _open = false;
+    _Shutdown();
+    throw;
+  }
+  return reply;
+}
+
+void MultiplexedConnection::Cancel(int32_t seqid) {
+  std::unique_lock<std::mutex> lock(_pending_mtx);
+  _pending.erase(seqid);
+}
+
+size_t MultiplexedConnection::NumPending() {
+  std::unique_lock<std::mutex> lock(_pending_mtx);
+  return _pending.size();
+}
+
+size_t MultiplexedConnection::SeqidOffset(const std::string &message) {
+  uint32_t word;
+  if (message.size() < 4) {
+    return 0;
+  }
+  memcpy(&word, message.data(), sizeof(word));
+  word = ntohl(word);
+  size_t offset;
+  if (word & 0x80000000) {
+    // Strict: version|type, name length, name, seqid.
+    if (message.size() < 8) {
+      return 0;
+    }
+    memcpy(&word, message.data() + 4, sizeof(word));
+    offset = 8 + ntohl(word);
+  } else {
+    // Old style: name length, name, type byte, seqid.
+    offset = 4 + word + 1;
+  }
+  return offset + 4 <= message.size() ? offset : 0;
+}
+
+void MultiplexedConnection::_ReadLoop() {
+  std::string reason;
+  try {
+    while (true) {
+      uint32_t net_size;
+      _socket->readAll(reinterpret_cast<uint8_t *>(&net_size),
+                       sizeof(net_size));
+      uint32_t size = ntohl(net_size);
+      if (size > MULTIPLEXED_MAX_FRAME_SIZE) {
+        throw TTransportException(
+            TTransportException::CORRUPTED_DATA,
+            "Frame size " + std::to_string(size) + " exceeds the maximum");
+      }
+      std::string frame(size, '\0');
+      _socket->readAll(reinterpret_cast<uint8_t *>(&frame[0]),
+                       static_cast<uint32_t>(frame.size()));
+
+      size_t offset = SeqidOffset(frame);
+      if (offset == 0) {
+        throw TTransportException(TTransportException::CORRUPTED_DATA,
+                                  "Malformed Thrift reply header");
+      }
+      uint32_t net_seqid;
+      memcpy(&net_seqid, frame.data() + offset, sizeof(net_seqid));
+      int32_t seqid = static_cast<int32_t>(ntohl(net_seqid));
+
+      std::unique_lock<std::mutex> lock(_pending_mtx);
+      auto it = _pending.find(seqid);
+      if (it == _pending.end()) {
+        // The caller timed out and gave up on this reply.
+        continue;
+      }
+      auto promise = std::move(it->second);
+      _pending.erase(it);
+      lock.unlock();
+      promise.set_value(std::move(frame));
+    }
+  } catch (TTransportException &e) {
+    reason = e.what();
+  } catch (std::exception &e) {
+    reason = e.what();
+  }
+  _open = false;
+  {
+    std::unique_lock<std::mutex> lock(_write_mtx);
+    _socket->close();
+  }
+  _FailPending(reason);
+}
+
+void MultiplexedConnection::_Shutdown() {
+  std::unique_lock<std::mutex> lock(_write_mtx);
+  if (_socket->getSocketFD() >= 0) {
+    ::shutdown(_socket->getSocketFD(), SHUT_RDWR);
+  }
+}
+
+void MultiplexedConnection::_FailPending(const std::string &reason) {
+  std::unordered_map<int32_t, std::promise<std::string>> pending;
+  {
+    std::unique_lock<std::mutex> lock(_pending_mtx);
+    pending.swap(_pending);
+  }
+  if (!pending.empty()) {
+    LOG(warning) << "Multiplexed connection to " << _addr << ":" << _port
+                 << " closed with " << pending.size()
+                 << " calls in flight: " << reason;
+  }
+  for (auto &entry : pending) {
+    entry.second.set_exception(std::make_exception_ptr(TTransportException(
+        TTransportException::NOT_OPEN, "Connection closed: " + reason)));
+  }
+}
+
+/*
+ * Per-client transport over a MultiplexedConnection. The generated client
+ * writes a call into the channel, flush() hands the whole message to the
+ * connection, and the first read() waits up to call_timeout_ms for the
+ * reply. Like a regular transport, a channel carries one call at a time;
+ * concurrency comes from many channels sharing one connection.
+ */
+class MultiplexedChannel : public TVirtualTransport<MultiplexedChannel> {
+ public:
+  MultiplexedChannel(std::shared_ptr<MultiplexedConnection> connection,
+                     int call_timeout_ms);
+
+  bool isOpen() override;
+  void open() override;
+  // Closing a channel leaves the shared connection open for other callers.
+  void close() override;
+
+  uint32_t read(uint8_t *buf, uint32_t len);
+  uint32_t readEnd() override;
+  void write(const uint8_t *buf, uint32_t len);
+  void flush();
+
+ private:
+  std::shared_ptr<MultiplexedConnection> _connection;
+  std::chrono::milliseconds _call_timeout;
+  std::string _request;
+  std::future<std::string> _pending_reply;
+  int32_t _pending_seqid{};
+  std::string _reply;
+  size_t _reply_pos{};
+  bool _has_reply{};
+};
+
+MultiplexedChannel::MultiplexedChannel(
+    std::shared_ptr<MultiplexedConnection> connection, int call_timeout_ms)
+    : _connection(std::move(connection)),
+      _call_timeout(call_timeout_ms) {}
+
+bool MultiplexedChannel::isOpen() {
+  return _connection->IsOpen();
+}
+
+void MultiplexedChannel::open() {
+  _connection->Open();
+}
+
+void MultiplexedChannel::close() {
+  _request.clear();
+  _pending_reply = std::future<std::string>();
+  _reply.clear();
+  _has_reply = false;
+}
+
+uint32_t MultiplexedChannel::read(uint8_t *buf, uint32_t len) {
+  if (!_has_reply) {
+    if (!_pending_reply.valid()) {
+      throw TTransportException(TTransportException::NOT_OPEN,
+                                "No call in flight on this channel");
+    }
+    if (_pending_reply.wait_for(_call_timeout) != std::future_status::ready) {
+      // The reader drops the reply if it ever arrives.
+      _connection->Cancel(_pending_seqid);
+      _pending_reply = std::future<std::string>();
+      throw TTransportException(TTransportException::TIMED_OUT,
+                                "Timed out waiting for multiplexed reply");
+    }
+    _reply = _pending_reply.get();
+    _reply_pos = 0;
+    _has_reply = true;
+  }
+  uint32_t n = static_cast<uint32_t>(
+      std::min<size_t>(len, _reply.size() - _reply_pos));
+  memcpy(buf, _reply.data() + _reply_pos, n);
+  _reply_pos += n;
+  return n;
+}
+
+uint32_t MultiplexedChannel::readEnd() {
+  uint32_t n = static_cast<uint32_t>(_reply_pos);
+  _reply.clear();
+  _reply_pos = 0;
+  _has_reply = false;
+  return n;
+}
+
+void MultiplexedChannel::write(const uint8_t *buf, uint32_t len) {
+  _request.append(reinterpret_cast<const char *>(buf), len);
+}
+
+void MultiplexedChannel::flush() {
+  std::string request;
+  request.swap(_request);
+  _reply.clear();
+  _has_reply = false;
+  _pending_reply = _connection->Send(std::move(request), &_pending_seqid);
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_MULTIPLEXEDTRANSPORT_H
@@ -0,0 +1,214 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_PIPELINEDSERVER_H
+#define SOCIAL_NETWORK_MICROSERVICES_PIPELINEDSERVER_H
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <thrift/TProcessor.h>
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/server/TServer.h>
+#include <thrift/transport/TBufferTransports.h>
+#include <thrift/transport/TServerTransport.h>
+#include <thrift/transport/TSocket.h>
+#include <thrift/transport/TTransportException.h>
+
+#include "Executor.h"
+#include "logger.h"
+
+// Same limit as TFramedTransport's default maxFrameSize. A larger length
+// prefix is garbage or hostile, so the connection is dropped.
+#define PIPELINED_SERVER_MAX_FRAME_SIZE (256 * 1024 * 1024)
+
+namespace social_network {
+
+using apache::thrift::TProcessor;
+using apache::thrift::protocol::TBinaryProtocol;
+using apache::thrift::server::TServer;
+using apache::thrift::transport::TMemoryBuffer;
+using apache::thrift::transport::TServerTransport;
+using apache::thrift::transport::TSocket;
+using apache::thrift::transport::TTransport;
+using apache::thrift::transport::TTransportException;
+
+/*
+ * Framed binary-protocol server that processes the requests of one
+ * connection concurrently. A reader thread per connection reads frames and
+ * hands each one to the worker executor; replies are written back as they
+ * finish, so they may overtake each other. Clients that multiplex calls
+ * over a few connections (MultiplexedTransport.h) match replies by sequence
+ * id. Ordinary clients with one call in flight see no difference.
+ *
+ * Only the reader thread closes a connection's socket. Workers and stop()
+ * shut it down instead, which fails the reader's next read, so a worker
+ * never writes to a descriptor that was closed and reused.
+ */
+class PipelinedServer : public TServer {
+ public:
+  PipelinedServer(const std::shared_ptr<TProcessor> &processor,
+                  const std::shared_ptr<TServerTransport> &server_transport,
+                  int workers, int max_queued);
+
+  void serve() override;
+  void stop() override;
+
+ private:
+  struct Connection {
+    std::shared_ptr<TTransport> transport;
+    std::mutex write_mtx;
+    // Set by the reader under write_mtx once it has closed the transport.
+    bool closed = false;
+  };
+
+  std::shared_ptr<TProcessor> _processor;
+  std::shared_ptr<TServerTransport> _server_transport;
+  Executor _workers;
+  std::atomic<bool> _stopped{};
+  std::mutex _connections_mtx;
+  std::set<std::shared_ptr<Connection>> _connections;
+
+  void _ReadLoop(std::shared_ptr<Connection> connection);
+  void _Process(const std::shared_ptr<Connection> &connection,
+                const std::string &request);
+  static void _Shutdown(Connection &connection);
+};
+
+PipelinedServer::PipelinedServer(
+    const std::shared_ptr<TProcessor> &processor,
+    const std::shared_ptr<TServerTransport> &server_transport, int workers,
+    int max_queued)
+    : TServer(processor, server_transport),
+      _processor(processor),
+      _server_transport(server_transport),
+      _workers("pipelined-server", workers, max_queued) {}
+
+void PipelinedServer::serve() {
+  _server_transport->listen();
+  while (!_stopped) {
+    std::shared_ptr<TTransport> client;
+    try {
+      client = _server_transport->accept();
+    } catch (TTransportException &e) {
+      if (_stopped) {
+        break;
+      }
+      LOG(warning) << "PipelinedServer accept failed: " << e.what();
+      continue;
+    }
+    auto connection = std::make_shared<Connection>();
+    connection->transport = client;
+    {
+      std::unique_lock<std::mutex> lock(_connections_mtx);
+      _connections.insert(connection);
+    }
+    std::thread(&PipelinedServer::_ReadLoop, this, connection).detach();
+  }
+  _server_transport->close();
+}
+
+void PipelinedServer::stop() {
+  _stopped = true;
+  _server_transport->interrupt();
+  std::unique_lock<std::mutex> lock(_connections_mtx);
+  for (auto &connection : _connections) {
+    _Shutdown(*connection);
+  }
+}
+
+void PipelinedServer::_ReadLoop(std::shared_ptr<Connection> connection) {
+  auto &transport = connection->transport;
+  try {
+    while (!_stopped) {
+      uint32_t net_size;
+      transport->readAll(reinterpret_cast<uint8_t *>(&net_size),
+                         sizeof(net_size));
+      uint32_t size = ntohl(net_size);
+      if (size > PIPELINED_SERVER_MAX_FRAME_SIZE) {
+        throw TTransportException(
+            TTransportException::CORRUPTED_DATA,
+            "Frame size " + std::to_string(size) + " exceeds the maximum");
+      }
+      std::string request(size, '\0');
+      transport->readAll(reinterpret_cast<uint8_t *>(&request[0]),
+                         static_cast<uint32_t>(request.size()));
+      // Runs on this thread when the executor queue is full, which stops
+      // reading from the connection until the backlog drains.
+      _workers.Post([this, connection, request]() {
+        _Process(connection, request);
+      });
+    }
+  } catch (TTransportException &e) {
+    if (e.getType() != TTransportException::END_OF_FILE) {
+      LOG(warning) << "PipelinedServer connection closed: " << e.what();
+    }
+  } catch (std::exception &e) {
+    LOG(warning) << "PipelinedServer connection closed: " << e.what();
+  }
+  {
+    std::unique_lock<std::mutex> lock(connection->write_mtx);
+    connection->closed = true;
+    transport->close();
+  }
+  std::unique_lock<std::mutex> lock(_connections_mtx);
+  _connections.erase(connection);
+}
+
+void PipelinedServer::_Process(const std::shared_ptr<Connection> &connection,
+                               const std::string &request) {
+  auto input = std::make_shared<TMemoryBuffer>(
+      reinterpret_cast<uint8_t *>(const_cast<char *>(request.data())),
+      static_cast<uint32_t>(request.size()));
+  auto output = std::make_shared<TMemoryBuffer>();
+  auto input_protocol = std::make_shared<TBinaryProtocol>(input);
+  auto output_protocol = std::make_shared<TBinaryProtocol>(output);
+  try {
+    _processor->process(input_protocol, output_protocol, nullptr);
+  } catch (std::exception &e) {
+    LOG(error) << "PipelinedServer failed to process a request: " << e.what();
+    _Shutdown(*connection);
+    return;
+  }
+
+  uint8_t *reply;
+  uint32_t reply_size;
+  output->getBuffer(&reply, &reply_size);
+  if (reply_size == 0) {
+    // Oneway call.
+    return;
+  }
+  uint32_t net_size = htonl(reply_size);
+  try {
+    std::unique_lock<std::mutex> lock(connection->write_mtx);
+    if (connection->closed) {
+      return;
+    }
+    connection->transport->write(reinterpret_cast<uint8_t *>(&net_size),
+                                 sizeof(net_size));
+    connection->transport->write(reply, reply_size);
+    connection->transport->flush();
+  } catch (TTransportException &e) {
+    LOG(warning) << "PipelinedServer failed to write a reply: " << e.what();
+    _Shutdown(*connection);
+  }
+}
+
+void PipelinedServer::_Shutdown(Connection &connection) {
+  std::unique_lock<std::mutex> lock(connection.write_mtx);
+  if (connection.closed) {
+    return;
+  }
+  auto socket = std::dynamic_pointer_cast<TSocket>(connection.transport);
+  if (socket && socket->getSocketFD() >= 0) {
+    ::shutdown(socket->getSocketFD(), SHUT_RDWR);
+  }
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_PIPELINEDSERVER_H
@@ -0,0 +1,135 @@
+// Compares encoding and decoding a cached post as JSON, the format
+// PostStorageService used to keep in Memcached, with the compact binary
+// format from PostCacheCodec.h.
+//
+// Usage: PostCacheBenchmark [iterations] [text_length]
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "../PostStorageService/PostCacheCodec.h"
+
+using namespace social_network;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+Post MakePost(int text_length) {
+  Post post;
+  post.post_id = 4611686018427387904;
+  post.req_id = 8106395120138412983;
+  post.timestamp = 1603412345678;
+  post.post_type = PostType::POST;
+  post.creator.user_id = 1234;
+  post.creator.username = "username_1234";
+  post.text = std::string(text_length, 'x');
+  for (int i = 0; i < 2; ++i) {
+    UserMention user_mention;
+    user_mention.user_id = 100 + i;
+    user_mention.username = "username_" + std::to_string(100 + i);
+    post.user_mentions.emplace_back(user_mention);
+
+    Url url;
+    url.shortened_url = "http://short-url/abcdefghi" + std::to_string(i);
+    url.expanded_url = "http://www.example.com/some/long/path/" +
+                       std::to_string(i);
+    post.urls.emplace_back(url);
+
+    Media media;
+    media.media_id = 5000 + i;
+    media.media_type = "png";
+    post.media.emplace_back(media);
+  }
+  return post;
+}
+
+// Same layout bson_as_json produces for a stored post.
+std::string EncodeJson(const Post &post) {
+  json post_json;
+  post_json["_id"] = {{"$oid", "5f92a6b1c2d3e4f5a6b7c8d9"}};
+  post_json["post_id"] = post.post_id;
+  post_json["timestamp"] = post.timestamp;
+  post_json["text"] = post.text;
+  post_json["req_id"] = post.req_id;
+  post_json["post_type"] = post.post_type;
+  post_json["creator"] = {{"user_id", post.creator.user_id},
+                          {"username", post.creator.username}};
+  post_json["urls"] = json::array();
+  for (auto &url : post.urls) {
+    post_json["urls"].push_back({{"shortened_url", url.shortened_url},
+                                 {"expanded_url", url.expanded_url}});
+  }
+  post_json["user_mentions"] = json::array();
+  for (auto &user_mention : post.user_mentions) {
+    post_json["user_mentions"].push_back(
+        {{"user_id", user_mention.user_id},
+         {"username", user_mention.username}});
+  }
+  post_json["media"] = json::array();
+  for (auto &media : post.media) {
+    post_json["media"].push_back(
+        {{"media_id", media.media_id}, {"media_type", media.media_type}});
+  }
+  return post_json.dump();
+}
+
+template <class Fn>
+double Time(int iterations, Fn fn) {
+  auto start = steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    fn();
+  }
+  auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start);
+  return double(elapsed.count()) / iterations;
+}
+
+int main(int argc, char *argv[]) {
+  int iterations = argc > 1 ? std::stoi(argv[1]) : 200000;
+  int text_length = argc > 2 ? std::stoi(argv[2]) : 256;
+
+  Post post = MakePost(text_length);
+  std::string json_entry = EncodeJson(post);
+  std::string compact_entry = encode_post(post);
+
+  Post check;
+  decode_post(json_entry.data(), json_entry.size(), check);
+  if (!(check == post)) {
+    std::cerr << "JSON round trip mismatch" << std::endl;
+    return 1;
+  }
+  check = Post();
+  decode_post(compact_entry.data(), compact_entry.size(), check);
+  if (!(check == post)) {
+    std::cerr << "Compact round trip mismatch" << std::endl;
+    return 1;
+  }
+
+  size_t sink = 0;
+  auto json_encode_ns = Time(iterations, [&]() {
+    sink += EncodeJson(post).size();
+  });
+  auto json_decode_ns = Time(iterations, [&]() {
+    Post decoded;
+    decode_post(json_entry.data(), json_entry.size(), decoded);
+    sink += decoded.text.size();
+  });
+  auto compact_encode_ns = Time(iterations, [&]() {
+    sink += encode_post(post).size();
+  });
+  auto compact_decode_ns = Time(iterations, [&]() {
+    Post decoded;
+    decode_post(compact_entry.data(), compact_entry.size(), decoded);
+    sink += decoded.text.size();
+  });
+
+  std::cout << "iterations=" << iterations << " text_length=" << text_length
+            << " (" << sink << ")" << std::endl;
+  std::cout << "json:    " << json_entry.size() << " bytes, encode "
+            << json_encode_ns << " ns/post, decode " << json_decode_ns
+            << " ns/post" << std::endl;
+  std::cout << "compact: " << compact_entry.size() << " bytes, encode "
+            << compact_encode_ns << " ns/post, decode " << compact_decode_ns
+            << " ns/post" << std::endl;
+  return 0;
+}
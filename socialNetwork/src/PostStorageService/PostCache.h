@@ -0,0 +1,243 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_POSTCACHE_H
+#define SOCIAL_NETWORK_MICROSERVICES_POSTCACHE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../../gen-cpp/social_network_types.h"
+#include "../logger.h"
+
+namespace social_network {
+
+struct PostCacheStats {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t insertions;
+  uint64_t evictions;
+  uint64_t expirations;
+  uint64_t invalidations;
+  size_t entries;
+  size_t bytes;
+};
+
+/*
+ * In-process cache of decoded posts in front of Memcached. Posts are split
+ * over shards by post_id, each shard is an LRU list under its own mutex and
+ * gets an equal part of the memory budget. Entries older than ttl_ms are
+ * treated as misses. A hit copies the post outside the shard lock.
+ */
+class PostCache {
+ public:
+  PostCache(size_t budget_bytes, int ttl_ms, int num_shards);
+  ~PostCache();
+
+  PostCache(const PostCache &) = delete;
+  PostCache &operator=(const PostCache &) = delete;
+
+  bool Get(int64_t post_id, Post &post);
+  void Put(const Post &post);
+  void Invalidate(int64_t post_id);
+  void Clear();
+  PostCacheStats GetStats();
+
+ private:
+  struct Entry {
+    int64_t post_id;
+    std::shared_ptr<const Post> post;
+    size_t bytes;
+    std::chrono::steady_clock::time_point expires;
+  };
+  struct Shard {
+    std::mutex mtx;
+    std::list<Entry> lru;
+    std::unordered_map<int64_t, std::list<Entry>::iterator> index;
+    size_t bytes = 0;
+  };
+
+  std::vector<std::unique_ptr<Shard>> _shards;
+  size_t _shard_budget;
+  std::chrono::milliseconds _ttl;
+
+  std::atomic<uint64_t> _hits{};
+  std::atomic<uint64_t> _misses{};
+  std::atomic<uint64_t> _insertions{};
+  std::atomic<uint64_t> _evictions{};
+  std::atomic<uint64_t> _expirations{};
+  std::atomic<uint64_t> _invalidations{};
+
+  std::mutex _report_mtx;
+  std::condition_variable _report_cv;
+  bool _stopped{};
+  std::thread _report_thread;
+
+  Shard &_ShardFor(int64_t post_id);
+  static void _Erase(Shard &shard, std::list<Entry>::iterator it);
+  static size_t _Size(const Post &post);
+  void _Report();
+};
+
+PostCache::PostCache(size_t budget_bytes, int ttl_ms, int num_shards) {
+  num_shards = std::max(num_shards, 1);
+  for (int i = 0; i < num_shards; ++i) {
+    _shards.emplace_back(new Shard());
+  }
+  _shard_budget = budget_bytes / num_shards;
+  _ttl = std::chrono::milliseconds(ttl_ms);
+  _report_thread = std::thread(&PostCache::_Report, this);
+}
+
+PostCache::~PostCache() {
+  {
+    std::unique_lock<std::mutex> lock(_report_mtx);
+    _stopped = true;
+  }
+  _report_cv.notify_one();
+  _report_thread.join();
+}
+
+bool PostCache::Get(int64_t post_id, Post &post) {
+  std::shared_ptr<const Post> cached;
+  {
+    auto &shard = _ShardFor(post_id);
+    std::unique_lock<std::mutex> lock(shard.mtx);
+    auto it = shard.index.find(post_id);
+    if (it != shard.index.end()) {
+      if (std::chrono::steady_clock::now() < it->second->expires) {
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        cached = it->second->post;
+      } else {
+        _Erase(shard, it->second);
+        _expirations++;
+      }
+    }
+  }
+  if (!cached) {
+    _misses++;
+    return false;
+  }
+  _hits++;
+  post = *cached;
+  return true;
+}
+
+void PostCache::Put(const Post &post) {
+  Entry entry;
+  entry.post_id = post.post_id;
+  entry.post = std::make_shared<const Post>(post);
+  entry.bytes = _Size(post);
+  entry.expires = std::chrono::steady_clock::now() + _ttl;
+  if (entry.bytes > _shard_budget) {
+    return;
+  }
+
+  auto &shard = _ShardFor(post.post_id);
+  std::unique_lock<std::mutex> lock(shard.mtx);
+  auto it = shard.index.find(post.post_id);
+  if (it != shard.index.end()) {
+    _Erase(shard, it->second);
+  }
+  while (shard.bytes + entry.bytes > _shard_budget) {
+    _Erase(shard, std::prev(shard.lru.end()));
+    _evictions++;
+  }
+  shard.bytes += entry.bytes;
+  shard.lru.emplace_front(std::move(entry));
+  shard.index[post.post_id] = shard.lru.begin();
+  _insertions++;
+}
+
+void PostCache::Invalidate(int64_t post_id) {
+  auto &shard = _ShardFor(post_id);
+  std::unique_lock<std::mutex> lock(shard.mtx);
+  auto it = shard.index.find(post_id);
+  if (it != shard.index.end()) {
+    _Erase(shard, it->second);
+    _invalidations++;
+  }
+}
+
+void PostCache::Clear() {
+  for (auto &shard : _shards) {
+    std::unique_lock<std::mutex> lock(shard->mtx);
+    _invalidations += shard->index.size();
+    shard->lru.clear();
+    shard->index.clear();
+    shard->bytes = 0;
+  }
+}
+
+PostCacheStats PostCache::GetStats() {
+  PostCacheStats stats{_hits.load(),        _misses.load(),
+                       _insertions.load(),  _evictions.load(),
+                       _expirations.load(), _invalidations.load(),
+                       0,                   0};
+  for (auto &shard : _shards) {
+    std::unique_lock<std::mutex> lock(shard->mtx);
+    stats.entries += shard->index.size();
+    stats.bytes += shard->bytes;
+  }
+  return stats;
+}
+
+PostCache::Shard &PostCache::_ShardFor(int64_t post_id) {
+  // Post ids are snowflake-like, so mix the bits before picking a shard.
+  uint64_t h = static_cast<uint64_t>(post_id) * 0x9E3779B97F4A7C15ULL;
+  return *_shards[(h >> 32) % _shards.size()];
+}
+
+void PostCache::_Erase(Shard &shard, std::list<Entry>::iterator it) {
+  shard.bytes -= it->bytes;
+  shard.index.erase(it->post_id);
+  shard.lru.erase(it);
+}
+
+size_t PostCache::_Size(const Post &post) {
+  size_t size = sizeof(Entry) + sizeof(Post) + post.text.capacity() +
+                post.creator.username.capacity();
+  for (auto &media : post.media) {
+    size += sizeof(Media) + media.media_type.capacity();
+  }
+  for (auto &user_mention : post.user_mentions) {
+    size += sizeof(UserMention) + user_mention.username.capacity();
+  }
+  for (auto &url : post.urls) {
+    size += sizeof(Url) + url.shortened_url.capacity() +
+            url.expanded_url.capacity();
+  }
+  return size;
+}
+
+void PostCache::_Report() {
+  PostCacheStats last{};
+  std::unique_lock<std::mutex> lock(_report_mtx);
+  while (!_report_cv.wait_for(lock, std::chrono::minutes(1),
+                              [this] { return _stopped; })) {
+    auto stats = GetStats();
+    if (stats.hits == last.hits && stats.misses == last.misses) {
+      continue;
+    }
+    uint64_t lookups = (stats.hits - last.hits) + (stats.misses - last.misses);
+    LOG(info) << "PostCache hit ratio "
+              << double(stats.hits - last.hits) / lookups << " hits "
+              << stats.hits << " misses " << stats.misses << " insertions "
+              << stats.insertions << " evictions " << stats.evictions
+              << " expirations " << stats.expirations << " invalidations "
+              << stats.invalidations << " entries " << stats.entries
+              << " bytes " << stats.bytes;
+    last = stats;
+  }
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_POSTCACHE_H
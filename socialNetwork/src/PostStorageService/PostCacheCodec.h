@@ -0,0 +1,89 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_POSTCACHECODEC_H
+#define SOCIAL_NETWORK_MICROSERVICES_POSTCACHECODEC_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <nlohmann/json.hpp>
+#include <thrift/protocol/TCompactProtocol.h>
+#include <thrift/transport/TBufferTransports.h>
+
+#include "../../gen-cpp/social_network_types.h"
+
+// Memcached entries for posts start with a format byte. Entries written
+// before the byte existed are bson_as_json output and start with '{'.
+#define POST_CACHE_FORMAT_JSON '{'
+// Thrift compact protocol serialization of the Post struct.
+#define POST_CACHE_FORMAT_COMPACT 0x01
+
+namespace social_network {
+using json = nlohmann::json;
+using apache::thrift::protocol::TCompactProtocolT;
+using apache::thrift::transport::TMemoryBuffer;
+
+void post_from_json(const json &post_json, Post &post) {
+  post.req_id = post_json["req_id"];
+  post.timestamp = post_json["timestamp"];
+  post.post_id = post_json["post_id"];
+  post.creator.user_id = post_json["creator"]["user_id"];
+  post.creator.username = post_json["creator"]["username"];
+  post.post_type = post_json["post_type"];
+  post.text = post_json["text"];
+  for (auto &item : post_json["media"]) {
+    Media media;
+    media.media_id = item["media_id"];
+    media.media_type = item["media_type"];
+    post.media.emplace_back(media);
+  }
+  for (auto &item : post_json["user_mentions"]) {
+    UserMention user_mention;
+    user_mention.username = item["username"];
+    user_mention.user_id = item["user_id"];
+    post.user_mentions.emplace_back(user_mention);
+  }
+  for (auto &item : post_json["urls"]) {
+    Url url;
+    url.shortened_url = item["shortened_url"];
+    url.expanded_url = item["expanded_url"];
+    post.urls.emplace_back(url);
+  }
+}
+
+std::string encode_post(const Post &post) {
+  // The buffer keeps its allocation between calls on the same thread.
+  thread_local auto buffer = std::make_shared<TMemoryBuffer>(512);
+  thread_local TCompactProtocolT<TMemoryBuffer> protocol(buffer);
+  buffer->resetBuffer();
+  uint8_t format = POST_CACHE_FORMAT_COMPACT;
+  buffer->write(&format, 1);
+  post.write(&protocol);
+  return buffer->getBufferAsString();
+}
+
+// Decodes a cached post in either format. Throws on unknown or corrupt
+// entries; callers treat that like a cache miss.
+void decode_post(const char *data, size_t size, Post &post) {
+  if (size == 0) {
+    throw std::runtime_error("Empty post cache entry");
+  }
+  if (data[0] == POST_CACHE_FORMAT_JSON) {
+    post_from_json(json::parse(data, data + size), post);
+    return;
+  }
+  if (data[0] != POST_CACHE_FORMAT_COMPACT) {
+    throw std::runtime_error("Unknown post cache format " +
+                             std::to_string(static_cast<uint8_t>(data[0])));
+  }
+  // Reads the entry in place, without copying it into the buffer.
+  thread_local auto buffer = std::make_shared<TMemoryBuffer>();
+  thread_local TCompactProtocolT<TMemoryBuffer> protocol(buffer);
+  buffer->resetBuffer(
+      reinterpret_cast<uint8_t *>(const_cast<char *>(data + 1)),
+      static_cast<uint32_t>(size - 1));
+  post.read(&protocol);
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_POSTCACHECODEC_H
@@ -6,21 +6,36 @@
 #include <libmemcached/util.h>
 #include <mongoc.h>
 
+#include <algorithm>
+#include <cinttypes>
 #include <future>
 #include <iostream>
+#include <memory>
 #include <nlohmann/json.hpp>
+#include <set>
 #include <string>
 
 #include "../../gen-cpp/PostStorageService.h"
+#include "../Executor.h"
+#include "../bson_codec.h"
+#include "../SingleFlight.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "PostCache.h"
+#include "PostCacheCodec.h"
+
+// Longest decimal int64 plus the terminating NUL written by snprintf.
+#define POST_ID_KEY_MAX_LEN 21
+#define MIN_MONGO_READ_BATCH 8
 
 namespace social_network {
 using json = nlohmann::json;
 
 class PostStorageHandler : public PostStorageServiceIf {
  public:
-  PostStorageHandler(memcached_pool_st *, mongoc_client_pool_t *);
+  PostStorageHandler(memcached_pool_st *, memcached_pool_st *,
+                     mongoc_client_pool_t *, Executor *, bool, int,
+                     PostCache *);
   ~PostStorageHandler() override = default;
 
   void StorePost(int64_t req_id, const Post &post,
@@ -35,14 +50,44 @@ class PostStorageHandler : public PostStorageServiceIf {
 
  private:
   memcached_pool_st *_memcached_client_pool;
+  // From init_memcached_write_pool, used by _CachePosts.
+  memcached_pool_st *_memcached_write_pool;
   mongoc_client_pool_t *_mongodb_client_pool;
+  Executor *_executor;
+  bool _write_through;
+  int _mongo_read_parallelism;
+  // In-process cache in front of Memcached, nullptr when disabled.
+  PostCache *_post_cache;
+  // nullptr when the post does not exist.
+  SingleFlight<int64_t, std::shared_ptr<Post>> _post_lookups;
+
+  void _MultiGetPosts(int64_t req_id, const std::vector<int64_t> &post_ids,
+                      std::map<int64_t, Post> &posts,
+                      const opentracing::SpanContext &span_context);
+  void _LookupPosts(const std::set<int64_t> &post_ids,
+                    std::map<int64_t, Post> &posts,
+                    const opentracing::SpanContext &span_context);
+  void _FindPosts(const std::vector<int64_t> &post_ids,
+                  std::map<int64_t, Post> &posts,
+                  const opentracing::SpanContext &span_context);
+  void _FindPostsBatch(const std::vector<int64_t> &post_ids,
+                       std::map<int64_t, Post> &posts,
+                       const opentracing::SpanContext &span_context);
+  void _CachePosts(const std::map<int64_t, Post> &posts);
 };
 
 PostStorageHandler::PostStorageHandler(
     memcached_pool_st *memcached_client_pool,
-    mongoc_client_pool_t *mongodb_client_pool) {
+    memcached_pool_st *memcached_write_pool,
+    mongoc_client_pool_t *mongodb_client_pool, Executor *executor,
+    bool write_through, int mongo_read_parallelism, PostCache *post_cache) {
   _memcached_client_pool = memcached_client_pool;
+  _memcached_write_pool = memcached_write_pool;
   _mongodb_client_pool = mongodb_client_pool;
+  _executor = executor;
+  _write_through = write_through;
+  _mongo_read_parallelism = std::max(mongo_read_parallelism, 1);
+  _post_cache = post_cache;
 }
 
 void PostStorageHandler::StorePost(
@@ -158,6 +203,15 @@ void PostStorageHandler::StorePost(
   mongoc_collection_destroy(collection);
   mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
 
+  if (_post_cache) {
+    _post_cache->Invalidate(post.post_id);
+  }
+  if (_write_through) {
+    // Followers read a new post right after fan-out, so cache it now
+    // instead of on the first miss. Done off the request path.
+    _executor->Post([this, post]() { _CachePosts({{post.post_id, post}}); });
+  }
+
   span->Finish();
 }
 
@@ -173,6 +227,11 @@ void PostStorageHandler::ReadPost(
       "read_post_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
+  if (_post_cache && _post_cache->Get(post_id, _return)) {
+    span->Finish();
+    return;
+  }
+
   std::string post_id_str = std::to_string(post_id);
 
   memcached_return_t memcached_rc;
@@ -202,150 +261,36 @@ void PostStorageHandler::ReadPost(
   memcached_pool_push(_memcached_client_pool, memcached_client);
   get_span->Finish();
 
+  bool cached = false;
   if (post_mmc) {
     LOG(debug) << "Get post " << post_id << " cache hit from Memcached";
-    json post_json =
-        json::parse(std::string(post_mmc, post_mmc + post_mmc_size));
-    _return.req_id = post_json["req_id"];
-    _return.timestamp = post_json["timestamp"];
-    _return.post_id = post_json["post_id"];
-    _return.creator.user_id = post_json["creator"]["user_id"];
-    _return.creator.username = post_json["creator"]["username"];
-    _return.post_type = post_json["post_type"];
-    _return.text = post_json["text"];
-    for (auto &item : post_json["media"]) {
-      Media media;
-      media.media_id = item["media_id"];
-      media.media_type = item["media_type"];
-      _return.media.emplace_back(media);
-    }
-    for (auto &item : post_json["user_mentions"]) {
-      UserMention user_mention;
-      user_mention.username = item["username"];
-      user_mention.user_id = item["user_id"];
-      _return.user_mentions.emplace_back(user_mention);
-    }
-    for (auto &item : post_json["urls"]) {
-      Url url;
-      url.shortened_url = item["shortened_url"];
-      url.expanded_url = item["expanded_url"];
-      _return.urls.emplace_back(url);
+    try {
+      decode_post(post_mmc, post_mmc_size, _return);
+      cached = true;
+      if (_post_cache) {
+        _post_cache->Put(_return);
+      }
+    } catch (std::exception &e) {
+      LOG(warning) << "Failed to decode cached post " << post_id << ": "
+                   << e.what();
+      _return = Post();
     }
     free(post_mmc);
-  } else {
+  }
+  if (!cached) {
     // If not cached in memcached
-    mongoc_client_t *mongodb_client =
-        mongoc_client_pool_pop(_mongodb_client_pool);
-    if (!mongodb_client) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to pop a client from MongoDB pool";
-      throw se;
-    }
-
-    auto collection =
-        mongoc_client_get_collection(mongodb_client, "post", "post");
-    if (!collection) {
+    std::map<int64_t, Post> posts;
+    _LookupPosts({post_id}, posts, span->context());
+    if (posts.empty()) {
+      LOG(warning) << "Post_id: " << post_id << " doesn't exist in MongoDB";
       ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to create collection user from DB user";
-      mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+      se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+      se.message =
+          "Post_id: " + std::to_string(post_id) + " doesn't exist in MongoDB";
       throw se;
     }
-
-    bson_t *query = bson_new();
-    BSON_APPEND_INT64(query, "post_id", post_id);
-    auto find_span = opentracing::Tracer::Global()->StartSpan(
-        "post_storage_mongo_find_client",
-        {opentracing::ChildOf(&span->context())});
-    mongoc_cursor_t *cursor =
-        mongoc_collection_find_with_opts(collection, query, nullptr, nullptr);
-    const bson_t *doc;
-    bool found = mongoc_cursor_next(cursor, &doc);
-    find_span->Finish();
-    if (!found) {
-      bson_error_t error;
-      if (mongoc_cursor_error(cursor, &error)) {
-        LOG(warning) << error.message;
-        bson_destroy(query);
-        mongoc_cursor_destroy(cursor);
-        mongoc_collection_destroy(collection);
-        mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-        se.message = error.message;
-        throw se;
-      } else {
-        LOG(warning) << "Post_id: " << post_id << " doesn't exist in MongoDB";
-        bson_destroy(query);
-        mongoc_cursor_destroy(cursor);
-        mongoc_collection_destroy(collection);
-        mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
-        se.message =
-            "Post_id: " + std::to_string(post_id) + " doesn't exist in MongoDB";
-        throw se;
-      }
-    } else {
-      LOG(debug) << "Post_id: " << post_id << " found in MongoDB";
-      auto post_json_char = bson_as_json(doc, nullptr);
-      json post_json = json::parse(post_json_char);
-      _return.req_id = post_json["req_id"];
-      _return.timestamp = post_json["timestamp"];
-      _return.post_id = post_json["post_id"];
-      _return.creator.user_id = post_json["creator"]["user_id"];
-      _return.creator.username = post_json["creator"]["username"];
-      _return.post_type = post_json["post_type"];
-      _return.text = post_json["text"];
-      for (auto &item : post_json["media"]) {
-        Media media;
-        media.media_id = item["media_id"];
-        media.media_type = item["media_type"];
-        _return.media.emplace_back(media);
-      }
-      for (auto &item : post_json["user_mentions"]) {
-        UserMention user_mention;
-        user_mention.username = item["username"];
-        user_mention.user_id = item["user_id"];
-        _return.user_mentions.emplace_back(user_mention);
-      }
-      for (auto &item : post_json["urls"]) {
-        Url url;
-        url.shortened_url = item["shortened_url"];
-        url.expanded_url = item["expanded_url"];
-        _return.urls.emplace_back(url);
-      }
-      bson_destroy(query);
-      mongoc_cursor_destroy(cursor);
-      mongoc_collection_destroy(collection);
-      mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-
-      // upload post to memcached
-      memcached_client =
-          memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
-      if (!memcached_client) {
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
-        se.message = "Failed to pop a client from memcached pool";
-        throw se;
-      }
-      auto set_span = opentracing::Tracer::Global()->StartSpan(
-          "post_storage_mmc_set_client",
-          {opentracing::ChildOf(&span->context())});
-
-      memcached_rc = memcached_set(
-          memcached_client, post_id_str.c_str(), post_id_str.length(),
-          post_json_char, std::strlen(post_json_char), static_cast<time_t>(0),
-          static_cast<uint32_t>(0));
-      if (memcached_rc != MEMCACHED_SUCCESS) {
-        LOG(warning) << "Failed to set post to Memcached: "
-                     << memcached_strerror(memcached_client, memcached_rc);
-      }
-      set_span->Finish();
-      bson_free(post_json_char);
-      memcached_pool_push(_memcached_client_pool, memcached_client);
-    }
+    LOG(debug) << "Post_id: " << post_id << " found in MongoDB";
+    _return = std::move(posts.begin()->second);
   }
 
   span->Finish();
@@ -377,6 +322,52 @@ void PostStorageHandler::ReadPosts(
     throw se;
   }
   std::map<int64_t, Post> return_map;
+  std::vector<int64_t> remote_post_ids;
+  for (auto &post_id : post_ids) {
+    Post post;
+    if (_post_cache && _post_cache->Get(post_id, post)) {
+      return_map.emplace(post_id, std::move(post));
+      post_ids_not_cached.erase(post_id);
+    } else {
+      remote_post_ids.emplace_back(post_id);
+    }
+  }
+
+  if (!remote_post_ids.empty()) {
+    std::map<int64_t, Post> memcached_posts;
+    _MultiGetPosts(req_id, remote_post_ids, memcached_posts, span->context());
+    for (auto &it : memcached_posts) {
+      if (_post_cache) {
+        _post_cache->Put(it.second);
+      }
+      post_ids_not_cached.erase(it.first);
+    }
+    return_map.insert(memcached_posts.begin(), memcached_posts.end());
+  }
+
+  // Find the rest in MongoDB
+  if (!post_ids_not_cached.empty()) {
+    _LookupPosts(post_ids_not_cached, return_map, span->context());
+  }
+
+  if (return_map.size() != post_ids.size()) {
+    LOG(error) << "Return set incomplete";
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "Return set incomplete";
+    throw se;
+  }
+
+  for (auto &post_id : post_ids) {
+    _return.emplace_back(return_map[post_id]);
+  }
+  span->Finish();
+}
+
+void PostStorageHandler::_MultiGetPosts(
+    int64_t req_id, const std::vector<int64_t> &post_ids,
+    std::map<int64_t, Post> &posts,
+    const opentracing::SpanContext &span_context) {
   memcached_return_t memcached_rc;
   auto memcached_client =
       memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
@@ -387,20 +378,18 @@ void PostStorageHandler::ReadPosts(
     throw se;
   }
 
-  char **keys;
-  size_t *key_sizes;
-  keys = new char *[post_ids.size()];
-  key_sizes = new size_t[post_ids.size()];
-  int idx = 0;
-  for (auto &post_id : post_ids) {
-    std::string key_str = std::to_string(post_id);
-    keys[idx] = new char[key_str.length() + 1];
-    strcpy(keys[idx], key_str.c_str());
-    key_sizes[idx] = key_str.length();
-    idx++;
+  // All keys live in one arena. It is sized up front so the pointers into
+  // it stay valid.
+  std::vector<char> key_arena(post_ids.size() * POST_ID_KEY_MAX_LEN);
+  std::vector<const char *> keys(post_ids.size());
+  std::vector<size_t> key_sizes(post_ids.size());
+  for (size_t i = 0; i < post_ids.size(); ++i) {
+    char *key = &key_arena[i * POST_ID_KEY_MAX_LEN];
+    keys[i] = key;
+    key_sizes[i] = snprintf(key, POST_ID_KEY_MAX_LEN, "%" PRId64, post_ids[i]);
   }
-  memcached_rc =
-      memcached_mget(memcached_client, keys, key_sizes, post_ids.size());
+  memcached_rc = memcached_mget(memcached_client, keys.data(),
+                                key_sizes.data(), post_ids.size());
   if (memcached_rc != MEMCACHED_SUCCESS) {
     LOG(error) << "Cannot get post_ids of request " << req_id << ": "
                << memcached_strerror(memcached_client, memcached_rc);
@@ -417,7 +406,7 @@ void PostStorageHandler::ReadPosts(
   size_t return_value_length;
   uint32_t flags;
   auto get_span = opentracing::Tracer::Global()->StartSpan(
-      "post_storage_mmc_mget_client", {opentracing::ChildOf(&span->context())});
+      "post_storage_mmc_mget_client", {opentracing::ChildOf(&span_context)});
 
   while (true) {
     return_value =
@@ -438,196 +427,235 @@ void PostStorageHandler::ReadPosts(
       throw se;
     }
     Post new_post;
-    json post_json = json::parse(
-        std::string(return_value, return_value + return_value_length));
-    new_post.req_id = post_json["req_id"];
-    new_post.timestamp = post_json["timestamp"];
-    new_post.post_id = post_json["post_id"];
-    new_post.creator.user_id = post_json["creator"]["user_id"];
-    new_post.creator.username = post_json["creator"]["username"];
-    new_post.post_type = post_json["post_type"];
-    new_post.text = post_json["text"];
-    for (auto &item : post_json["media"]) {
-      Media media;
-      media.media_id = item["media_id"];
-      media.media_type = item["media_type"];
-      new_post.media.emplace_back(media);
-    }
-    for (auto &item : post_json["user_mentions"]) {
-      UserMention user_mention;
-      user_mention.username = item["username"];
-      user_mention.user_id = item["user_id"];
-      new_post.user_mentions.emplace_back(user_mention);
-    }
-    for (auto &item : post_json["urls"]) {
-      Url url;
-      url.shortened_url = item["shortened_url"];
-      url.expanded_url = item["expanded_url"];
-      new_post.urls.emplace_back(url);
+    try {
+      decode_post(return_value, return_value_length, new_post);
+    } catch (std::exception &e) {
+      // Left out of posts, so it is read from MongoDB instead.
+      LOG(warning) << "Failed to decode cached post "
+                   << std::string(return_key, return_key_length) << ": "
+                   << e.what();
+      free(return_value);
+      continue;
     }
-    return_map.insert(std::make_pair(new_post.post_id, new_post));
-    post_ids_not_cached.erase(new_post.post_id);
+    posts.insert(std::make_pair(new_post.post_id, new_post));
     free(return_value);
   }
   get_span->Finish();
   memcached_quit(memcached_client);
   memcached_pool_push(_memcached_client_pool, memcached_client);
-  for (int i = 0; i < post_ids.size(); ++i) {
-    delete keys[i];
-  }
-  delete[] keys;
-  delete[] key_sizes;
-
-  std::vector<std::future<void>> set_futures;
-  std::map<int64_t, std::string> post_json_map;
+}
 
-  // Find the rest in MongoDB
-  if (!post_ids_not_cached.empty()) {
-    mongoc_client_t *mongodb_client =
-        mongoc_client_pool_pop(_mongodb_client_pool);
-    if (!mongodb_client) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to pop a client from MongoDB pool";
-      throw se;
+void PostStorageHandler::_LookupPosts(
+    const std::set<int64_t> &post_ids, std::map<int64_t, Post> &posts,
+    const opentracing::SpanContext &span_context) {
+  // Concurrent misses on the same post share one MongoDB lookup.
+  std::vector<int64_t> led_post_ids;
+  std::map<int64_t, std::shared_future<std::shared_ptr<Post>>> joined;
+  for (auto &post_id : post_ids) {
+    std::shared_future<std::shared_ptr<Post>> future;
+    if (_post_lookups.Lead(post_id, &future)) {
+      led_post_ids.emplace_back(post_id);
+    } else {
+      joined.emplace(post_id, future);
     }
-    auto collection =
-        mongoc_client_get_collection(mongodb_client, "post", "post");
-    if (!collection) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to create collection user from DB user";
-      mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-      throw se;
+  }
+
+  if (!led_post_ids.empty()) {
+    std::map<int64_t, Post> found_posts;
+    try {
+      _FindPosts(led_post_ids, found_posts, span_context);
+    } catch (...) {
+      for (auto &post_id : led_post_ids) {
+        _post_lookups.Fail(post_id, std::current_exception());
+      }
+      throw;
     }
-    bson_t *query = bson_new();
-    bson_t query_child;
-    bson_t query_post_id_list;
-    const char *key;
-    idx = 0;
-    char buf[16];
-
-    BSON_APPEND_DOCUMENT_BEGIN(query, "post_id", &query_child);
-    BSON_APPEND_ARRAY_BEGIN(&query_child, "$in", &query_post_id_list);
-    for (auto &item : post_ids_not_cached) {
-      bson_uint32_to_string(idx, &key, buf, sizeof buf);
-      BSON_APPEND_INT64(&query_post_id_list, key, item);
-      idx++;
+    for (auto &post_id : led_post_ids) {
+      auto it = found_posts.find(post_id);
+      _post_lookups.Finish(post_id, it == found_posts.end()
+                                        ? nullptr
+                                        : std::make_shared<Post>(it->second));
     }
-    bson_append_array_end(&query_child, &query_post_id_list);
-    bson_append_document_end(query, &query_child);
-    mongoc_cursor_t *cursor =
-        mongoc_collection_find_with_opts(collection, query, nullptr, nullptr);
-    const bson_t *doc;
-
-    auto find_span = opentracing::Tracer::Global()->StartSpan(
-        "mongo_find_client", {opentracing::ChildOf(&span->context())});
-    while (true) {
-      bool found = mongoc_cursor_next(cursor, &doc);
-      if (!found) {
-        break;
-      }
-      Post new_post;
-      char *post_json_char = bson_as_json(doc, nullptr);
-      json post_json = json::parse(post_json_char);
-      new_post.req_id = post_json["req_id"];
-      new_post.timestamp = post_json["timestamp"];
-      new_post.post_id = post_json["post_id"];
-      new_post.creator.user_id = post_json["creator"]["user_id"];
-      new_post.creator.username = post_json["creator"]["username"];
-      new_post.post_type = post_json["post_type"];
-      new_post.text = post_json["text"];
-      for (auto &item : post_json["media"]) {
-        Media media;
-        media.media_id = item["media_id"];
-        media.media_type = item["media_type"];
-        new_post.media.emplace_back(media);
-      }
-      for (auto &item : post_json["user_mentions"]) {
-        UserMention user_mention;
-        user_mention.username = item["username"];
-        user_mention.user_id = item["user_id"];
-        new_post.user_mentions.emplace_back(user_mention);
-      }
-      for (auto &item : post_json["urls"]) {
-        Url url;
-        url.shortened_url = item["shortened_url"];
-        url.expanded_url = item["expanded_url"];
-        new_post.urls.emplace_back(url);
+    if (_post_cache) {
+      for (auto &it : found_posts) {
+        _post_cache->Put(it.second);
       }
-      post_json_map.insert({new_post.post_id, std::string(post_json_char)});
-      return_map.insert({new_post.post_id, new_post});
-      bson_free(post_json_char);
     }
-    find_span->Finish();
-    bson_error_t error;
-    if (mongoc_cursor_error(cursor, &error)) {
-      LOG(warning) << error.message;
-      bson_destroy(query);
-      mongoc_cursor_destroy(cursor);
-      mongoc_collection_destroy(collection);
-      mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = error.message;
-      throw se;
+    if (!found_posts.empty()) {
+      // Fill the cache off the request path.
+      _executor->Post([this, found_posts]() { _CachePosts(found_posts); });
     }
-    bson_destroy(query);
-    mongoc_cursor_destroy(cursor);
-    mongoc_collection_destroy(collection);
-    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    posts.insert(found_posts.begin(), found_posts.end());
+  }
 
-    // upload posts to memcached
-    set_futures.emplace_back(std::async(std::launch::async, [&]() {
-      memcached_return_t _rc;
-      auto _memcached_client =
-          memcached_pool_pop(_memcached_client_pool, true, &_rc);
-      if (!_memcached_client) {
-        LOG(error) << "Failed to pop a client from memcached pool";
-        ServiceException se;
-        se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
-        se.message = "Failed to pop a client from memcached pool";
-        throw se;
-      }
-      auto set_span = opentracing::Tracer::Global()->StartSpan(
-          "mmc_set_client", {opentracing::ChildOf(&span->context())});
-      for (auto &it : post_json_map) {
-        std::string id_str = std::to_string(it.first);
-        _rc = memcached_set(_memcached_client, id_str.c_str(), id_str.length(),
-                            it.second.c_str(), it.second.length(),
-                            static_cast<time_t>(0), static_cast<uint32_t>(0));
-      }
-      memcached_pool_push(_memcached_client_pool, _memcached_client);
-      set_span->Finish();
-    }));
+  for (auto &it : joined) {
+    auto post = it.second.get();
+    if (post) {
+      posts.emplace(it.first, *post);
+    }
   }
+}
 
-  if (return_map.size() != post_ids.size()) {
+void PostStorageHandler::_FindPosts(
+    const std::vector<int64_t> &post_ids, std::map<int64_t, Post> &posts,
+    const opentracing::SpanContext &span_context) {
+  // Split large misses into up to _mongo_read_parallelism $in queries that
+  // run concurrently; small ones stay a single query.
+  size_t batch_size = std::max<size_t>(
+      MIN_MONGO_READ_BATCH,
+      (post_ids.size() + _mongo_read_parallelism - 1) /
+          _mongo_read_parallelism);
+  std::vector<std::vector<int64_t>> batches;
+  for (size_t i = 0; i < post_ids.size(); i += batch_size) {
+    batches.emplace_back(
+        post_ids.begin() + i,
+        post_ids.begin() + std::min(i + batch_size, post_ids.size()));
+  }
+
+  std::vector<Future<std::map<int64_t, Post>>> futures;
+  for (size_t i = 1; i < batches.size(); ++i) {
+    futures.emplace_back(_executor->Submit([this, &batches, i,
+                                            &span_context]() {
+      std::map<int64_t, Post> found_posts;
+      _FindPostsBatch(batches[i], found_posts, span_context);
+      return found_posts;
+    }));
+  }
+  // Every batch has to finish before returning, since they reference
+  // batches and span_context.
+  std::exception_ptr error;
+  try {
+    _FindPostsBatch(batches[0], posts, span_context);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  for (auto &future : futures) {
     try {
-      for (auto &it : set_futures) {
-        it.get();
-      }
+      auto found_posts = future.get();
+      posts.insert(found_posts.begin(), found_posts.end());
     } catch (...) {
-      LOG(warning) << "Failed to set posts to memcached";
+      if (!error) {
+        error = std::current_exception();
+      }
     }
-    LOG(error) << "Return set incomplete";
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void PostStorageHandler::_FindPostsBatch(
+    const std::vector<int64_t> &post_ids, std::map<int64_t, Post> &posts,
+    const opentracing::SpanContext &span_context) {
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
     ServiceException se;
-    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
-    se.message = "Return set incomplete";
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection =
+      mongoc_client_get_collection(mongodb_client, "post", "post");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection user from DB user";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
     throw se;
   }
+  bson_t *query = bson_new();
+  bson_t query_child;
+  bson_t query_post_id_list;
+  const char *key;
+  int idx = 0;
+  char buf[16];
 
-  for (auto &post_id : post_ids) {
-    _return.emplace_back(return_map[post_id]);
+  BSON_APPEND_DOCUMENT_BEGIN(query, "post_id", &query_child);
+  BSON_APPEND_ARRAY_BEGIN(&query_child, "$in", &query_post_id_list);
+  for (auto &item : post_ids) {
+    bson_uint32_to_string(idx, &key, buf, sizeof buf);
+    BSON_APPEND_INT64(&query_post_id_list, key, item);
+    idx++;
+  }
+  bson_append_array_end(&query_child, &query_post_id_list);
+  bson_append_document_end(query, &query_child);
+
+  // Fetch only the fields of Post, not _id.
+  bson_t *opts = BCON_NEW(
+      "projection", "{", "_id", BCON_BOOL(false), "post_id", BCON_BOOL(true),
+      "timestamp", BCON_BOOL(true), "text", BCON_BOOL(true), "req_id",
+      BCON_BOOL(true), "post_type", BCON_BOOL(true), "creator",
+      BCON_BOOL(true), "urls", BCON_BOOL(true), "user_mentions",
+      BCON_BOOL(true), "media", BCON_BOOL(true), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+
+  auto find_span = opentracing::Tracer::Global()->StartSpan(
+      "post_storage_mongo_find_client", {opentracing::ChildOf(&span_context)});
+  while (true) {
+    bool found = mongoc_cursor_next(cursor, &doc);
+    if (!found) {
+      break;
+    }
+    Post new_post;
+    if (!bson_decode_post(doc, &new_post)) {
+      LOG(warning) << "Skipping a post document without post_id";
+      continue;
+    }
+    posts.insert({new_post.post_id, new_post});
+  }
+  find_span->Finish();
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    LOG(warning) << error.message;
+    bson_destroy(query);
+    mongoc_cursor_destroy(cursor);
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    bson_destroy(opts);
+    throw se;
   }
+  bson_destroy(query);
+  bson_destroy(opts);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+}
 
-  try {
-    for (auto &it : set_futures) {
-      it.get();
+void PostStorageHandler::_CachePosts(const std::map<int64_t, Post> &posts) {
+  memcached_return_t memcached_rc;
+  auto memcached_client =
+      memcached_pool_pop(_memcached_write_pool, true, &memcached_rc);
+  if (!memcached_client) {
+    LOG(warning) << "Failed to pop a client from memcached write pool";
+    return;
+  }
+  // The sets are buffered without waiting for replies and sent in one flush,
+  // instead of a round trip per post.
+  for (auto &it : posts) {
+    std::string id_str = std::to_string(it.first);
+    std::string post_cache_entry = encode_post(it.second);
+    memcached_rc = memcached_set(
+        memcached_client, id_str.c_str(), id_str.length(),
+        post_cache_entry.c_str(), post_cache_entry.length(),
+        static_cast<time_t>(0), static_cast<uint32_t>(0));
+    if (memcached_rc != MEMCACHED_SUCCESS &&
+        memcached_rc != MEMCACHED_BUFFERED) {
+      LOG(warning) << "Failed to set post to Memcached: "
+                   << memcached_strerror(memcached_client, memcached_rc);
     }
-  } catch (...) {
-    LOG(warning) << "Failed to set posts to memcached";
   }
+  memcached_rc = memcached_flush_buffers(memcached_client);
+  if (memcached_rc != MEMCACHED_SUCCESS) {
+    LOG(warning) << "Failed to flush posts to Memcached: "
+                 << memcached_strerror(memcached_client, memcached_rc);
+  }
+  memcached_pool_push(_memcached_write_pool, memcached_client);
 }
 
 }  // namespace social_network
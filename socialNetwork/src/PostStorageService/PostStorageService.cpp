@@ -1,8 +1,4 @@
 #include <signal.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include "../utils.h"
 #include "../utils_memcached.h"
@@ -10,19 +6,19 @@
 #include "../utils_thrift.h"
 #include "PostStorageHandler.h"
 
-using apache::thrift::protocol::TBinaryProtocolFactory;
-using apache::thrift::server::TThreadedServer;
-using apache::thrift::transport::TFramedTransportFactory;
-using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
 static memcached_pool_st* memcached_client_pool;
+static memcached_pool_st* memcached_write_pool;
 static mongoc_client_pool_t* mongodb_client_pool;
 
 void sigintHandler(int sig) {
   if (memcached_client_pool != nullptr) {
     memcached_pool_destroy(memcached_client_pool);
   }
+  if (memcached_write_pool != nullptr) {
+    memcached_pool_destroy(memcached_write_pool);
+  }
   if (mongodb_client_pool != nullptr) {
     mongoc_client_pool_destroy(mongodb_client_pool);
   }
@@ -46,12 +42,41 @@ int main(int argc, char* argv[]) {
 
   int memcached_conns = config_json["post-storage-memcached"]["connections"];
   int memcached_timeout = config_json["post-storage-memcached"]["timeout_ms"];
+  bool write_through =
+      config_json["post-storage-service"].value("cache_write_through", false);
+  int mongo_read_parallelism =
+      config_json["post-storage-service"].value("mongo_read_parallelism", 4);
+
+  int executor_threads =
+      config_json["post-storage-service"].value("executor_threads", 64);
+  int executor_max_queued =
+      config_json["post-storage-service"].value("executor_max_queued", 0);
+  Executor executor("post-storage-service", executor_threads,
+                    executor_max_queued);
+
+  int post_cache_mb =
+      config_json["post-storage-service"].value("post_cache_mb", 0);
+  int post_cache_ttl_ms =
+      config_json["post-storage-service"].value("post_cache_ttl_ms", 60000);
+  int post_cache_shards =
+      config_json["post-storage-service"].value("post_cache_shards", 16);
+  std::unique_ptr<PostCache> post_cache;
+  if (post_cache_mb > 0) {
+    post_cache.reset(new PostCache(size_t(post_cache_mb) << 20,
+                                   post_cache_ttl_ms, post_cache_shards));
+    LOG(info) << "In-process post cache of " << post_cache_mb << " MB";
+  }
 
   memcached_client_pool = init_memcached_client_pool(
       config_json, "post-storage", 32, memcached_conns);
+  // Cache fills run on the executor, so this pool only grows to as many
+  // clients as it has threads.
+  memcached_write_pool = init_memcached_write_pool(
+      config_json, "post-storage", 1, memcached_conns);
   mongodb_client_pool =
       init_mongodb_client_pool(config_json, "post-storage", mongodb_conns);
-  if (memcached_client_pool == nullptr || mongodb_client_pool == nullptr) {
+  if (memcached_client_pool == nullptr || memcached_write_pool == nullptr ||
+      mongodb_client_pool == nullptr) {
     return EXIT_FAILURE;
   }
 
@@ -69,15 +94,16 @@ int main(int argc, char* argv[]) {
     }
   }
   mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
-  std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
 
-  TThreadedServer server(std::make_shared<PostStorageServiceProcessor>(
-                             std::make_shared<PostStorageHandler>(
-                                 memcached_client_pool, mongodb_client_pool)),
-                         server_socket,
-                         std::make_shared<TFramedTransportFactory>(),
-                         std::make_shared<TBinaryProtocolFactory>());
+  auto server = get_server(
+      config_json, "post-storage-service",
+      std::make_shared<PostStorageServiceProcessor>(
+          std::make_shared<PostStorageHandler>(
+              memcached_client_pool, memcached_write_pool, mongodb_client_pool,
+              &executor, write_through, mongo_read_parallelism,
+              post_cache.get())),
+      "0.0.0.0", port);
 
   LOG(info) << "Starting the post-storage-service server...";
-  server.serve();
+  server->serve();
 }
@@ -0,0 +1,195 @@
+// Measures PostStorageHandler::ReadPosts when none of the posts are in
+// Memcached, against the MongoDB and Memcached of config/service-config.json.
+// Each read misses, fetches the posts from MongoDB and refills Memcached.
+//
+// It stores num_posts posts with ids from first_post_id on, then reads
+// iterations random batches of batch_size of them. Each batch is deleted from
+// Memcached before it is read. Reports p50 and p99 once with
+// mongo_read_parallelism 1 and once with the given value.
+//
+// Run it from the socialNetwork directory with the post-storage MongoDB and
+// Memcached reachable, e.g. inside the post-storage-service container.
+//
+// Usage: ReadPostsBenchmark [num_posts] [iterations] [batch_size]
+//                           [mongo_read_parallelism] [first_post_id]
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../PostStorageService/PostStorageHandler.h"
+#include "../utils.h"
+#include "../utils_memcached.h"
+#include "../utils_mongodb.h"
+
+using namespace social_network;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+struct Options {
+  int num_posts;
+  int iterations;
+  int batch_size;
+  int mongo_read_parallelism;
+  int64_t first_post_id;
+};
+
+struct Result {
+  double p50_us;
+  double p99_us;
+};
+
+Post MakePost(int64_t post_id) {
+  Post post;
+  post.post_id = post_id;
+  post.req_id = post_id;
+  post.timestamp = 1603412345678 + post_id % 1000000;
+  post.post_type = PostType::POST;
+  post.creator.user_id = post_id % 1000;
+  post.creator.username = "username_" + std::to_string(post.creator.user_id);
+  post.text = std::string(140, 'x');
+  UserMention user_mention;
+  user_mention.user_id = 100;
+  user_mention.username = "username_100";
+  post.user_mentions.emplace_back(user_mention);
+  Url url;
+  url.shortened_url = "http://short-url/abcdefghi0";
+  url.expanded_url = "http://www.example.com/some/long/path/0";
+  post.urls.emplace_back(url);
+  return post;
+}
+
+void DeleteFromMemcached(memcached_pool_st *memcached_client_pool,
+                         const std::vector<int64_t> &post_ids) {
+  memcached_return_t memcached_rc;
+  auto memcached_client =
+      memcached_pool_pop(memcached_client_pool, true, &memcached_rc);
+  if (!memcached_client) {
+    LOG(fatal) << "Failed to pop a client from memcached pool";
+    exit(EXIT_FAILURE);
+  }
+  for (auto post_id : post_ids) {
+    auto key = std::to_string(post_id);
+    memcached_delete(memcached_client, key.c_str(), key.length(), 0);
+  }
+  memcached_pool_push(memcached_client_pool, memcached_client);
+}
+
+// The posts of an earlier run with the same ids are reused. They are written
+// in order, so the last one tells whether that run finished.
+void StorePosts(const Options &options, PostStorageHandler *handler) {
+  std::map<std::string, std::string> carrier;
+  Post last;
+  try {
+    handler->ReadPost(last, 0, options.first_post_id + options.num_posts - 1,
+                      carrier);
+    return;
+  } catch (const ServiceException &) {
+  }
+  for (int i = 0; i < options.num_posts; ++i) {
+    try {
+      handler->StorePost(i, MakePost(options.first_post_id + i), carrier);
+    } catch (const ServiceException &) {
+      // Stored by an earlier run.
+    }
+  }
+}
+
+Result Run(const Options &options, PostStorageHandler *handler,
+           memcached_pool_st *memcached_client_pool) {
+  std::map<std::string, std::string> carrier;
+  std::mt19937_64 rng(42);
+  std::uniform_int_distribution<int64_t> pick(0, options.num_posts - 1);
+
+  std::vector<int64_t> latencies;
+  std::vector<int64_t> post_ids;
+  std::vector<Post> posts;
+  for (int i = 0; i < options.iterations; ++i) {
+    post_ids.clear();
+    for (int j = 0; j < options.batch_size; ++j) {
+      post_ids.emplace_back(options.first_post_id + pick(rng));
+    }
+    DeleteFromMemcached(memcached_client_pool, post_ids);
+    posts.clear();
+    auto start = steady_clock::now();
+    handler->ReadPosts(posts, i, post_ids, carrier);
+    latencies.emplace_back(
+        duration_cast<nanoseconds>(steady_clock::now() - start).count());
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  Result result;
+  result.p50_us =
+      latencies.empty() ? 0 : latencies[latencies.size() / 2] / 1000.0;
+  result.p99_us =
+      latencies.empty() ? 0 : latencies[latencies.size() * 99 / 100] / 1000.0;
+  return result;
+}
+
+void Print(const std::string &name, const Result &result) {
+  std::cout << name << ": p50 " << result.p50_us << " us, p99 "
+            << result.p99_us << " us" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+  Options options;
+  options.num_posts = std::max(argc > 1 ? std::stoi(argv[1]) : 100000, 1);
+  options.iterations = std::max(argc > 2 ? std::stoi(argv[2]) : 10000, 1);
+  options.batch_size = std::max(argc > 3 ? std::stoi(argv[3]) : 30, 1);
+  options.mongo_read_parallelism =
+      std::max(argc > 4 ? std::stoi(argv[4]) : 4, 1);
+  options.first_post_id =
+      argc > 5 ? std::stoll(argv[5]) : int64_t(1) << 62;
+
+  json config_json;
+  if (load_config_file("config/service-config.json", &config_json) != 0) {
+    exit(EXIT_FAILURE);
+  }
+  int mongodb_conns = config_json["post-storage-mongodb"]["connections"];
+  int memcached_conns = config_json["post-storage-memcached"]["connections"];
+  auto memcached_client_pool = init_memcached_client_pool(
+      config_json, "post-storage", 4, memcached_conns);
+  auto memcached_write_pool = init_memcached_write_pool(
+      config_json, "post-storage", 1, memcached_conns);
+  auto mongodb_client_pool =
+      init_mongodb_client_pool(config_json, "post-storage", mongodb_conns);
+  if (memcached_client_pool == nullptr || memcached_write_pool == nullptr ||
+      mongodb_client_pool == nullptr) {
+    return EXIT_FAILURE;
+  }
+
+  {
+    // Cache fills still queued on the executor use the handlers, so they are
+    // destroyed after it.
+    std::unique_ptr<PostStorageHandler> serial_handler;
+    std::unique_ptr<PostStorageHandler> parallel_handler;
+    Executor executor("read-posts-benchmark", 16, 0);
+    serial_handler.reset(new PostStorageHandler(
+        memcached_client_pool, memcached_write_pool, mongodb_client_pool,
+        &executor, false, 1, nullptr));
+    parallel_handler.reset(new PostStorageHandler(
+        memcached_client_pool, memcached_write_pool, mongodb_client_pool,
+        &executor, false, options.mongo_read_parallelism, nullptr));
+
+    StorePosts(options, serial_handler.get());
+    std::cout << "posts=" << options.num_posts
+              << " iterations=" << options.iterations
+              << " batch_size=" << options.batch_size << std::endl;
+    Print("mongo_read_parallelism=1",
+          Run(options, serial_handler.get(), memcached_client_pool));
+    Print("mongo_read_parallelism=" +
+              std::to_string(options.mongo_read_parallelism),
+          Run(options, parallel_handler.get(), memcached_client_pool));
+  }
+
+  memcached_pool_destroy(memcached_write_pool);
+  memcached_pool_destroy(memcached_client_pool);
+  mongoc_client_pool_destroy(mongodb_client_pool);
+  return 0;
+}
@@ -0,0 +1,312 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_RELOADABLETABLE_H
+#define SOCIAL_NETWORK_MICROSERVICES_RELOADABLETABLE_H
+
+#include <errno.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logger.h"
+
+namespace social_network {
+
+// Parses "<number>" or "<number><unit>" with unit one of ms, s, m, h, d. A
+// bare number is in milliseconds. Anything else, including values that do not
+// fit in milliseconds, maps to 0.
+std::chrono::milliseconds ParseDuration(const std::string &str) {
+  size_t end = 0;
+  while (end < str.size() && isdigit(str[end])) {
+    end++;
+  }
+  if (end == 0) {
+    return std::chrono::milliseconds(0);
+  }
+  auto unit = str.substr(end);
+  int64_t ms_per_unit;
+  if (unit.empty() || unit == "ms") {
+    ms_per_unit = 1;
+  } else if (unit == "s") {
+    ms_per_unit = 1000;
+  } else if (unit == "m") {
+    ms_per_unit = 60 * 1000;
+  } else if (unit == "h") {
+    ms_per_unit = 60 * 60 * 1000;
+  } else if (unit == "d") {
+    ms_per_unit = 24 * 60 * 60 * 1000;
+  } else {
+    return std::chrono::milliseconds(0);
+  }
+  errno = 0;
+  int64_t value = strtoll(str.c_str(), nullptr, 10);
+  if (errno == ERANGE ||
+      value > std::numeric_limits<int64_t>::max() / ms_per_unit) {
+    LOG(warning) << "Duration " << str << " is out of range, using 0";
+    return std::chrono::milliseconds(0);
+  }
+  return std::chrono::milliseconds(value * ms_per_unit);
+}
+
+// Number of SIGHUPs received since InstallSighupReload().
+std::atomic<uint64_t> &SighupCount() {
+  static std::atomic<uint64_t> count(0);
+  return count;
+}
+
+// Makes SIGHUP reload every started ReloadableTable of the process. The
+// handler only increments a lock-free atomic, which is async-signal-safe.
+void InstallSighupReload() {
+  SighupCount();
+  signal(SIGHUP, [](int) { SighupCount().fetch_add(1); });
+}
+
+/*
+ * Values looked up by key on the request path and reloaded from files.
+ *
+ * Handlers register their keys once and keep the returned slot. The loader
+ * reads the files into a map from key to Value, and every load or
+ * registration publishes an immutable, versioned snapshot with one Value per
+ * slot through an atomic pointer swap, so Get() is an acquire load plus an
+ * array index. Unknown keys get Value().
+ *
+ * Once started, a background thread reloads when the mtime of a file
+ * changes, after RequestReload(), and after SIGHUP (InstallSighupReload()).
+ * A failed load keeps the previous values.
+ */
+template <class Value>
+class ReloadableTable {
+ public:
+  static constexpr int kMaxSlots = 64;
+
+  using Loader = std::function<bool(const std::vector<std::string> &,
+                                    std::map<std::string, Value> *)>;
+
+  ReloadableTable(const std::string &name, Loader loader);
+  ~ReloadableTable();
+
+  ReloadableTable(const ReloadableTable &) = delete;
+  ReloadableTable &operator=(const ReloadableTable &) = delete;
+
+  // Sets the files to read and loads them.
+  void Load(const std::vector<std::string> &paths);
+  int Register(const std::string &key);
+  void Start(int poll_interval_ms);
+  void Stop();
+  void RequestReload();
+
+  Value Get(int slot) const;
+  uint64_t Version() const;
+  std::vector<std::string> Keys();
+
+ private:
+  struct Snapshot {
+    uint64_t version;
+    std::vector<Value> values;
+  };
+
+  std::string _name;
+  Loader _loader;
+
+  std::mutex _mtx;
+  std::vector<std::string> _paths;
+  std::vector<std::string> _keys;
+  std::map<std::string, Value> _values;
+  std::vector<std::unique_ptr<Snapshot>> _retired;
+  std::atomic<Snapshot *> _snapshot;
+
+  std::atomic<bool> _reload_requested;
+  std::atomic<bool> _running;
+  std::thread _thread;
+
+  void _Reload();
+  void _Publish();
+  std::vector<int64_t> _Mtimes();
+  void _Run(int poll_interval_ms);
+};
+
+template <class Value>
+ReloadableTable<Value>::ReloadableTable(const std::string &name,
+                                        Loader loader) {
+  _name = name;
+  _loader = std::move(loader);
+  _snapshot = nullptr;
+  _reload_requested = false;
+  _running = false;
+}
+
+template <class Value>
+ReloadableTable<Value>::~ReloadableTable() {
+  Stop();
+}
+
+template <class Value>
+void ReloadableTable<Value>::Load(const std::vector<std::string> &paths) {
+  {
+    std::unique_lock<std::mutex> lock(_mtx);
+    _paths = paths;
+  }
+  _Reload();
+}
+
+template <class Value>
+int ReloadableTable<Value>::Register(const std::string &key) {
+  std::unique_lock<std::mutex> lock(_mtx);
+  for (int slot = 0; slot < _keys.size(); ++slot) {
+    if (_keys[slot] == key) {
+      return slot;
+    }
+  }
+  if (_keys.size() == kMaxSlots) {
+    LOG(fatal) << _name << " is full, cannot register " << key;
+    exit(EXIT_FAILURE);
+  }
+  _keys.emplace_back(key);
+  _Publish();
+  return _keys.size() - 1;
+}
+
+template <class Value>
+void ReloadableTable<Value>::Start(int poll_interval_ms) {
+  if (_running.exchange(true)) {
+    return;
+  }
+  _thread = std::thread(&ReloadableTable::_Run, this, poll_interval_ms);
+}
+
+template <class Value>
+void ReloadableTable<Value>::Stop() {
+  if (!_running.exchange(false)) {
+    return;
+  }
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+}
+
+template <class Value>
+void ReloadableTable<Value>::RequestReload() {
+  _reload_requested = true;
+}
+
+template <class Value>
+Value ReloadableTable<Value>::Get(int slot) const {
+  auto snapshot = _snapshot.load(std::memory_order_acquire);
+  if (!snapshot || slot < 0 || slot >= snapshot->values.size()) {
+    return Value();
+  }
+  return snapshot->values[slot];
+}
+
+template <class Value>
+uint64_t ReloadableTable<Value>::Version() const {
+  auto snapshot = _snapshot.load(std::memory_order_acquire);
+  return snapshot ? snapshot->version : 0;
+}
+
+template <class Value>
+std::vector<std::string> ReloadableTable<Value>::Keys() {
+  std::unique_lock<std::mutex> lock(_mtx);
+  return _keys;
+}
+
+template <class Value>
+void ReloadableTable<Value>::_Reload() {
+  std::vector<std::string> paths;
+  {
+    std::unique_lock<std::mutex> lock(_mtx);
+    paths = _paths;
+  }
+  std::map<std::string, Value> values;
+  try {
+    if (!_loader(paths, &values)) {
+      return;
+    }
+  } catch (const std::exception &e) {
+    // Reloads run on the background thread, where an escaping exception
+    // would terminate the process.
+    LOG(error) << "Failed to load " << _name << ": " << e.what();
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(_mtx);
+  _values = std::move(values);
+  _Publish();
+  LOG(info) << "Loaded " << _name << " version " << _retired.back()->version;
+}
+
+// Requires _mtx to be held.
+template <class Value>
+void ReloadableTable<Value>::_Publish() {
+  std::unique_ptr<Snapshot> snapshot(new Snapshot);
+  auto prev = _snapshot.load(std::memory_order_relaxed);
+  snapshot->version = prev ? prev->version + 1 : 1;
+  for (auto &key : _keys) {
+    auto it = _values.find(key);
+    snapshot->values.emplace_back(it != _values.end() ? it->second : Value());
+  }
+  _snapshot.store(snapshot.get(), std::memory_order_release);
+  // Readers may still hold older snapshots, and reloads are rare, so they are
+  // kept alive for the lifetime of the table instead of being reclaimed.
+  _retired.emplace_back(std::move(snapshot));
+}
+
+template <class Value>
+std::vector<int64_t> ReloadableTable<Value>::_Mtimes() {
+  std::vector<std::string> paths;
+  {
+    std::unique_lock<std::mutex> lock(_mtx);
+    paths = _paths;
+  }
+  std::vector<int64_t> mtimes;
+  for (auto &path : paths) {
+    struct stat st;
+    mtimes.emplace_back(
+        stat(path.c_str(), &st) != 0
+            ? -1
+            : int64_t(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec);
+  }
+  return mtimes;
+}
+
+template <class Value>
+void ReloadableTable<Value>::_Run(int poll_interval_ms) {
+  auto last_mtimes = _Mtimes();
+  auto last_sighups = SighupCount().load();
+  auto next_poll = std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(poll_interval_ms);
+  while (_running) {
+    // Short sleep so SIGHUP and Stop() are picked up promptly.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    bool changed = false;
+    if (std::chrono::steady_clock::now() >= next_poll) {
+      auto curr_mtimes = _Mtimes();
+      changed = curr_mtimes != last_mtimes;
+      last_mtimes = curr_mtimes;
+      next_poll = std::chrono::steady_clock::now() +
+          std::chrono::milliseconds(poll_interval_ms);
+    }
+    auto curr_sighups = SighupCount().load();
+    if (curr_sighups != last_sighups) {
+      changed = true;
+      last_sighups = curr_sighups;
+    }
+    if (changed || _reload_requested.exchange(false)) {
+      _Reload();
+    }
+  }
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_RELOADABLETABLE_H
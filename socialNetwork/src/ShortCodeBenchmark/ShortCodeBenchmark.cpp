@@ -0,0 +1,121 @@
+// Compares the way UrlShortenHandler::_GenRandomStr used to make short codes,
+// a std::mt19937 shared behind a mutex and one append per character, with
+// gen_short_code from ShortCode.h, which draws from a per-thread wyrand.
+//
+// Each of threads threads generates iterations 10-character codes with both.
+// The character counts of the new codes are checked to be roughly uniform.
+//
+// Usage: ShortCodeBenchmark [iterations] [threads]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../UrlShortenService/ShortCode.h"
+
+using namespace social_network;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+class MutexGenerator {
+ public:
+  MutexGenerator()
+      : _generator(std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::system_clock::now().time_since_epoch())
+                       .count() %
+                   0xffffffff),
+        _distribution(0, 61) {}
+
+  std::string GenRandomStr(int length) {
+    const char char_map[] = "abcdefghijklmnopqrstuvwxyzABCDEF"
+                            "GHIJKLMNOPQRSTUVWXYZ0123456789";
+    std::string return_str;
+    _thread_lock.lock();
+    for (int i = 0; i < length; ++i) {
+      return_str.append(1, char_map[_distribution(_generator)]);
+    }
+    _thread_lock.unlock();
+    return return_str;
+  }
+
+ private:
+  std::mt19937 _generator;
+  std::uniform_int_distribution<int> _distribution;
+  std::mutex _thread_lock;
+};
+
+// Runs fn(thread, i) iterations times on each thread and returns the time
+// per code across all threads.
+template <class Fn>
+double Time(int iterations, int threads, Fn fn) {
+  auto start = steady_clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t]() {
+      for (int i = 0; i < iterations; ++i) {
+        fn(t, i);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start);
+  return double(elapsed.count()) / (double(iterations) * threads);
+}
+
+int main(int argc, char *argv[]) {
+  int iterations = argc > 1 ? std::stoi(argv[1]) : 1000000;
+  int threads = std::max(argc > 2 ? std::stoi(argv[2]) : 8, 1);
+
+  MutexGenerator mutex_generator;
+  std::vector<size_t> sinks(threads * 16);
+  auto mutex_ns = Time(iterations, threads, [&](int t, int) {
+    sinks[t * 16] += mutex_generator.GenRandomStr(10)[0];
+  });
+
+  std::vector<std::vector<size_t>> counts(threads,
+                                          std::vector<size_t>(256, 0));
+  auto short_code_ns = Time(iterations, threads, [&](int t, int) {
+    auto code = gen_short_code(10);
+    for (char c : code) {
+      counts[t][static_cast<unsigned char>(c)]++;
+    }
+  });
+
+  // Every base62 character should appear close to 1/62 of the time.
+  std::string chars = SHORT_CODE_CHARS;
+  double expected = double(iterations) * threads * 10 / chars.size();
+  double max_error = 0;
+  for (char c : chars) {
+    size_t count = 0;
+    for (auto &thread_counts : counts) {
+      count += thread_counts[static_cast<unsigned char>(c)];
+    }
+    max_error = std::max(max_error, std::abs(count - expected) / expected);
+  }
+  if (max_error > 0.05) {
+    std::cerr << "Short code characters are not uniform, max error "
+              << max_error << std::endl;
+    return 1;
+  }
+
+  size_t sink = 0;
+  for (auto s : sinks) {
+    sink += s;
+  }
+  std::cout << "iterations=" << iterations << " threads=" << threads << " ("
+            << sink << ")" << std::endl;
+  std::cout << "mutex mt19937: " << mutex_ns
+            << " ns/code, thread-local wyrand: " << short_code_ns
+            << " ns/code, max character frequency error " << max_error
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,82 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SINGLEFLIGHT_H
+#define SOCIAL_NETWORK_MICROSERVICES_SINGLEFLIGHT_H
+
+#include <exception>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+namespace social_network {
+
+/*
+ * Coalesces concurrent lookups of the same key. The first caller to Lead()
+ * a key does the lookup and publishes the result with Finish() or Fail();
+ * callers that arrive meanwhile get a future for that result instead of
+ * repeating the lookup. Nothing is cached once the lookup completes.
+ */
+template <class Key, class Value>
+class SingleFlight {
+ public:
+  // Returns true if the caller leads the lookup for key and must call
+  // Finish or Fail for it. Otherwise *future receives the leader's result.
+  bool Lead(const Key &key, std::shared_future<Value> *future);
+  void Finish(const Key &key, const Value &value);
+  void Fail(const Key &key, std::exception_ptr error);
+
+ private:
+  struct Flight {
+    std::promise<Value> promise;
+    std::shared_future<Value> future;
+  };
+  std::mutex _mtx;
+  std::unordered_map<Key, Flight> _flights;
+
+  bool _Take(const Key &key, std::promise<Value> *promise);
+};
+
+template <class Key, class Value>
+bool SingleFlight<Key, Value>::Lead(const Key &key,
+                                    std::shared_future<Value> *future) {
+  std::unique_lock<std::mutex> lock(_mtx);
+  auto it = _flights.find(key);
+  if (it != _flights.end()) {
+    *future = it->second.future;
+    return false;
+  }
+  auto &flight = _flights[key];
+  flight.future = flight.promise.get_future().share();
+  return true;
+}
+
+template <class Key, class Value>
+void SingleFlight<Key, Value>::Finish(const Key &key, const Value &value) {
+  std::promise<Value> promise;
+  if (_Take(key, &promise)) {
+    promise.set_value(value);
+  }
+}
+
+template <class Key, class Value>
+void SingleFlight<Key, Value>::Fail(const Key &key, std::exception_ptr error) {
+  std::promise<Value> promise;
+  if (_Take(key, &promise)) {
+    promise.set_exception(error);
+  }
+}
+
+template <class Key, class Value>
+bool SingleFlight<Key, Value>::_Take(const Key &key,
+                                     std::promise<Value> *promise) {
+  std::unique_lock<std::mutex> lock(_mtx);
+  auto it = _flights.find(key);
+  if (it == _flights.end()) {
+    return false;
+  }
+  *promise = std::move(it->second.promise);
+  _flights.erase(it);
+  return true;
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_SINGLEFLIGHT_H
@@ -0,0 +1,189 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_COMPRESSEDIDLIST_H
+#define SOCIAL_NETWORK_MICROSERVICES_COMPRESSEDIDLIST_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace social_network {
+
+/*
+ * Immutable sorted set of ids, stored as varint-encoded deltas. The first id
+ * is zigzag-encoded, every following one as its distance to the previous
+ * id, so dense user ids take one or two bytes each instead of eight.
+ * Updates return a new list and leave this one untouched, so readers can
+ * keep decoding a list they got before the update.
+ */
+class CompressedIdList {
+ public:
+  CompressedIdList() = default;
+  // ids must be sorted and free of duplicates.
+  explicit CompressedIdList(const std::vector<int64_t> &ids);
+
+  size_t Size() const { return _size; }
+  size_t Bytes() const { return _data.size(); }
+
+  // Appends the ids in ascending order, or at most limit of those that are
+  // at least min_id.
+  void Decode(std::vector<int64_t> *ids) const;
+  void Decode(std::vector<int64_t> *ids, int64_t min_id, size_t limit) const;
+  bool Contains(int64_t id) const;
+
+  // Return the list with id added or removed, or nullptr if that would not
+  // change it.
+  std::shared_ptr<const CompressedIdList> Insert(int64_t id) const;
+  std::shared_ptr<const CompressedIdList> Erase(int64_t id) const;
+
+ private:
+  std::string _data;
+  size_t _size = 0;
+
+  // Reads the id at pos and advances pos past it.
+  int64_t _Next(size_t *pos, bool first, int64_t prev) const;
+  static void _Append(std::string *data, bool first, int64_t prev,
+                      int64_t id);
+  static void _AppendVarint(std::string *data, uint64_t value);
+};
+
+CompressedIdList::CompressedIdList(const std::vector<int64_t> &ids) {
+  _data.reserve(ids.size() * 2);
+  for (size_t i = 0; i < ids.size(); ++i) {
+    _Append(&_data, i == 0, i == 0 ? 0 : ids[i - 1], ids[i]);
+  }
+  _data.shrink_to_fit();
+  _size = ids.size();
+}
+
+void CompressedIdList::Decode(std::vector<int64_t> *ids) const {
+  ids->reserve(ids->size() + _size);
+  size_t pos = 0;
+  int64_t id = 0;
+  for (size_t i = 0; i < _size; ++i) {
+    id = _Next(&pos, i == 0, id);
+    ids->emplace_back(id);
+  }
+}
+
+void CompressedIdList::Decode(std::vector<int64_t> *ids, int64_t min_id,
+                              size_t limit) const {
+  size_t pos = 0;
+  int64_t id = 0;
+  for (size_t i = 0; i < _size && limit > 0; ++i) {
+    id = _Next(&pos, i == 0, id);
+    if (id >= min_id) {
+      ids->emplace_back(id);
+      --limit;
+    }
+  }
+}
+
+bool CompressedIdList::Contains(int64_t id) const {
+  size_t pos = 0;
+  int64_t curr = 0;
+  for (size_t i = 0; i < _size; ++i) {
+    curr = _Next(&pos, i == 0, curr);
+    if (curr >= id) {
+      return curr == id;
+    }
+  }
+  return false;
+}
+
+std::shared_ptr<const CompressedIdList> CompressedIdList::Insert(
+    int64_t id) const {
+  size_t pos = 0;
+  int64_t prev = 0;
+  size_t i = 0;
+  for (; i < _size; ++i) {
+    size_t start = pos;
+    int64_t curr = _Next(&pos, i == 0, prev);
+    if (curr == id) {
+      return nullptr;
+    }
+    if (curr > id) {
+      // Re-encode the successor relative to id and copy the rest as is.
+      auto list = std::make_shared<CompressedIdList>();
+      list->_data.reserve(_data.size() + 10);
+      list->_data.append(_data, 0, start);
+      _Append(&list->_data, i == 0, prev, id);
+      _Append(&list->_data, false, id, curr);
+      list->_data.append(_data, pos, std::string::npos);
+      list->_size = _size + 1;
+      return list;
+    }
+    prev = curr;
+  }
+  auto list = std::make_shared<CompressedIdList>();
+  list->_data.reserve(_data.size() + 10);
+  list->_data = _data;
+  _Append(&list->_data, _size == 0, prev, id);
+  list->_size = _size + 1;
+  return list;
+}
+
+std::shared_ptr<const CompressedIdList> CompressedIdList::Erase(
+    int64_t id) const {
+  size_t pos = 0;
+  int64_t prev = 0;
+  for (size_t i = 0; i < _size; ++i) {
+    size_t start = pos;
+    int64_t curr = _Next(&pos, i == 0, prev);
+    if (curr > id) {
+      return nullptr;
+    }
+    if (curr == id) {
+      auto list = std::make_shared<CompressedIdList>();
+      list->_data.reserve(_data.size());
+      list->_data.append(_data, 0, start);
+      if (i + 1 < _size) {
+        int64_t next = _Next(&pos, false, curr);
+        _Append(&list->_data, i == 0, prev, next);
+      }
+      list->_data.append(_data, pos, std::string::npos);
+      list->_size = _size - 1;
+      return list;
+    }
+    prev = curr;
+  }
+  return nullptr;
+}
+
+int64_t CompressedIdList::_Next(size_t *pos, bool first, int64_t prev) const {
+  uint64_t value = 0;
+  int shift = 0;
+  uint8_t byte;
+  do {
+    byte = static_cast<uint8_t>(_data[(*pos)++]);
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  if (first) {
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+  }
+  return static_cast<int64_t>(static_cast<uint64_t>(prev) + value);
+}
+
+void CompressedIdList::_Append(std::string *data, bool first, int64_t prev,
+                               int64_t id) {
+  if (first) {
+    _AppendVarint(data, (static_cast<uint64_t>(id) << 1) ^
+                            static_cast<uint64_t>(id >> 63));
+  } else {
+    _AppendVarint(data, static_cast<uint64_t>(id) -
+                            static_cast<uint64_t>(prev));
+  }
+}
+
+void CompressedIdList::_AppendVarint(std::string *data, uint64_t value) {
+  while (value >= 0x80) {
+    data->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  data->push_back(static_cast<char>(value));
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_COMPRESSEDIDLIST_H
@@ -0,0 +1,389 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_GRAPHSTORE_H
+#define SOCIAL_NETWORK_MICROSERVICES_GRAPHSTORE_H
+
+#include <bson/bson.h>
+#include <mongoc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../bson_codec.h"
+#include "../logger.h"
+#include "CompressedIdList.h"
+
+namespace social_network {
+
+struct GraphStoreStats {
+  size_t users;
+  size_t edges;
+  size_t bytes;
+};
+
+/*
+ * In-memory copy of the social graph. Every user keeps a follower and a
+ * followee list as a CompressedIdList, and the users are split over shards
+ * by user_id, each under its own mutex. Readers take the current lists out
+ * of the shard and decode them outside the lock; Follow and Unfollow swap
+ * in updated copies. MongoDB and Redis stay the durable copy: the store is
+ * filled from a MongoDB snapshot at startup and answers nothing until the
+ * snapshot is in place.
+ *
+ * Updates are only seen by the instance that applies them, so the store is
+ * meant for deployments with a single social-graph-service.
+ */
+class GraphStore {
+ public:
+  explicit GraphStore(int num_shards);
+
+  GraphStore(const GraphStore &) = delete;
+  GraphStore &operator=(const GraphStore &) = delete;
+
+  bool Loaded() const { return _loaded; }
+
+  // Append the ids in ascending order. Return false if the snapshot is not
+  // loaded yet or the user is unknown; callers then read Redis or MongoDB.
+  bool GetFollowers(int64_t user_id, std::vector<int64_t> *ids);
+  bool GetFollowees(int64_t user_id, std::vector<int64_t> *ids);
+  // At most limit followers with ids of at least min_id.
+  bool GetFollowersPage(int64_t user_id, int64_t min_id, size_t limit,
+                        std::vector<int64_t> *ids);
+  bool GetFollowerCount(int64_t user_id, int64_t *count);
+
+  void InsertUser(int64_t user_id);
+  void Follow(int64_t user_id, int64_t followee_id);
+  void Unfollow(int64_t user_id, int64_t followee_id);
+
+  // Bulk loading from a single thread. Updates applied between BeginLoad
+  // and FinishLoad are replayed on top of the snapshot, since the snapshot
+  // may predate them. AbortLoad drops a partial snapshot.
+  void BeginLoad();
+  void LoadUser(int64_t user_id, std::vector<int64_t> followers,
+                std::vector<int64_t> followees);
+  void FinishLoad();
+  void AbortLoad();
+
+  GraphStoreStats GetStats();
+
+ private:
+  struct Node {
+    std::shared_ptr<const CompressedIdList> followers;
+    std::shared_ptr<const CompressedIdList> followees;
+  };
+  struct Shard {
+    std::mutex mtx;
+    std::unordered_map<int64_t, Node> nodes;
+  };
+  struct Update {
+    enum Type { INSERT_USER, FOLLOW, UNFOLLOW } type;
+    int64_t user_id;
+    int64_t followee_id;
+  };
+
+  std::vector<std::unique_ptr<Shard>> _shards;
+  std::vector<std::unordered_map<int64_t, Node>> _snapshot;
+  std::atomic<bool> _loaded{};
+
+  // Updates hold it shared, FinishLoad exclusively, so no update is lost
+  // between reading the snapshot and installing it.
+  std::shared_timed_mutex _load_mtx;
+  bool _loading{};
+  std::mutex _pending_mtx;
+  std::vector<Update> _pending;
+
+  size_t _ShardIndex(int64_t user_id) const;
+  std::shared_ptr<const CompressedIdList> _Get(int64_t user_id,
+                                               bool followers);
+  void _Update(const Update &update);
+  void _Apply(const Update &update);
+  static Node _NewNode();
+};
+
+GraphStore::GraphStore(int num_shards) {
+  num_shards = std::max(num_shards, 1);
+  for (int i = 0; i < num_shards; ++i) {
+    _shards.emplace_back(new Shard());
+  }
+}
+
+bool GraphStore::GetFollowers(int64_t user_id, std::vector<int64_t> *ids) {
+  auto list = _Get(user_id, true);
+  if (!list) {
+    return false;
+  }
+  list->Decode(ids);
+  return true;
+}
+
+bool GraphStore::GetFollowees(int64_t user_id, std::vector<int64_t> *ids) {
+  auto list = _Get(user_id, false);
+  if (!list) {
+    return false;
+  }
+  list->Decode(ids);
+  return true;
+}
+
+bool GraphStore::GetFollowersPage(int64_t user_id, int64_t min_id,
+                                  size_t limit, std::vector<int64_t> *ids) {
+  auto list = _Get(user_id, true);
+  if (!list) {
+    return false;
+  }
+  list->Decode(ids, min_id, limit);
+  return true;
+}
+
+bool GraphStore::GetFollowerCount(int64_t user_id, int64_t *count) {
+  auto list = _Get(user_id, true);
+  if (!list) {
+    return false;
+  }
+  *count = list->Size();
+  return true;
+}
+
+void GraphStore::InsertUser(int64_t user_id) {
+  _Update({Update::INSERT_USER, user_id, 0});
+}
+
+void GraphStore::Follow(int64_t user_id, int64_t followee_id) {
+  _Update({Update::FOLLOW, user_id, followee_id});
+}
+
+void GraphStore::Unfollow(int64_t user_id, int64_t followee_id) {
+  _Update({Update::UNFOLLOW, user_id, followee_id});
+}
+
+void GraphStore::BeginLoad() {
+  std::unique_lock<std::shared_timed_mutex> load_lock(_load_mtx);
+  std::unique_lock<std::mutex> lock(_pending_mtx);
+  _loading = true;
+  _pending.clear();
+  _snapshot.clear();
+  _snapshot.resize(_shards.size());
+}
+
+void GraphStore::LoadUser(int64_t user_id, std::vector<int64_t> followers,
+                          std::vector<int64_t> followees) {
+  std::sort(followers.begin(), followers.end());
+  followers.erase(std::unique(followers.begin(), followers.end()),
+                  followers.end());
+  std::sort(followees.begin(), followees.end());
+  followees.erase(std::unique(followees.begin(), followees.end()),
+                  followees.end());
+  Node node;
+  node.followers = std::make_shared<const CompressedIdList>(followers);
+  node.followees = std::make_shared<const CompressedIdList>(followees);
+  _snapshot[_ShardIndex(user_id)][user_id] = std::move(node);
+}
+
+void GraphStore::FinishLoad() {
+  std::unique_lock<std::shared_timed_mutex> load_lock(_load_mtx);
+  for (size_t i = 0; i < _shards.size(); ++i) {
+    std::unique_lock<std::mutex> lock(_shards[i]->mtx);
+    _shards[i]->nodes.swap(_snapshot[i]);
+  }
+  _snapshot.clear();
+  std::unique_lock<std::mutex> lock(_pending_mtx);
+  for (auto &update : _pending) {
+    _Apply(update);
+  }
+  _pending.clear();
+  _pending.shrink_to_fit();
+  _loading = false;
+  _loaded = true;
+}
+
+void GraphStore::AbortLoad() {
+  std::unique_lock<std::shared_timed_mutex> load_lock(_load_mtx);
+  std::unique_lock<std::mutex> lock(_pending_mtx);
+  _snapshot.clear();
+  _pending.clear();
+  _pending.shrink_to_fit();
+  _loading = false;
+}
+
+GraphStoreStats GraphStore::GetStats() {
+  GraphStoreStats stats{0, 0, 0};
+  for (auto &shard : _shards) {
+    std::unique_lock<std::mutex> lock(shard->mtx);
+    stats.users += shard->nodes.size();
+    for (auto &node : shard->nodes) {
+      stats.edges += node.second.followees->Size();
+      stats.bytes += node.second.followers->Bytes() +
+                     node.second.followees->Bytes();
+    }
+  }
+  return stats;
+}
+
+size_t GraphStore::_ShardIndex(int64_t user_id) const {
+  uint64_t h = static_cast<uint64_t>(user_id) * 0x9E3779B97F4A7C15ULL;
+  return (h >> 32) % _shards.size();
+}
+
+// Returns nullptr if the snapshot is not loaded or the user is unknown. The
+// list is decoded outside the shard lock.
+std::shared_ptr<const CompressedIdList> GraphStore::_Get(int64_t user_id,
+                                                         bool followers) {
+  if (!_loaded) {
+    return nullptr;
+  }
+  auto &shard = *_shards[_ShardIndex(user_id)];
+  std::unique_lock<std::mutex> lock(shard.mtx);
+  auto it = shard.nodes.find(user_id);
+  if (it == shard.nodes.end()) {
+    return nullptr;
+  }
+  return followers ? it->second.followers : it->second.followees;
+}
+
+void GraphStore::_Update(const Update &update) {
+  std::shared_lock<std::shared_timed_mutex> load_lock(_load_mtx);
+  std::unique_lock<std::mutex> lock(_pending_mtx);
+  if (_loading) {
+    // Applied and recorded in one step so the replay keeps their order.
+    _Apply(update);
+    _pending.emplace_back(update);
+    return;
+  }
+  lock.unlock();
+  _Apply(update);
+}
+
+void GraphStore::_Apply(const Update &update) {
+  auto apply = [this](int64_t user_id, bool followers, int64_t id,
+                      bool insert) {
+    auto &shard = *_shards[_ShardIndex(user_id)];
+    std::unique_lock<std::mutex> lock(shard.mtx);
+    auto it = shard.nodes.find(user_id);
+    if (it == shard.nodes.end()) {
+      if (!insert) {
+        return;
+      }
+      it = shard.nodes.emplace(user_id, _NewNode()).first;
+    }
+    auto &list = followers ? it->second.followers : it->second.followees;
+    auto updated = insert ? list->Insert(id) : list->Erase(id);
+    if (updated) {
+      list = std::move(updated);
+    }
+  };
+
+  switch (update.type) {
+    case Update::INSERT_USER: {
+      auto &shard = *_shards[_ShardIndex(update.user_id)];
+      std::unique_lock<std::mutex> lock(shard.mtx);
+      if (shard.nodes.find(update.user_id) == shard.nodes.end()) {
+        shard.nodes.emplace(update.user_id, _NewNode());
+      }
+      break;
+    }
+    case Update::FOLLOW:
+      apply(update.user_id, false, update.followee_id, true);
+      apply(update.followee_id, true, update.user_id, true);
+      break;
+    case Update::UNFOLLOW:
+      apply(update.user_id, false, update.followee_id, false);
+      apply(update.followee_id, true, update.user_id, false);
+      break;
+  }
+}
+
+GraphStore::Node GraphStore::_NewNode() {
+  static auto empty = std::make_shared<const CompressedIdList>();
+  return Node{empty, empty};
+}
+
+// Fills store from the social-graph collection. Runs in the background at
+// startup; GetFollowers and GetFollowees use Redis and MongoDB until it
+// finishes. Returns false if MongoDB could not be read.
+bool load_graph_store(mongoc_client_pool_t *mongodb_client_pool,
+                      GraphStore *store) {
+  auto start = std::chrono::steady_clock::now();
+  store->BeginLoad();
+
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(error) << "Failed to pop a client from MongoDB pool";
+    store->AbortLoad();
+    return false;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "social-graph", "social-graph");
+  if (!collection) {
+    LOG(error) << "Failed to create collection social_graph from MongoDB";
+    mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+    store->AbortLoad();
+    return false;
+  }
+  bson_t *query = bson_new();
+  bson_t *opts = BCON_NEW("projection", "{", "_id", BCON_BOOL(false), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+
+  const bson_t *doc;
+  std::vector<std::pair<int64_t, int64_t>> edges;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter;
+    int64_t user_id;
+    if (!bson_iter_init_find(&iter, doc, "user_id") ||
+        !bson_iter_read_int64(&iter, &user_id)) {
+      continue;
+    }
+    std::vector<int64_t> followers;
+    std::vector<int64_t> followees;
+    edges.clear();
+    bson_decode_timestamped_ids(doc, "followers", "user_id", &edges);
+    followers.reserve(edges.size());
+    for (auto &edge : edges) {
+      followers.emplace_back(edge.first);
+    }
+    edges.clear();
+    bson_decode_timestamped_ids(doc, "followees", "user_id", &edges);
+    followees.reserve(edges.size());
+    for (auto &edge : edges) {
+      followees.emplace_back(edge.first);
+    }
+    store->LoadUser(user_id, std::move(followers), std::move(followees));
+  }
+
+  bson_error_t error;
+  bool failed = mongoc_cursor_error(cursor, &error);
+  if (failed) {
+    LOG(error) << "Failed to load the social graph from MongoDB: "
+               << error.message;
+  }
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  if (failed) {
+    store->AbortLoad();
+    return false;
+  }
+
+  store->FinishLoad();
+  auto stats = store->GetStats();
+  LOG(info) << "Loaded the social graph into memory: " << stats.users
+            << " users, " << stats.edges << " edges, " << stats.bytes
+            << " bytes in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - start)
+                   .count()
+            << " ms";
+  return true;
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_GRAPHSTORE_H
@@ -4,63 +4,53 @@
 #include <bson/bson.h>
 #include <mongoc.h>
 #include <sw/redis++/redis++.h>
-#include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cinttypes>
 #include <future>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
-#include <regex>
 
 #include "../../gen-cpp/SocialGraphService.h"
 #include "../../gen-cpp/UserService.h"
 #include "../ClientPool.h"
+#include "../Executor.h"
+#include "../bson_codec.h"
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "../wait_config.h"
+#include "GraphStore.h"
 
 using namespace sw::redis;
 
+#define NO_FOLLOWERS_TTL_MS 10000
+#define NO_FOLLOWERS_CACHE_SIZE 100000
+// Members per ZADD when the followers_by_id index of a user is built.
+#define FOLLOWERS_BY_ID_BATCH 10000
+
 namespace social_network {
 
 using std::chrono::duration_cast;
 using std::chrono::milliseconds;
 using std::chrono::system_clock;
 
-std::chrono::seconds parse_duration(const std::string &str) {
-    // Regular expression to extract the number (assuming it's seconds)
-    std::regex regex("(\\d+)([smhd])");
-    std::smatch match;
-    
-    if (regex_match(str, match, regex)) {
-        int time_value = std::stoi(match[1].str());  // Extract the number
-        char time_unit = match[2].str()[0];          // Extract the time unit (s, m, h, d)
-
-        switch (time_unit) {
-            case 's':
-                return std::chrono::seconds(time_value);  // Return as seconds
-            case 'm':
-                return std::chrono::minutes(time_value);  // Return as minutes
-            case 'h':
-                return std::chrono::hours(time_value);    // Return as hours
-            case 'd':
-                return std::chrono::hours(time_value * 24);  // Return as days (converted to hours)
-        }
-    }
-
-    return std::chrono::seconds(0);  // Default to 0 if invalid input
-}
-
 class SocialGraphHandler : public SocialGraphServiceIf {
  public:
   SocialGraphHandler(mongoc_client_pool_t *, Redis *,
-                     ClientPool<ThriftClient<UserServiceClient>> *);
+                     ClientPool<ThriftClient<UserServiceClient>> *,
+                     Executor *, GraphStore *);
   SocialGraphHandler(mongoc_client_pool_t *, Redis *, Redis *,
-      ClientPool<ThriftClient<UserServiceClient>>*);
+      ClientPool<ThriftClient<UserServiceClient>>*, Executor *, GraphStore *);
   SocialGraphHandler(mongoc_client_pool_t *, RedisCluster *,
-                     ClientPool<ThriftClient<UserServiceClient>> *);
+                     ClientPool<ThriftClient<UserServiceClient>> *,
+                     Executor *, GraphStore *);
   ~SocialGraphHandler() override = default;
   bool IsRedisReplicationEnabled();
   void GetFollowers(std::vector<int64_t> &, int64_t, int64_t,
@@ -78,6 +68,14 @@ class SocialGraphHandler : public SocialGraphServiceIf {
       const std::map<std::string, std::string> &) override;
   void InsertUser(int64_t, int64_t,
                   const std::map<std::string, std::string> &) override;
+  void GetFollowersPage(std::vector<int64_t> &, int64_t, int64_t, int64_t,
+                        int32_t,
+                        const std::map<std::string, std::string> &) override;
+  int64_t GetFollowerCount(
+      int64_t, int64_t, const std::map<std::string, std::string> &) override;
+  void GetHighFanoutFollowees(
+      std::vector<int64_t> &, int64_t, int64_t, int64_t,
+      const std::map<std::string, std::string> &) override;
 
  private:
   mongoc_client_pool_t *_mongodb_client_pool;
@@ -86,40 +84,86 @@ class SocialGraphHandler : public SocialGraphServiceIf {
   Redis *_redis_primary_client_pool;
   RedisCluster *_redis_cluster_client_pool;
   ClientPool<ThriftClient<UserServiceClient>> *_user_service_client_pool;
+  Executor *_executor;
+  // Serves GetFollowers and GetFollowees from memory once loaded. nullptr
+  // when disabled.
+  GraphStore *_graph_store;
+  int _mongo_update_follower_future_wait_slot =
+      WaitConfig::Global().Register("SocialGraphService-mongo_update_follower_future");
+  int _mongo_update_followee_future_wait_slot =
+      WaitConfig::Global().Register("SocialGraphService-mongo_update_followee_future");
+  int _redis_update_future_wait_slot =
+      WaitConfig::Global().Register("SocialGraphService-redis_update_future");
+  int _user_id_future_wait_slot =
+      WaitConfig::Global().Register("SocialGraphService-user_id_future");
+  int _followee_id_future_wait_slot =
+      WaitConfig::Global().Register("SocialGraphService-followee_id_future");
+
+  // Users that MongoDB had no followers for, until when to believe that.
+  // Redis cannot hold an empty followers zset, so without this every count
+  // for such a user would read MongoDB. A follow through this
+  // instance clears the entry; one through another instance is seen once
+  // it expires.
+  std::mutex _no_followers_mtx;
+  std::unordered_map<int64_t, std::chrono::steady_clock::time_point>
+      _no_followers;
+
+  // GetFollowers, but answered from _no_followers when it can be.
+  void _GetFollowersUnlessNone(std::vector<int64_t> &followers, int64_t req_id,
+                               int64_t user_id,
+                               const std::map<std::string, std::string> &);
+
+  // "<user_id>:followers_by_id" holds the followers of user_id as 19-digit
+  // zero-padded ids, all with score 0, so ZRANGEBYLEX pages them by id. The
+  // empty member marks the index as complete. Follow and Unfollow keep it up
+  // to date, and GetFollowersPage builds it the first time it is missing.
+  static std::string _FollowersByIdKey(int64_t user_id);
+  static std::string _FollowersByIdMember(int64_t follower_id);
+  void _BuildFollowersById(int64_t user_id,
+                           const std::vector<int64_t> &followers);
 };
 
 SocialGraphHandler::SocialGraphHandler(
     mongoc_client_pool_t *mongodb_client_pool, Redis *redis_client_pool,
-    ClientPool<ThriftClient<UserServiceClient>> *user_service_client_pool) {
+    ClientPool<ThriftClient<UserServiceClient>> *user_service_client_pool,
+    Executor *executor, GraphStore *graph_store) {
   _mongodb_client_pool = mongodb_client_pool;
   _redis_client_pool = redis_client_pool;
   _redis_replica_client_pool = nullptr;
   _redis_primary_client_pool = nullptr;
   _redis_cluster_client_pool = nullptr;
   _user_service_client_pool = user_service_client_pool;
+  _executor = executor;
+  _graph_store = graph_store;
 }
 
 SocialGraphHandler::SocialGraphHandler(
     mongoc_client_pool_t* mongodb_client_pool, Redis* redis_replica_client_pool, Redis* redis_primary_client_pool,
-    ClientPool<ThriftClient<UserServiceClient>>* user_service_client_pool) {
+    ClientPool<ThriftClient<UserServiceClient>>* user_service_client_pool,
+    Executor* executor, GraphStore* graph_store) {
     _mongodb_client_pool = mongodb_client_pool;
     _redis_client_pool = nullptr;
     _redis_replica_client_pool = redis_replica_client_pool;
     _redis_primary_client_pool = redis_primary_client_pool;
     _redis_cluster_client_pool = nullptr;
     _user_service_client_pool = user_service_client_pool;
+    _executor = executor;
+    _graph_store = graph_store;
 }
 
 SocialGraphHandler::SocialGraphHandler(
     mongoc_client_pool_t *mongodb_client_pool,
     RedisCluster *redis_cluster_client_pool,
-    ClientPool<ThriftClient<UserServiceClient>> *user_service_client_pool) {
+    ClientPool<ThriftClient<UserServiceClient>> *user_service_client_pool,
+    Executor *executor, GraphStore *graph_store) {
   _mongodb_client_pool = mongodb_client_pool;
   _redis_client_pool = nullptr;
   _redis_replica_client_pool = nullptr;
   _redis_primary_client_pool = nullptr;
   _redis_cluster_client_pool = redis_cluster_client_pool;
   _user_service_client_pool = user_service_client_pool;
+  _executor = executor;
+  _graph_store = graph_store;
 }
 
 bool SocialGraphHandler::IsRedisReplicationEnabled() {
@@ -142,14 +186,11 @@ void SocialGraphHandler::Follow(
       duration_cast<milliseconds>(system_clock::now().time_since_epoch())
           .count();
 
-  std::ifstream times_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/wait_times.json");
-  nlohmann::json times;
-  times_file >> times;
 
   // Handle mongo_update_follower_future
   std::future_status mongo_update_follower_future_status;
-  std::future<void> mongo_update_follower_future =
-      std::async(std::launch::async, [&]() {
+  Future<void> mongo_update_follower_future =
+      _executor->Submit([&]() {
         mongoc_client_t *mongodb_client =
             mongoc_client_pool_pop(_mongodb_client_pool);
         if (!mongodb_client) {
@@ -205,7 +246,7 @@ void SocialGraphHandler::Follow(
         mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       });
   do {
-      switch (mongo_update_follower_future_status = mongo_update_follower_future.wait_for(parse_duration(times["SocialGraphService-mongo_update_follower_future"]["time"]))) {
+      switch (mongo_update_follower_future_status = mongo_update_follower_future.wait_for(WaitConfig::Global().Get(_mongo_update_follower_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -217,8 +258,8 @@ void SocialGraphHandler::Follow(
 
   // Handle mongo_update_followee_future
   std::future_status mongo_update_followee_future_status;
-  std::future<void> mongo_update_followee_future =
-      std::async(std::launch::async, [&]() {
+  Future<void> mongo_update_followee_future =
+      _executor->Submit([&]() {
         mongoc_client_t *mongodb_client =
             mongoc_client_pool_pop(_mongodb_client_pool);
         if (!mongodb_client) {
@@ -274,7 +315,7 @@ void SocialGraphHandler::Follow(
         mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       });
   do {
-      switch (mongo_update_followee_future_status = mongo_update_followee_future.wait_for(parse_duration(times["SocialGraphService-mongo_update_followee_future"]["time"]))) {
+      switch (mongo_update_followee_future_status = mongo_update_followee_future.wait_for(WaitConfig::Global().Get(_mongo_update_followee_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -286,7 +327,7 @@ void SocialGraphHandler::Follow(
 
   // Handle redis_update_future
   std::future_status redis_update_future_status;
-  std::future<void> redis_update_future = std::async(std::launch::async, [&]() {
+  Future<void> redis_update_future = _executor->Submit([&]() {
     auto redis_span = opentracing::Tracer::Global()->StartSpan(
         "social_graph_redis_update_client",
         {opentracing::ChildOf(&span->context())});
@@ -297,7 +338,9 @@ void SocialGraphHandler::Follow(
         pipe.zadd(std::to_string(user_id) + ":followees",
                   std::to_string(followee_id), timestamp, UpdateType::NOT_EXIST)
             .zadd(std::to_string(followee_id) + ":followers",
-                  std::to_string(user_id), timestamp, UpdateType::NOT_EXIST);
+                  std::to_string(user_id), timestamp, UpdateType::NOT_EXIST)
+            .zadd(_FollowersByIdKey(followee_id),
+                  _FollowersByIdMember(user_id), 0);
         try {
           auto replies = pipe.exec();
         } catch (const Error &err) {
@@ -310,7 +353,9 @@ void SocialGraphHandler::Follow(
           pipe.zadd(std::to_string(user_id) + ":followees",
               std::to_string(followee_id), timestamp, UpdateType::NOT_EXIST)
               .zadd(std::to_string(followee_id) + ":followers",
-                  std::to_string(user_id), timestamp, UpdateType::NOT_EXIST);
+                  std::to_string(user_id), timestamp, UpdateType::NOT_EXIST)
+              .zadd(_FollowersByIdKey(followee_id),
+                  _FollowersByIdMember(user_id), 0);
           try {
               auto replies = pipe.exec();
           }
@@ -333,6 +378,8 @@ void SocialGraphHandler::Follow(
           _redis_cluster_client_pool->zadd(
               std::to_string(followee_id) + ":followers",
               std::to_string(user_id), timestamp, UpdateType::NOT_EXIST);
+          _redis_cluster_client_pool->zadd(_FollowersByIdKey(followee_id),
+                                           _FollowersByIdMember(user_id), 0);
         } catch (const Error &err) {
           LOG(error) << err.what();
           throw err;
@@ -342,7 +389,7 @@ void SocialGraphHandler::Follow(
     redis_span->Finish();
   });
   do {
-      switch (redis_update_future_status = redis_update_future.wait_for(parse_duration(times["SocialGraphService-redis_update_future"]["time"]))) {
+      switch (redis_update_future_status = redis_update_future.wait_for(WaitConfig::Global().Get(_redis_update_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -363,6 +410,13 @@ void SocialGraphHandler::Follow(
     throw;
   }
 
+  if (_graph_store) {
+    _graph_store->Follow(user_id, followee_id);
+  }
+  {
+    std::unique_lock<std::mutex> lock(_no_followers_mtx);
+    _no_followers.erase(followee_id);
+  }
   span->Finish();
 }
 
@@ -378,13 +432,10 @@ void SocialGraphHandler::Unfollow(
       "unfollow_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  std::ifstream times_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/wait_times.json");
-  nlohmann::json times;
-  times_file >> times;
   // Handle mongo_update_follower_future
   std::future_status mongo_update_follower_future_status;
-  std::future<void> mongo_update_follower_future =
-      std::async(std::launch::async, [&]() {
+  Future<void> mongo_update_follower_future =
+      _executor->Submit([&]() {
         mongoc_client_t *mongodb_client =
             mongoc_client_pool_pop(_mongodb_client_pool);
         if (!mongodb_client) {
@@ -437,7 +488,7 @@ void SocialGraphHandler::Unfollow(
         mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       });
   do {
-      switch (mongo_update_follower_future_status = mongo_update_follower_future.wait_for(parse_duration(times["SocialGraphService-mongo_update_follower_future"]["time"]))) {
+      switch (mongo_update_follower_future_status = mongo_update_follower_future.wait_for(WaitConfig::Global().Get(_mongo_update_follower_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -449,8 +500,8 @@ void SocialGraphHandler::Unfollow(
 
   // Handle mongo_update_followee_future   
   std::future_status mongo_update_followee_future_status;
-  std::future<void> mongo_update_followee_future =
-      std::async(std::launch::async, [&]() {
+  Future<void> mongo_update_followee_future =
+      _executor->Submit([&]() {
         mongoc_client_t *mongodb_client =
             mongoc_client_pool_pop(_mongodb_client_pool);
         if (!mongodb_client) {
@@ -503,7 +554,7 @@ void SocialGraphHandler::Unfollow(
         mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       });
   do {
-      switch (mongo_update_followee_future_status = mongo_update_followee_future.wait_for(parse_duration(times["SocialGraphService-mongo_update_followee_future"]["time"]))) {
+      switch (mongo_update_followee_future_status = mongo_update_followee_future.wait_for(WaitConfig::Global().Get(_mongo_update_followee_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -515,7 +566,7 @@ void SocialGraphHandler::Unfollow(
 
   // Handle redis_update_future
   std::future_status redis_update_future_status;
-  std::future<void> redis_update_future = std::async(std::launch::async, [&]() {
+  Future<void> redis_update_future = _executor->Submit([&]() {
     auto redis_span = opentracing::Tracer::Global()->StartSpan(
         "social_graph_redis_update_client",
         {opentracing::ChildOf(&span->context())});
@@ -525,7 +576,9 @@ void SocialGraphHandler::Unfollow(
         std::string followee_key = std::to_string(user_id) + ":followees";
         std::string follower_key = std::to_string(followee_id) + ":followers";
         pipe.zrem(followee_key, std::to_string(followee_id))
-            .zrem(follower_key, std::to_string(user_id));
+            .zrem(follower_key, std::to_string(user_id))
+            .zrem(_FollowersByIdKey(followee_id),
+                  _FollowersByIdMember(user_id));
 
         try {
           auto replies = pipe.exec();
@@ -539,7 +592,9 @@ void SocialGraphHandler::Unfollow(
           std::string followee_key = std::to_string(user_id) + ":followees";
           std::string follower_key = std::to_string(followee_id) + ":followers";
           pipe.zrem(followee_key, std::to_string(followee_id))
-              .zrem(follower_key, std::to_string(user_id));
+              .zrem(follower_key, std::to_string(user_id))
+              .zrem(_FollowersByIdKey(followee_id),
+                    _FollowersByIdMember(user_id));
 
           try {
               auto replies = pipe.exec();
@@ -557,6 +612,8 @@ void SocialGraphHandler::Unfollow(
                                            std::to_string(followee_id));
           _redis_cluster_client_pool->zrem(follower_key,
                                            std::to_string(user_id));
+          _redis_cluster_client_pool->zrem(_FollowersByIdKey(followee_id),
+                                           _FollowersByIdMember(user_id));
         } catch (const Error &err) {
           LOG(error) << err.what();
           throw err;
@@ -566,7 +623,7 @@ void SocialGraphHandler::Unfollow(
     redis_span->Finish();
   });
   do {
-      switch (redis_update_future_status = redis_update_future.wait_for(parse_duration(times["SocialGraphService-redis_update_future"]["time"]))) {
+      switch (redis_update_future_status = redis_update_future.wait_for(WaitConfig::Global().Get(_redis_update_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -584,6 +641,9 @@ void SocialGraphHandler::Unfollow(
     throw;
   }
 
+  if (_graph_store) {
+    _graph_store->Unfollow(user_id, followee_id);
+  }
   span->Finish();
 }
 
@@ -599,6 +659,11 @@ void SocialGraphHandler::GetFollowers(
       "get_followers_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
+  if (_graph_store && _graph_store->GetFollowers(user_id, &_return)) {
+    span->Finish();
+    return;
+  }
+
   auto redis_span = opentracing::Tracer::Global()->StartSpan(
       "social_graph_redis_get_client",
       {opentracing::ChildOf(&span->context())});
@@ -658,33 +723,13 @@ void SocialGraphHandler::GetFollowers(
     const bson_t *doc;
     bool found = mongoc_cursor_next(cursor, &doc);
     if (found) {
-      bson_iter_t iter_0;
-      bson_iter_t iter_1;
-      bson_iter_t user_id_child;
-      bson_iter_t timestamp_child;
-      int index = 0;
       std::unordered_map<std::string, double> redis_zset;
-      bson_iter_init(&iter_0, doc);
-      bson_iter_init(&iter_1, doc);
-
-      while (bson_iter_find_descendant(
-                 &iter_0,
-                 ("followers." + std::to_string(index) + ".user_id").c_str(),
-                 &user_id_child) &&
-             BSON_ITER_HOLDS_INT64(&user_id_child) &&
-             bson_iter_find_descendant(
-                 &iter_1,
-                 ("followers." + std::to_string(index) + ".timestamp").c_str(),
-                 &timestamp_child) &&
-             BSON_ITER_HOLDS_INT64(&timestamp_child)) {
-        auto iter_user_id = bson_iter_int64(&user_id_child);
-        auto iter_timestamp = bson_iter_int64(&timestamp_child);
-        _return.emplace_back(iter_user_id);
+      std::vector<std::pair<int64_t, int64_t>> followers;
+      bson_decode_timestamped_ids(doc, "followers", "user_id", &followers);
+      for (auto &follower : followers) {
+        _return.emplace_back(follower.first);
         redis_zset.emplace(std::pair<std::string, double>(
-            std::to_string(iter_user_id), (double)iter_timestamp));
-        bson_iter_init(&iter_0, doc);
-        bson_iter_init(&iter_1, doc);
-        index++;
+            std::to_string(follower.first), (double)follower.second));
       }
       find_span->Finish();
       bson_destroy(query);
@@ -737,6 +782,11 @@ void SocialGraphHandler::GetFollowees(
       "get_followees_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
+  if (_graph_store && _graph_store->GetFollowees(user_id, &_return)) {
+    span->Finish();
+    return;
+  }
+
   auto redis_span = opentracing::Tracer::Global()->StartSpan(
       "social_graph_redis_get_client",
       {opentracing::ChildOf(&span->context())});
@@ -806,36 +856,13 @@ void SocialGraphHandler::GetFollowees(
       mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
       throw se;
     } else {
-      bson_iter_t iter_0;
-      bson_iter_t iter_1;
-      bson_iter_t user_id_child;
-      bson_iter_t timestamp_child;
-      int index = 0;
-
-      bson_iter_init(&iter_0, doc);
-      bson_iter_init(&iter_1, doc);
-
       std::multimap<std::string, double> redis_zset;
-
-      while (bson_iter_find_descendant(
-                 &iter_0,
-                 ("followees." + std::to_string(index) + ".user_id").c_str(),
-                 &user_id_child) &&
-             BSON_ITER_HOLDS_INT64(&user_id_child) &&
-             bson_iter_find_descendant(
-                 &iter_1,
-                 ("followees." + std::to_string(index) + ".timestamp").c_str(),
-                 &timestamp_child) &&
-             BSON_ITER_HOLDS_INT64(&timestamp_child)) {
-        auto iter_user_id = bson_iter_int64(&user_id_child);
-        auto iter_timestamp = bson_iter_int64(&timestamp_child);
-        _return.emplace_back(iter_user_id);
-
+      std::vector<std::pair<int64_t, int64_t>> followees;
+      bson_decode_timestamped_ids(doc, "followees", "user_id", &followees);
+      for (auto &followee : followees) {
+        _return.emplace_back(followee.first);
         redis_zset.emplace(std::pair<std::string, double>(
-            std::to_string(iter_user_id), (double)iter_timestamp));
-        bson_iter_init(&iter_0, doc);
-        bson_iter_init(&iter_1, doc);
-        index++;
+            std::to_string(followee.first), (double)followee.second));
       }
 
       find_span->Finish();
@@ -870,6 +897,303 @@ void SocialGraphHandler::GetFollowees(
   span->Finish();
 }
 
+// Pages through the followers of user_id in ascending id order: a page holds
+// at most limit followers with ids of at least cursor, the next page starts
+// at the last id plus one, and a page shorter than limit is the last one.
+// Follows and unfollows between pages do not shift the pages, and every
+// source orders by id, so a walk stays consistent if the graph store
+// finishes loading halfway through it. The graph store pages in place, and
+// otherwise one ZRANGEBYLEX on the followers_by_id index reads the page. The
+// index is built from GetFollowers the first time a user is paged without
+// it, which is the only time the whole list is read.
+void SocialGraphHandler::GetFollowersPage(
+    std::vector<int64_t> &_return, const int64_t req_id, const int64_t user_id,
+    const int64_t cursor, const int32_t limit,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_followers_page_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  if (cursor < 0 || limit <= 0) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "Invalid cursor or limit";
+    throw se;
+  }
+
+  if (_graph_store &&
+      _graph_store->GetFollowersPage(user_id, cursor, limit, &_return)) {
+    span->Finish();
+    return;
+  }
+
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "social_graph_redis_get_client",
+      {opentracing::ChildOf(&span->context())});
+  std::string key = _FollowersByIdKey(user_id);
+  LeftBoundedInterval<std::string> interval(_FollowersByIdMember(cursor),
+                                            BoundType::RIGHT_OPEN);
+  LimitOptions limit_options;
+  limit_options.offset = 0;
+  limit_options.count = limit;
+  OptionalDouble complete;
+  std::vector<std::string> members;
+  try {
+    auto pipe = _redis_client_pool ? _redis_client_pool->pipeline(false)
+                : IsRedisReplicationEnabled()
+                    ? _redis_replica_client_pool->pipeline(false)
+                    : _redis_cluster_client_pool->pipeline(key, false);
+    auto replies =
+        pipe.zscore(key, "").zrangebylex(key, interval, limit_options).exec();
+    complete = replies.get<OptionalDouble>(0);
+    replies.get(1, std::back_inserter(members));
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  redis_span->Finish();
+
+  if (complete) {
+    for (auto &member : members) {
+      _return.emplace_back(std::stoll(member));
+    }
+    span->Finish();
+    return;
+  }
+
+  std::vector<int64_t> followers;
+  GetFollowers(followers, req_id, user_id, writer_text_map);
+  std::sort(followers.begin(), followers.end());
+  followers.erase(std::unique(followers.begin(), followers.end()),
+                  followers.end());
+  _BuildFollowersById(user_id, followers);
+  auto first = std::lower_bound(followers.begin(), followers.end(), cursor);
+  auto last = first + std::min<ptrdiff_t>(limit, followers.end() - first);
+  _return.assign(first, last);
+  span->Finish();
+}
+
+std::string SocialGraphHandler::_FollowersByIdKey(int64_t user_id) {
+  return std::to_string(user_id) + ":followers_by_id";
+}
+
+// Equal width makes the lexicographic order of members the id order.
+std::string SocialGraphHandler::_FollowersByIdMember(int64_t follower_id) {
+  char member[20];
+  snprintf(member, sizeof(member), "%019" PRId64, follower_id);
+  return member;
+}
+
+// Adds followers to the followers_by_id index of user_id and marks it
+// complete last, so a build that fails halfway is redone by the next page. A
+// Follow during the build is added by Follow itself; an Unfollow during it
+// can be undone by the build, as with the followers zset it reads from.
+void SocialGraphHandler::_BuildFollowersById(
+    int64_t user_id, const std::vector<int64_t> &followers) {
+  std::string key = _FollowersByIdKey(user_id);
+  std::vector<std::pair<std::string, double>> members;
+  members.reserve(std::min<size_t>(followers.size(), FOLLOWERS_BY_ID_BATCH));
+  try {
+    size_t begin = 0;
+    do {
+      size_t end = std::min<size_t>(begin + FOLLOWERS_BY_ID_BATCH,
+                                    followers.size());
+      members.clear();
+      for (size_t i = begin; i < end; ++i) {
+        members.emplace_back(_FollowersByIdMember(followers[i]), 0);
+      }
+      if (end == followers.size()) {
+        members.emplace_back("", 0);
+      }
+      if (_redis_client_pool) {
+        _redis_client_pool->zadd(key, members.begin(), members.end());
+      } else if (IsRedisReplicationEnabled()) {
+        _redis_primary_client_pool->zadd(key, members.begin(), members.end());
+      } else {
+        _redis_cluster_client_pool->zadd(key, members.begin(), members.end());
+      }
+      begin = end;
+    } while (begin < followers.size());
+  } catch (const Error &err) {
+    // The page is served from followers anyway; the next one retries.
+    LOG(warning) << "Failed to build the followers_by_id index of user "
+                 << user_id << ": " << err.what();
+  }
+}
+
+int64_t SocialGraphHandler::GetFollowerCount(
+    const int64_t req_id, const int64_t user_id,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_follower_count_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  int64_t count = 0;
+  if (_graph_store && _graph_store->GetFollowerCount(user_id, &count)) {
+    span->Finish();
+    return count;
+  }
+
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "social_graph_redis_get_client",
+      {opentracing::ChildOf(&span->context())});
+  std::string key = std::to_string(user_id) + ":followers";
+  try {
+    if (_redis_client_pool) {
+      count = _redis_client_pool->zcard(key);
+    } else if (IsRedisReplicationEnabled()) {
+      count = _redis_replica_client_pool->zcard(key);
+    } else {
+      count = _redis_cluster_client_pool->zcard(key);
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  redis_span->Finish();
+
+  if (count == 0) {
+    std::vector<int64_t> followers;
+    _GetFollowersUnlessNone(followers, req_id, user_id, writer_text_map);
+    count = followers.size();
+  }
+  span->Finish();
+  return count;
+}
+
+void SocialGraphHandler::_GetFollowersUnlessNone(
+    std::vector<int64_t> &followers, const int64_t req_id,
+    const int64_t user_id, const std::map<std::string, std::string> &carrier) {
+  auto now = std::chrono::steady_clock::now();
+  {
+    std::unique_lock<std::mutex> lock(_no_followers_mtx);
+    auto it = _no_followers.find(user_id);
+    if (it != _no_followers.end()) {
+      if (now < it->second) {
+        return;
+      }
+      _no_followers.erase(it);
+    }
+  }
+  GetFollowers(followers, req_id, user_id, carrier);
+  if (!followers.empty()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(_no_followers_mtx);
+  if (_no_followers.size() >= NO_FOLLOWERS_CACHE_SIZE) {
+    for (auto it = _no_followers.begin(); it != _no_followers.end();) {
+      it = now < it->second ? std::next(it) : _no_followers.erase(it);
+    }
+    if (_no_followers.size() >= NO_FOLLOWERS_CACHE_SIZE) {
+      _no_followers.clear();
+    }
+  }
+  _no_followers[user_id] = now + std::chrono::milliseconds(NO_FOLLOWERS_TTL_MS);
+}
+
+// Returns the followees of user_id that have at least min_followers
+// followers. Their posts are not pushed into home timelines, so
+// HomeTimelineService merges them in when the home timeline is read.
+void SocialGraphHandler::GetHighFanoutFollowees(
+    std::vector<int64_t> &_return, const int64_t req_id, const int64_t user_id,
+    const int64_t min_followers,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_high_fanout_followees_server",
+      {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  std::vector<int64_t> followees;
+  GetFollowees(followees, req_id, user_id, writer_text_map);
+  if (followees.empty()) {
+    span->Finish();
+    return;
+  }
+
+  if (_graph_store && _graph_store->Loaded()) {
+    for (auto followee_id : followees) {
+      int64_t count;
+      if (_graph_store->GetFollowerCount(followee_id, &count) &&
+          count >= min_followers) {
+        _return.emplace_back(followee_id);
+      }
+    }
+    span->Finish();
+    return;
+  }
+
+  // One ZCARD per followee, pipelined per Redis node. A followee whose
+  // followers are not cached in Redis counts as zero; WriteHomeTimeline
+  // fills the cache the first time that followee posts.
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "social_graph_redis_get_client",
+      {opentracing::ChildOf(&span->context())});
+  std::vector<long long> counts(followees.size());
+  try {
+    if (_redis_client_pool || IsRedisReplicationEnabled()) {
+      auto pipe = _redis_client_pool
+                      ? _redis_client_pool->pipeline(false)
+                      : _redis_replica_client_pool->pipeline(false);
+      for (auto followee_id : followees) {
+        pipe.zcard(std::to_string(followee_id) + ":followers");
+      }
+      auto replies = pipe.exec();
+      for (size_t i = 0; i < followees.size(); ++i) {
+        counts[i] = replies.get<long long>(i);
+      }
+    } else {
+      struct NodePipeline {
+        std::shared_ptr<Pipeline> pipe;
+        std::vector<size_t> indexes;
+      };
+      std::map<std::shared_ptr<ConnectionPool>, NodePipeline> pipe_map;
+      auto *shards_pool = _redis_cluster_client_pool->get_shards_pool();
+      for (size_t i = 0; i < followees.size(); ++i) {
+        std::string key = std::to_string(followees[i]) + ":followers";
+        auto &node = pipe_map[shards_pool->fetch(key)];
+        if (!node.pipe) {
+          node.pipe = std::make_shared<Pipeline>(
+              _redis_cluster_client_pool->pipeline(key, false));
+        }
+        node.pipe->zcard(key);
+        node.indexes.emplace_back(i);
+      }
+      for (auto &it : pipe_map) {
+        auto replies = it.second.pipe->exec();
+        for (size_t j = 0; j < it.second.indexes.size(); ++j) {
+          counts[it.second.indexes[j]] = replies.get<long long>(j);
+        }
+      }
+    }
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  redis_span->Finish();
+
+  for (size_t i = 0; i < followees.size(); ++i) {
+    if (counts[i] >= min_followers) {
+      _return.emplace_back(followees[i]);
+    }
+  }
+  span->Finish();
+}
+
 void SocialGraphHandler::InsertUser(
     int64_t req_id, int64_t user_id,
     const std::map<std::string, std::string> &carrier) {
@@ -923,6 +1247,9 @@ void SocialGraphHandler::InsertUser(
   bson_destroy(new_doc);
   mongoc_collection_destroy(collection);
   mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  if (_graph_store) {
+    _graph_store->InsertUser(user_id);
+  }
   span->Finish();
 }
 
@@ -940,12 +1267,9 @@ void SocialGraphHandler::FollowWithUsername(
       {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  std::ifstream times_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/wait_times.json");
-  nlohmann::json times;
-  times_file >> times;
   // Handle user_id_future
   std::future_status user_id_future_status;
-  std::future<int64_t> user_id_future = std::async(std::launch::async, [&]() {
+  Future<int64_t> user_id_future = _executor->Submit([&]() {
     auto user_client_wrapper = _user_service_client_pool->Pop();
     if (!user_client_wrapper) {
       ServiceException se;
@@ -966,7 +1290,7 @@ void SocialGraphHandler::FollowWithUsername(
     return _return;
   });
   do {
-      switch (user_id_future_status = user_id_future.wait_for(parse_duration(times["SocialGraphService-user_id_future"]["time"]))) {
+      switch (user_id_future_status = user_id_future.wait_for(WaitConfig::Global().Get(_user_id_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -978,8 +1302,8 @@ void SocialGraphHandler::FollowWithUsername(
 
   // Handle followee_id_future
   std::future_status followee_id_future_status;
-  std::future<int64_t> followee_id_future =
-      std::async(std::launch::async, [&]() {
+  Future<int64_t> followee_id_future =
+      _executor->Submit([&]() {
         auto user_client_wrapper = _user_service_client_pool->Pop();
         if (!user_client_wrapper) {
           ServiceException se;
@@ -1001,7 +1325,7 @@ void SocialGraphHandler::FollowWithUsername(
         return _return;
       });
   do {
-      switch (followee_id_future_status = followee_id_future.wait_for(parse_duration(times["SocialGraphService-followee_id_future"]["time"]))) {
+      switch (followee_id_future_status = followee_id_future.wait_for(WaitConfig::Global().Get(_followee_id_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -1041,12 +1365,9 @@ void SocialGraphHandler::UnfollowWithUsername(
       {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  std::ifstream times_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/wait_times.json");
-  nlohmann::json times;
-  times_file >> times;
   // Handle user_id_future
   std::future_status user_id_future_status;
-  std::future<int64_t> user_id_future = std::async(std::launch::async, [&]() {
+  Future<int64_t> user_id_future = _executor->Submit([&]() {
     auto user_client_wrapper = _user_service_client_pool->Pop();
     if (!user_client_wrapper) {
       ServiceException se;
@@ -1067,7 +1388,7 @@ void SocialGraphHandler::UnfollowWithUsername(
     return _return;
   });
   do {
-      switch (user_id_future_status = user_id_future.wait_for(parse_duration(times["SocialGraphService-user_id_future"]["time"]))) {
+      switch (user_id_future_status = user_id_future.wait_for(WaitConfig::Global().Get(_user_id_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -1079,8 +1400,8 @@ void SocialGraphHandler::UnfollowWithUsername(
 
   // Handle followee_id_future
   std::future_status followee_id_future_status;
-  std::future<int64_t> followee_id_future =
-      std::async(std::launch::async, [&]() {
+  Future<int64_t> followee_id_future =
+      _executor->Submit([&]() {
         auto user_client_wrapper = _user_service_client_pool->Pop();
         if (!user_client_wrapper) {
           ServiceException se;
@@ -1102,7 +1423,7 @@ void SocialGraphHandler::UnfollowWithUsername(
         return _return;
       });
   do {
-      switch (followee_id_future_status = followee_id_future.wait_for(parse_duration(times["SocialGraphService-followee_id_future"]["time"]))) {
+      switch (followee_id_future_status = followee_id_future.wait_for(WaitConfig::Global().Get(_followee_id_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -1,10 +1,8 @@
 #include <signal.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include <boost/program_options.hpp>
+#include <memory>
+#include <thread>
 
 #include "../utils.h"
 #include "../utils_mongodb.h"
@@ -13,10 +11,6 @@
 #include "SocialGraphHandler.h"
 
 using json = nlohmann::json;
-using apache::thrift::protocol::TBinaryProtocolFactory;
-using apache::thrift::server::TThreadedServer;
-using apache::thrift::transport::TFramedTransportFactory;
-using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
 void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
@@ -58,12 +52,36 @@ int main(int argc, char *argv[]) {
 
   int port = config_json["social-graph-service"]["port"];
 
+  std::string wait_times_path = config_json["social-graph-service"].value(
+      "wait_times_path", DEFAULT_WAIT_TIMES_PATH);
+  int wait_times_poll_ms =
+      config_json["social-graph-service"].value("wait_times_poll_ms", 1000);
+  WaitConfig::Global().Load(wait_times_path);
+  WaitConfig::Global().Start(wait_times_poll_ms);
+  InstallSighupReload();
+
+  int executor_threads =
+      config_json["social-graph-service"].value("executor_threads", 64);
+  int executor_max_queued =
+      config_json["social-graph-service"].value("executor_max_queued", 0);
+  Executor executor("social-graph-service", executor_threads, executor_max_queued);
+
+  bool graph_store_enabled =
+      config_json["social-graph-service"].value("graph_store", false);
+  int graph_store_shards =
+      config_json["social-graph-service"].value("graph_store_shards", 64);
+  std::unique_ptr<GraphStore> graph_store;
+  if (graph_store_enabled) {
+    graph_store.reset(new GraphStore(graph_store_shards));
+  }
+
   int mongodb_conns = config_json["social-graph-mongodb"]["connections"];
   int mongodb_timeout = config_json["social-graph-mongodb"]["timeout_ms"];
 
   std::string user_addr = config_json["user-service"]["addr"];
   int user_port = config_json["user-service"]["port"];
   int user_conns = config_json["user-service"]["connections"];
+  int user_min_conns = config_json["user-service"].value("min_connections", 0);
   int user_timeout = config_json["user-service"]["timeout_ms"];
   int user_keepalive = config_json["user-service"]["keepalive_ms"];
 
@@ -82,8 +100,8 @@ int main(int argc, char *argv[]) {
   }
 
   ClientPool<ThriftClient<UserServiceClient>> user_client_pool(
-      "social-graph", user_addr, user_port, 0, user_conns, user_timeout,
-      user_keepalive, config_json);
+      "social-graph", user_addr, user_port, user_min_conns, user_conns,
+      user_timeout, user_keepalive, config_json);
 
   mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
   if (!mongodb_client) {
@@ -100,47 +118,59 @@ int main(int argc, char *argv[]) {
   }
   mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
 
-  std::shared_ptr<TServerSocket> server_socket =
-      get_server_socket(config_json, "0.0.0.0", port);
+  if (graph_store) {
+    // Requests use Redis and MongoDB until the snapshot is loaded.
+    GraphStore *store = graph_store.get();
+    std::thread([mongodb_client_pool, store]() {
+      while (!load_graph_store(mongodb_client_pool, store)) {
+        LOG(error) << "Failed to load the social graph into memory, try again";
+        sleep(1);
+      }
+    }).detach();
+  }
 
   if (redis_cluster_flag || redis_cluster_config_flag) {
     RedisCluster redis_cluster_client_pool =
         init_redis_cluster_client_pool(config_json, "social-graph");
-    TThreadedServer server(
+    auto server = get_server(
+        config_json, "social-graph-service",
         std::make_shared<SocialGraphServiceProcessor>(
             std::make_shared<SocialGraphHandler>(mongodb_client_pool,
                                                  &redis_cluster_client_pool,
-                                                 &user_client_pool)),
-        server_socket, std::make_shared<TFramedTransportFactory>(),
-        std::make_shared<TBinaryProtocolFactory>());
+                                                 &user_client_pool,
+                                                 &executor,
+                                                 graph_store.get())),
+        "0.0.0.0", port);
     LOG(info) << "Starting the social-graph-service server with Redis Cluster support...";
-    server.serve();
+    server->serve();
   }
   
   else if (redis_replica_config_flag) {
       Redis redis_replica_client_pool = init_redis_replica_client_pool(config_json, "redis-replica");
       Redis redis_primary_client_pool = init_redis_replica_client_pool(config_json, "redis-primary");
 
-      TThreadedServer server(
+      auto server = get_server(
+          config_json, "social-graph-service",
           std::make_shared<SocialGraphServiceProcessor>(
               std::make_shared<SocialGraphHandler>(
-                  mongodb_client_pool, &redis_replica_client_pool, &redis_primary_client_pool, &user_client_pool)),
-          server_socket, std::make_shared<TFramedTransportFactory>(),
-          std::make_shared<TBinaryProtocolFactory>());
+                  mongodb_client_pool, &redis_replica_client_pool, &redis_primary_client_pool, &user_client_pool,
+                  &executor, graph_store.get())),
+          "0.0.0.0", port);
       LOG(info) << "Starting the social-graph-service server with Redis replica support";
-      server.serve();
+      server->serve();
   }
 
   else {
     Redis redis_client_pool =
         init_redis_client_pool(config_json, "social-graph");
-    TThreadedServer server(
+    auto server = get_server(
+        config_json, "social-graph-service",
         std::make_shared<SocialGraphServiceProcessor>(
             std::make_shared<SocialGraphHandler>(
-                mongodb_client_pool, &redis_client_pool, &user_client_pool)),
-        server_socket, std::make_shared<TFramedTransportFactory>(),
-        std::make_shared<TBinaryProtocolFactory>());
+                mongodb_client_pool, &redis_client_pool, &user_client_pool,
+                &executor, graph_store.get())),
+        "0.0.0.0", port);
     LOG(info) << "Starting the social-graph-service server ...";
-    server.serve();
+    server->serve();
   }
 }
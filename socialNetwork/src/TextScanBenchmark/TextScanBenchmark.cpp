@@ -0,0 +1,185 @@
+// Compares the std::regex_search loops TextHandler::ComposeText used to find
+// mentions and urls and to substitute shortened urls with scan_text and
+// replace_text_spans from TextScanner.h.
+//
+// Before timing, both are run on fuzz_texts random texts made mostly of the
+// characters the patterns care about, and the benchmark fails if any result
+// differs. The timed texts are built like the ones wrk2's compose-post.lua
+// sends: 256 random alphanumerics, then 1 to 6 " @username_N" mentions and 1
+// to 6 " http://" urls with 64 random alphanumerics each.
+//
+// Usage: TextScanBenchmark [iterations] [fuzz_texts]
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "../TextService/TextScanner.h"
+
+using namespace social_network;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+struct ScanResult {
+  std::vector<std::string> mentions;
+  std::vector<std::string> urls;
+  std::string updated_text;
+};
+
+std::string Shortened(size_t i) {
+  return "http://short-url/" + std::to_string(i);
+}
+
+// The loops ComposeText used before TextScanner.h. They dropped the text
+// after the last url when substituting; the suffix is appended here so the
+// rest can be compared.
+ScanResult RegexScan(const std::string &text) {
+  ScanResult result;
+  std::smatch m;
+  std::regex e("@[a-zA-Z0-9-_]+");
+  auto s = text;
+  while (std::regex_search(s, m, e)) {
+    auto user_mention = m.str();
+    user_mention = user_mention.substr(1, user_mention.length());
+    result.mentions.emplace_back(user_mention);
+    s = m.suffix().str();
+  }
+
+  e = "(http://|https://)([a-zA-Z0-9_!~*'().&=+$%-]+)";
+  s = text;
+  while (std::regex_search(s, m, e)) {
+    result.urls.emplace_back(m.str());
+    s = m.suffix().str();
+  }
+
+  if (!result.urls.empty()) {
+    s = text;
+    int idx = 0;
+    while (std::regex_search(s, m, e)) {
+      result.updated_text += m.prefix().str() + Shortened(idx);
+      s = m.suffix().str();
+      idx++;
+    }
+    result.updated_text += s;
+  } else {
+    result.updated_text = text;
+  }
+  return result;
+}
+
+ScanResult SinglePassScan(const std::string &text) {
+  ScanResult result;
+  std::vector<TextSpan> mention_spans, url_spans;
+  scan_text(text, &mention_spans, &url_spans);
+  for (auto &span : mention_spans) {
+    result.mentions.emplace_back(span.str());
+  }
+  for (auto &span : url_spans) {
+    result.urls.emplace_back(span.str());
+  }
+  std::vector<std::string> shortened;
+  for (size_t i = 0; i < url_spans.size(); ++i) {
+    shortened.emplace_back(Shortened(i));
+  }
+  result.updated_text = replace_text_spans(
+      text, url_spans,
+      [&](size_t i) -> const std::string & { return shortened[i]; });
+  return result;
+}
+
+std::string RandomString(std::mt19937 &gen, const std::string &charset,
+                         int length) {
+  std::uniform_int_distribution<int> dist(0, charset.size() - 1);
+  std::string s;
+  for (int i = 0; i < length; ++i) {
+    s += charset[dist(gen)];
+  }
+  return s;
+}
+
+// Random texts of pieces that start, continue and break both patterns.
+std::string FuzzText(std::mt19937 &gen) {
+  static const std::vector<std::string> pieces = {
+      "@", "h", "http://", "https://", "http:/", "https:", "ttp://", "@http://",
+      "a", "Z", "9", "-", "_", "!", "~", "*", "'", "(", ")", ".", "&", "=",
+      "+", "$", "%", " ", "/", ":", "\n", "#", "\x80", "\xff", "@@", "hh"};
+  std::uniform_int_distribution<int> length(0, 80);
+  std::uniform_int_distribution<int> piece(0, pieces.size() - 1);
+  std::string text;
+  for (int i = length(gen); i > 0; --i) {
+    text += pieces[piece(gen)];
+  }
+  return text;
+}
+
+std::string ComposePostText(std::mt19937 &gen) {
+  static const std::string charset =
+      "qwertyuiopasdfghjklzxcvbnmQWERTYUIOPASDFGHJKLZXCVBNM1234567890";
+  std::uniform_int_distribution<int> count(1, 6);
+  std::uniform_int_distribution<int> user(0, 961);
+  std::string text = RandomString(gen, charset, 256);
+  for (int i = count(gen); i > 0; --i) {
+    text += " @username_" + std::to_string(user(gen));
+  }
+  for (int i = count(gen); i > 0; --i) {
+    text += " http://" + RandomString(gen, charset, 64);
+  }
+  return text;
+}
+
+bool Same(const ScanResult &a, const ScanResult &b) {
+  return a.mentions == b.mentions && a.urls == b.urls &&
+         a.updated_text == b.updated_text;
+}
+
+template <class Fn>
+double Time(const std::vector<std::string> &texts, int iterations, Fn fn) {
+  auto start = steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    fn(texts[i % texts.size()]);
+  }
+  auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start);
+  return double(elapsed.count()) / iterations;
+}
+
+int main(int argc, char *argv[]) {
+  int iterations = argc > 1 ? std::stoi(argv[1]) : 20000;
+  int fuzz_texts = argc > 2 ? std::stoi(argv[2]) : 100000;
+
+  std::mt19937 gen(12345);
+  for (int i = 0; i < fuzz_texts; ++i) {
+    auto text = FuzzText(gen);
+    if (!Same(RegexScan(text), SinglePassScan(text))) {
+      std::cerr << "Mismatch on text: " << text << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<std::string> texts;
+  for (int i = 0; i < 1000; ++i) {
+    texts.emplace_back(ComposePostText(gen));
+    if (!Same(RegexScan(texts.back()), SinglePassScan(texts.back()))) {
+      std::cerr << "Mismatch on text: " << texts.back() << std::endl;
+      return 1;
+    }
+  }
+
+  size_t sink = 0;
+  auto regex_ns = Time(texts, iterations, [&](const std::string &text) {
+    sink += RegexScan(text).updated_text.size();
+  });
+  auto single_pass_ns = Time(texts, iterations, [&](const std::string &text) {
+    sink += SinglePassScan(text).updated_text.size();
+  });
+
+  std::cout << "iterations=" << iterations << " fuzz_texts=" << fuzz_texts
+            << " (" << sink << ")" << std::endl;
+  std::cout << "regex_search: " << regex_ns / 1000
+            << " us/text, single pass: " << single_pass_ns / 1000
+            << " us/text" << std::endl;
+  return 0;
+}
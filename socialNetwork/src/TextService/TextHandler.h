@@ -3,48 +3,26 @@
 
 #include <future>
 #include <iostream>
-#include <regex>
 #include <string>
-#include <nlohmann/json.hpp>
 
 #include "../../gen-cpp/TextService.h"
 #include "../../gen-cpp/UrlShortenService.h"
 #include "../../gen-cpp/UserMentionService.h"
 #include "../ClientPool.h"
+#include "../Executor.h"
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "../wait_config.h"
+#include "TextScanner.h"
 
 namespace social_network {
 
-std::chrono::seconds parse_duration(const std::string &str) {
-    // Regular expression to extract the number (assuming it's seconds)
-    std::regex regex("(\\d+)([smhd])");
-    std::smatch match;
-    
-    if (regex_match(str, match, regex)) {
-        int time_value = std::stoi(match[1].str());  // Extract the number
-        char time_unit = match[2].str()[0];          // Extract the time unit (s, m, h, d)
-
-        switch (time_unit) {
-            case 's':
-                return std::chrono::seconds(time_value);  // Return as seconds
-            case 'm':
-                return std::chrono::minutes(time_value);  // Return as minutes
-            case 'h':
-                return std::chrono::hours(time_value);    // Return as hours
-            case 'd':
-                return std::chrono::hours(time_value * 24);  // Return as days (converted to hours)
-        }
-    }
-
-    return std::chrono::seconds(0);  // Default to 0 if invalid input
-}
-
 class TextHandler : public TextServiceIf {
  public:
   TextHandler(ClientPool<ThriftClient<UrlShortenServiceClient>> *,
-              ClientPool<ThriftClient<UserMentionServiceClient>> *);
+              ClientPool<ThriftClient<UserMentionServiceClient>> *,
+              Executor *);
   ~TextHandler() override = default;
 
   void ComposeText(TextServiceReturn &_return, int64_t, const std::string &,
@@ -53,14 +31,21 @@ class TextHandler : public TextServiceIf {
  private:
   ClientPool<ThriftClient<UrlShortenServiceClient>> *_url_client_pool;
   ClientPool<ThriftClient<UserMentionServiceClient>> *_user_mention_client_pool;
+  Executor *_executor;
+  int _shortened_urls_future_wait_slot =
+      WaitConfig::Global().Register("TextService-shortened_urls_future");
+  int _user_mention_future_wait_slot =
+      WaitConfig::Global().Register("TextService-user_mention_future");
 };
 
 TextHandler::TextHandler(
     ClientPool<ThriftClient<UrlShortenServiceClient>> *url_client_pool,
     ClientPool<ThriftClient<UserMentionServiceClient>>
-        *user_mention_client_pool) {
+        *user_mention_client_pool,
+    Executor *executor) {
   _url_client_pool = url_client_pool;
   _user_mention_client_pool = user_mention_client_pool;
+  _executor = executor;
 }
 
 void TextHandler::ComposeText(
@@ -75,32 +60,25 @@ void TextHandler::ComposeText(
       "compose_text_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
+  std::vector<TextSpan> mention_spans;
+  std::vector<TextSpan> url_spans;
+  scan_text(text, &mention_spans, &url_spans);
+
   std::vector<std::string> mention_usernames;
-  std::smatch m;
-  std::regex e("@[a-zA-Z0-9-_]+");
-  auto s = text;
-  while (std::regex_search(s, m, e)) {
-    auto user_mention = m.str();
-    user_mention = user_mention.substr(1, user_mention.length());
-    mention_usernames.emplace_back(user_mention);
-    s = m.suffix().str();
+  mention_usernames.reserve(mention_spans.size());
+  for (auto &span : mention_spans) {
+    mention_usernames.emplace_back(span.str());
   }
 
   std::vector<std::string> urls;
-  e = "(http://|https://)([a-zA-Z0-9_!~*'().&=+$%-]+)";
-  s = text;
-  while (std::regex_search(s, m, e)) {
-    auto url = m.str();
-    urls.emplace_back(url);
-    s = m.suffix().str();
+  urls.reserve(url_spans.size());
+  for (auto &span : url_spans) {
+    urls.emplace_back(span.str());
   }
 
-  std::ifstream times_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/wait_times.json");
-  nlohmann::json times;
-  times_file >> times;
   // Handle shortened_urls_future
   std::future_status shortened_urls_future_status;
-  auto shortened_urls_future = std::async(std::launch::async, [&]() {
+  auto shortened_urls_future = _executor->Submit([&]() {
     auto url_span = opentracing::Tracer::Global()->StartSpan(
         "compose_urls_client", {opentracing::ChildOf(&span->context())});
 
@@ -128,7 +106,7 @@ void TextHandler::ComposeText(
     return _return_urls;
   });
   do {
-      switch (shortened_urls_future_status = shortened_urls_future.wait_for(parse_duration(times["TextService-shortened_urls_future"]["time"]))) {
+      switch (shortened_urls_future_status = shortened_urls_future.wait_for(WaitConfig::Global().Get(_shortened_urls_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -140,7 +118,7 @@ void TextHandler::ComposeText(
 
   // Handle user_mention_future
   std::future_status user_mention_future_status;
-  auto user_mention_future = std::async(std::launch::async, [&]() {
+  auto user_mention_future = _executor->Submit([&]() {
     auto user_mention_span = opentracing::Tracer::Global()->StartSpan(
         "compose_user_mentions_client",
         {opentracing::ChildOf(&span->context())});
@@ -173,7 +151,7 @@ void TextHandler::ComposeText(
     return _return_user_mentions;
   });
   do {
-      switch (user_mention_future_status = user_mention_future.wait_for(parse_duration(times["TextService-user_mention_future"]["time"]))) {
+      switch (user_mention_future_status = user_mention_future.wait_for(WaitConfig::Global().Get(_user_mention_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -199,20 +177,19 @@ void TextHandler::ComposeText(
     throw;
   }
 
-  std::string updated_text;
-  if (!urls.empty()) {
-    s = text;
-    int idx = 0;
-    while (std::regex_search(s, m, e)) {
-      auto url = m.str();
-      urls.emplace_back(url);
-      updated_text += m.prefix().str() + target_urls[idx].shortened_url;
-      s = m.suffix().str();
-      idx++;
-    }
-  } else {
-    updated_text = text;
+  if (target_urls.size() != url_spans.size()) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "url-shorten-service returned " +
+                 std::to_string(target_urls.size()) + " urls for " +
+                 std::to_string(url_spans.size());
+    LOG(error) << se.message;
+    throw se;
   }
+  std::string updated_text = replace_text_spans(
+      text, url_spans, [&](size_t i) -> const std::string & {
+        return target_urls[i].shortened_url;
+      });
 
   _return.user_mentions = user_mentions;
   _return.text = updated_text;
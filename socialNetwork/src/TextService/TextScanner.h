@@ -0,0 +1,148 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_TEXTSCANNER_H
+#define SOCIAL_NETWORK_MICROSERVICES_TEXTSCANNER_H
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace social_network {
+
+// A piece of a scanned text. It points into the text, so it is only valid
+// while the text is.
+struct TextSpan {
+  const char *data;
+  size_t size;
+
+  std::string str() const { return std::string(data, size); }
+};
+
+// Character classes of the patterns ComposeText used to match with std::regex:
+//   mention: @[a-zA-Z0-9-_]+
+//   url:     (http://|https://)([a-zA-Z0-9_!~*'().&=+$%-]+)
+#define TEXT_SCAN_MENTION_CHAR 0x01
+#define TEXT_SCAN_URL_CHAR 0x02
+
+const unsigned char *text_scan_char_classes() {
+  struct CharClasses {
+    unsigned char table[256];
+
+    CharClasses() : table() {
+      for (int c = 'a'; c <= 'z'; ++c) {
+        table[c] = TEXT_SCAN_MENTION_CHAR | TEXT_SCAN_URL_CHAR;
+        table[c - 'a' + 'A'] = TEXT_SCAN_MENTION_CHAR | TEXT_SCAN_URL_CHAR;
+      }
+      for (int c = '0'; c <= '9'; ++c) {
+        table[c] = TEXT_SCAN_MENTION_CHAR | TEXT_SCAN_URL_CHAR;
+      }
+      table[static_cast<unsigned char>('-')] |= TEXT_SCAN_MENTION_CHAR;
+      table[static_cast<unsigned char>('_')] |= TEXT_SCAN_MENTION_CHAR;
+      for (const char *c = "_!~*'().&=+$%-"; *c; ++c) {
+        table[static_cast<unsigned char>(*c)] |= TEXT_SCAN_URL_CHAR;
+      }
+    }
+  };
+  static const CharClasses classes;
+  return classes.table;
+}
+
+// Returns the first '@' or 'h' in [p, end), or end. Every mention starts
+// with the first and every url with the second.
+const char *text_scan_next_candidate(const char *p, const char *end) {
+#ifdef __SSE2__
+  const __m128i at = _mm_set1_epi8('@');
+  const __m128i h = _mm_set1_epi8('h');
+  while (end - p >= 16) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    int mask = _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(block, at), _mm_cmpeq_epi8(block, h)));
+    if (mask != 0) {
+      return p + __builtin_ctz(mask);
+    }
+    p += 16;
+  }
+#endif
+  while (p < end && *p != '@' && *p != 'h') {
+    ++p;
+  }
+  return p;
+}
+
+/*
+ * Finds the user mentions and urls of text in one pass, with the results
+ * the old std::regex_search loops gave: mentions without their '@', urls
+ * with their scheme, each in text order.
+ *
+ * Neither pattern's body can contain the start of another match of the same
+ * pattern ('@' is not a mention character, ':' is not a url character), so
+ * every position where a pattern matches is a match of the old loops, and no
+ * suffix has to be searched again. A url can start inside a mention
+ * ("@xhttp://y"), so the scan only skips over urls.
+ */
+void scan_text(const std::string &text, std::vector<TextSpan> *mentions,
+               std::vector<TextSpan> *urls) {
+  const unsigned char *classes = text_scan_char_classes();
+  const char *p = text.data();
+  const char *end = p + text.size();
+  while ((p = text_scan_next_candidate(p, end)) != end) {
+    const char *q = p + 1;
+    if (*p == '@') {
+      while (q < end && (classes[static_cast<unsigned char>(*q)] &
+                         TEXT_SCAN_MENTION_CHAR)) {
+        ++q;
+      }
+      if (q - p > 1) {
+        mentions->push_back({p + 1, static_cast<size_t>(q - p - 1)});
+      }
+      p = p + 1;
+      continue;
+    }
+    size_t scheme = 0;
+    if (end - p > 7 && std::memcmp(p, "http://", 7) == 0) {
+      scheme = 7;
+    } else if (end - p > 8 && std::memcmp(p, "https://", 8) == 0) {
+      scheme = 8;
+    }
+    if (scheme == 0) {
+      p = p + 1;
+      continue;
+    }
+    q = p + scheme;
+    while (q < end && (classes[static_cast<unsigned char>(*q)] &
+                       TEXT_SCAN_URL_CHAR)) {
+      ++q;
+    }
+    if (q == p + scheme) {
+      p = p + 1;
+      continue;
+    }
+    urls->push_back({p, static_cast<size_t>(q - p)});
+    p = q;
+  }
+}
+
+// Rebuilds text with spans, which point into it in text order, replaced by
+// replacement(0), replacement(1), ...
+template <class Replacement>
+std::string replace_text_spans(const std::string &text,
+                               const std::vector<TextSpan> &spans,
+                               Replacement replacement) {
+  std::string result;
+  result.reserve(text.size());
+  const char *p = text.data();
+  for (size_t i = 0; i < spans.size(); ++i) {
+    result.append(p, spans[i].data);
+    result.append(replacement(i));
+    p = spans[i].data + spans[i].size;
+  }
+  result.append(p, text.data() + text.size());
+  return result;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_TEXTSCANNER_H
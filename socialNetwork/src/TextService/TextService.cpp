@@ -1,17 +1,9 @@
 #include <signal.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include "../utils.h"
 #include "../utils_thrift.h"
 #include "TextHandler.h"
 
-using apache::thrift::protocol::TBinaryProtocolFactory;
-using apache::thrift::server::TThreadedServer;
-using apache::thrift::transport::TFramedTransportFactory;
-using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
 void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
@@ -25,38 +17,55 @@ int main(int argc, char *argv[]) {
   if (load_config_file("config/service-config.json", &config_json) == 0) {
     int port = config_json["text-service"]["port"];
 
+    std::string wait_times_path = config_json["text-service"].value(
+        "wait_times_path", DEFAULT_WAIT_TIMES_PATH);
+    int wait_times_poll_ms =
+        config_json["text-service"].value("wait_times_poll_ms", 1000);
+    WaitConfig::Global().Load(wait_times_path);
+    WaitConfig::Global().Start(wait_times_poll_ms);
+    InstallSighupReload();
+
+    int executor_threads =
+        config_json["text-service"].value("executor_threads", 64);
+    int executor_max_queued =
+        config_json["text-service"].value("executor_max_queued", 0);
+    Executor executor("text-service", executor_threads, executor_max_queued);
+
     std::string url_addr = config_json["url-shorten-service"]["addr"];
     int url_port = config_json["url-shorten-service"]["port"];
     int url_conns = config_json["url-shorten-service"]["connections"];
+    int url_min_conns =
+        config_json["url-shorten-service"].value("min_connections", 0);
     int url_timeout = config_json["url-shorten-service"]["timeout_ms"];
     int url_keepalive = config_json["url-shorten-service"]["keepalive_ms"];
 
     std::string user_mention_addr = config_json["user-mention-service"]["addr"];
     int user_mention_port = config_json["user-mention-service"]["port"];
     int user_mention_conns = config_json["user-mention-service"]["connections"];
+    int user_mention_min_conns =
+        config_json["user-mention-service"].value("min_connections", 0);
     int user_mention_timeout =
         config_json["user-mention-service"]["timeout_ms"];
     int user_mention_keepalive =
         config_json["user-mention-service"]["keepalive_ms"];
 
     ClientPool<ThriftClient<UrlShortenServiceClient>> url_client_pool(
-        "url-shorten-service", url_addr, url_port, 0, url_conns, url_timeout,
-        url_keepalive, config_json);
+        "url-shorten-service", url_addr, url_port, url_min_conns, url_conns,
+        url_timeout, url_keepalive, config_json);
 
     ClientPool<ThriftClient<UserMentionServiceClient>> user_mention_pool(
-        "user-mention-service", user_mention_addr, user_mention_port, 0,
-        user_mention_conns, user_mention_timeout, user_mention_keepalive, config_json);
+        "user-mention-service", user_mention_addr, user_mention_port,
+        user_mention_min_conns, user_mention_conns, user_mention_timeout,
+        user_mention_keepalive, config_json);
 
-    std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
-    TThreadedServer server(
+    auto server = get_server(
+        config_json, "text-service",
         std::make_shared<TextServiceProcessor>(std::make_shared<TextHandler>(
-            &url_client_pool, &user_mention_pool)),
-        server_socket,
-        std::make_shared<TFramedTransportFactory>(),
-        std::make_shared<TBinaryProtocolFactory>());
+            &url_client_pool, &user_mention_pool, &executor)),
+        "0.0.0.0", port);
 
     LOG(info) << "Starting the text-service server...";
-    server.serve();
+    server->serve();
   } else
     exit(EXIT_FAILURE);
 }
@@ -1,6 +1,7 @@
 #ifndef SOCIAL_NETWORK_MICROSERVICES_THRIFTCLIENT_H
 #define SOCIAL_NETWORK_MICROSERVICES_THRIFTCLIENT_H
 
+#include <atomic>
 #include <string>
 #include <thread>
 #include <iostream>
@@ -15,6 +16,7 @@
 #include <nlohmann/json.hpp>
 #include "logger.h"
 #include "GenericClient.h"
+#include "MultiplexedTransport.h"
 
 
 namespace social_network {
@@ -23,7 +25,6 @@ using apache::thrift::protocol::TProtocol;
 using apache::thrift::protocol::TBinaryProtocol;
 using apache::thrift::transport::TFramedTransport;
 using apache::thrift::transport::TSocket;
-using apache::thrift::transport::TSSLSocketFactory;
 using apache::thrift::transport::TTransport;
 using apache::thrift::TException;
 using json = nlohmann::json;
@@ -75,30 +76,26 @@ ThriftClient<TThriftClient>::ThriftClient(
   _addr = addr;
   _port = port;
   bool ssl_enabled = config_json["ssl"]["enabled"];
-
-  if (ssl_enabled) {
-    std::string ca_path = config_json["ssl"]["caPath"];
-    std::string ciphers = config_json["ssl"]["ciphers"];
-
-    std::shared_ptr<TSSLSocketFactory> factory;
-    factory = std::make_shared<TSSLSocketFactory>();
-    factory->ciphers(ciphers);
-    factory->loadTrustedCertificates(ca_path.c_str());
-
-    // if (config_json["ssl"]["verifyClient"]) {
-    //   std::string cert_path = config_json["ssl"]["clientCertPath"];
-    //   std::string key_path = config_json["ssl"]["clientKeyPath"];
-    //   factory->loadCertificate(cert_path.c_str());
-    //   factory->loadPrivateKey(key_path.c_str());
-    // }
-    // Need verify server
-    factory->authenticate(true);
-    _socket = factory->createSocket(addr, port);
+  auto client_config = config_json.value("thrift_client", json::object());
+  int multiplexed_connections =
+      client_config.value("multiplexed_connections", 0);
+
+  if (multiplexed_connections > 0 && !ssl_enabled) {
+    // Many clients share a few connections to the peer, so pooling clients
+    // no longer pools sockets.
+    _transport = std::make_shared<MultiplexedChannel>(
+        MultiplexedConnection::Get(addr, port, multiplexed_connections,
+                                   config_json),
+        client_config.value("call_timeout_ms", 10000));
   } else {
-    _socket = std::shared_ptr<TSocket>(new TSocket(addr, port));
+    static std::atomic<bool> ssl_warned(false);
+    if (multiplexed_connections > 0 && !ssl_warned.exchange(true)) {
+      // An SSL session cannot be read and written from different threads.
+      LOG(warning) << "Multiplexed Thrift connections are disabled with SSL";
+    }
+    _socket = get_client_socket(config_json, addr, port);
+    _transport = std::shared_ptr<TTransport>(new TFramedTransport(_socket));
   }
-  _socket->setKeepAlive(true);
-  _transport = std::shared_ptr<TTransport>(new TFramedTransport(_socket));
   _protocol = std::shared_ptr<TProtocol>(new TBinaryProtocol(_transport));
   _client = new TThriftClient(_protocol);
   _connect_timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
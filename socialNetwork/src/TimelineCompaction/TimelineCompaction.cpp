@@ -0,0 +1,443 @@
+// Trims user and home timelines that were written before
+// user_timeline_max_len or home_timeline_max_len were set, so that existing
+// data is within the same bounds the services now keep:
+//  - "posts" arrays in the user-timeline MongoDB are cut to the newest N
+//    entries with a single updateMany;
+//  - user-timeline-buckets documents are cut to the newest N entries the same
+//    way, and the buckets of each user older than the newest buckets that
+//    together hold N posts are deleted;
+//  - user timeline and home timeline zsets in Redis are cut to the newest N
+//    entries with pipelined ZREMRANGEBYRANK, one pipeline per Redis node.
+// The Redis keys are found through MongoDB: user timelines through the
+// user-timeline collection, or user-timeline-buckets when timeline_bucket_ms
+// is set, home timelines through the user collection.
+//
+// Run it from the socialNetwork directory so config/service-config.json is
+// found, e.g. TimelineCompaction --user-timeline-max-len 1000
+
+#include <bson/bson.h>
+#include <mongoc.h>
+#include <sw/redis++/redis++.h>
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../logger.h"
+#include "../utils.h"
+#include "../utils_mongodb.h"
+#include "../utils_redis.h"
+
+using namespace sw::redis;
+using namespace social_network;
+
+// Removes everything but the newest max_len posts from the zsets of
+// user_ids and returns the number of posts removed.
+class TimelineTrimmer {
+ public:
+  TimelineTrimmer(Redis *redis, int64_t max_len)
+      : _redis(redis), _redis_cluster(nullptr), _max_len(max_len) {}
+  TimelineTrimmer(RedisCluster *redis_cluster, int64_t max_len)
+      : _redis(nullptr), _redis_cluster(redis_cluster), _max_len(max_len) {}
+
+  long long Trim(const std::vector<int64_t> &user_ids) {
+    std::map<std::shared_ptr<ConnectionPool>, std::shared_ptr<Pipeline>>
+        pipe_map;
+    std::map<std::shared_ptr<ConnectionPool>, size_t> pipe_sizes;
+    for (auto user_id : user_ids) {
+      std::string key = std::to_string(user_id);
+      std::shared_ptr<ConnectionPool> conn;
+      if (_redis_cluster) {
+        conn = _redis_cluster->get_shards_pool()->fetch(key);
+      }
+      auto pipe = pipe_map.find(conn);
+      if (pipe == pipe_map.end()) {
+        auto new_pipe = std::make_shared<Pipeline>(
+            _redis ? _redis->pipeline(false)
+                   : _redis_cluster->pipeline(key, false));
+        pipe = pipe_map.emplace(conn, new_pipe).first;
+      }
+      pipe->second->zremrangebyrank(key, 0, -(_max_len + 1));
+      ++pipe_sizes[conn];
+    }
+
+    long long removed = 0;
+    for (auto &it : pipe_map) {
+      auto replies = it.second->exec();
+      for (size_t i = 0; i < pipe_sizes[it.first]; ++i) {
+        removed += replies.get<long long>(i);
+      }
+    }
+    return removed;
+  }
+
+ private:
+  Redis *_redis;
+  RedisCluster *_redis_cluster;
+  int64_t _max_len;
+};
+
+// Calls fn with the user_id of every document in db.collection, batch_size
+// ids at a time, until fn returns false. A user with several documents, as in
+// user-timeline-buckets, is passed once.
+bool ForEachUserIdBatch(
+    mongoc_client_pool_t *mongodb_client_pool, const std::string &db,
+    const std::string &collection_name, size_t batch_size,
+    const std::function<bool(const std::vector<int64_t> &)> &fn) {
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(error) << "Failed to pop a client from MongoDB pool";
+    return false;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, db.c_str(), collection_name.c_str());
+  bson_t *query = bson_new();
+  // Every collection read here has an index starting with user_id, and the
+  // sort brings the documents of a user together.
+  bson_t *opts = BCON_NEW("projection", "{", "user_id", BCON_BOOL(true),
+                          "_id", BCON_BOOL(false), "}", "sort", "{",
+                          "user_id", BCON_INT32(1), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+
+  std::vector<int64_t> user_ids;
+  int64_t last_user_id = 0;
+  bool any = false;
+  const bson_t *doc;
+  bson_iter_t iter;
+  bool ok = true;
+  while (ok && mongoc_cursor_next(cursor, &doc)) {
+    if (bson_iter_init_find(&iter, doc, "user_id")) {
+      int64_t user_id = bson_iter_as_int64(&iter);
+      if (!any || user_id != last_user_id) {
+        user_ids.emplace_back(user_id);
+      }
+      last_user_id = user_id;
+      any = true;
+    }
+    if (user_ids.size() >= batch_size) {
+      ok = fn(user_ids);
+      user_ids.clear();
+    }
+  }
+  if (ok && !user_ids.empty()) {
+    ok = fn(user_ids);
+  }
+
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    ok = false;
+    LOG(error) << "Failed to read " << db << "." << collection_name << ": "
+               << error.message;
+  }
+  mongoc_cursor_destroy(cursor);
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  return ok;
+}
+
+// Cuts every "posts" array with more than max_len entries to its first
+// (newest) max_len entries. Returns the number of documents changed, or -1.
+int64_t CompactUserTimelineDocuments(mongoc_client_pool_t *mongodb_client_pool,
+                                     int64_t max_len) {
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(error) << "Failed to pop a client from MongoDB pool";
+    return -1;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "user-timeline", "user-timeline");
+  std::string past_max_len = "posts." + std::to_string(max_len);
+  bson_t *selector = BCON_NEW(past_max_len.c_str(), "{", "$exists",
+                              BCON_BOOL(true), "}");
+  bson_t *update = BCON_NEW("$push", "{", "posts", "{", "$each", "[", "]",
+                            "$slice", BCON_INT64(max_len), "}", "}");
+  bson_t reply;
+  bson_error_t error;
+  int64_t modified = -1;
+  if (mongoc_collection_update_many(collection, selector, update, nullptr,
+                                    &reply, &error)) {
+    bson_iter_t iter;
+    modified = bson_iter_init_find(&iter, &reply, "modifiedCount")
+                   ? bson_iter_as_int64(&iter)
+                   : 0;
+  } else {
+    LOG(error) << "Failed to compact user-timeline in MongoDB: "
+               << error.message;
+  }
+  bson_destroy(&reply);
+  bson_destroy(update);
+  bson_destroy(selector);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  return modified;
+}
+
+// Cuts every bucket with more than max_len posts to its newest max_len posts,
+// then deletes the buckets of each user older than the newest buckets that
+// together hold max_len posts. Returns the number of buckets changed or
+// deleted, or -1.
+int64_t CompactUserTimelineBuckets(mongoc_client_pool_t *mongodb_client_pool,
+                                   int64_t max_len) {
+  mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(error) << "Failed to pop a client from MongoDB pool";
+    return -1;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "user-timeline", "user-timeline-buckets");
+  std::string past_max_len = "posts." + std::to_string(max_len);
+  bson_t *selector = BCON_NEW(past_max_len.c_str(), "{", "$exists",
+                              BCON_BOOL(true), "}");
+  bson_t *update = BCON_NEW("$push", "{", "posts", "{", "$each", "[", "]",
+                            "$sort", "{", "timestamp", BCON_INT32(-1), "}",
+                            "$slice", BCON_INT64(max_len), "}", "}");
+  bson_t reply;
+  bson_error_t error;
+  bson_iter_t iter;
+  int64_t changed = -1;
+  if (mongoc_collection_update_many(collection, selector, update, nullptr,
+                                    &reply, &error)) {
+    changed = bson_iter_init_find(&iter, &reply, "modifiedCount")
+                  ? bson_iter_as_int64(&iter)
+                  : 0;
+  } else {
+    LOG(error) << "Failed to compact user-timeline-buckets in MongoDB: "
+               << error.message;
+  }
+  bson_destroy(&reply);
+  bson_destroy(update);
+  bson_destroy(selector);
+
+  // Walks the (user_id, bucket) index backwards, so each user's buckets come
+  // newest first, and deletes the older buckets of a user once past them.
+  bson_t *query = bson_new();
+  bson_t *opts = BCON_NEW("projection", "{", "user_id", BCON_BOOL(true),
+                          "bucket", BCON_BOOL(true), "size", "{", "$size",
+                          BCON_UTF8("$posts"), "}", "_id", BCON_BOOL(false),
+                          "}", "sort", "{", "user_id", BCON_INT32(-1),
+                          "bucket", BCON_INT32(-1), "}");
+  mongoc_cursor_t *cursor = changed < 0 ? nullptr
+      : mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  auto delete_older = [&](int64_t user_id, int64_t oldest_kept) {
+    bson_t *old_buckets =
+        BCON_NEW("user_id", BCON_INT64(user_id), "bucket", "{", "$lt",
+                 BCON_INT64(oldest_kept), "}");
+    bson_t deleted;
+    bool ok = mongoc_collection_delete_many(collection, old_buckets, nullptr,
+                                            &deleted, &error);
+    if (ok) {
+      changed += bson_iter_init_find(&iter, &deleted, "deletedCount")
+                     ? bson_iter_as_int64(&iter)
+                     : 0;
+    } else {
+      LOG(error) << "Failed to delete old timeline buckets of user "
+                 << user_id << " from MongoDB: " << error.message;
+    }
+    bson_destroy(&deleted);
+    bson_destroy(old_buckets);
+    return ok;
+  };
+  int64_t user_id = 0;
+  int64_t posts = 0;
+  int64_t oldest_kept = 0;
+  bool any = false;
+  bool trim = false;
+  const bson_t *doc;
+  while (cursor && changed >= 0 && mongoc_cursor_next(cursor, &doc)) {
+    if (!bson_iter_init_find(&iter, doc, "user_id")) {
+      continue;
+    }
+    int64_t doc_user_id = bson_iter_as_int64(&iter);
+    if (!any || doc_user_id != user_id) {
+      if (trim && !delete_older(user_id, oldest_kept)) {
+        changed = -1;
+        break;
+      }
+      user_id = doc_user_id;
+      posts = 0;
+      trim = false;
+      any = true;
+    }
+    if (trim) {
+      continue;
+    }
+    if (bson_iter_init_find(&iter, doc, "size")) {
+      posts += bson_iter_as_int64(&iter);
+    }
+    if (posts >= max_len && bson_iter_init_find(&iter, doc, "bucket")) {
+      oldest_kept = bson_iter_as_int64(&iter);
+      trim = true;
+    }
+  }
+  if (cursor) {
+    if (mongoc_cursor_error(cursor, &error)) {
+      LOG(error) << "Failed to read user-timeline-buckets: " << error.message;
+      changed = -1;
+    } else if (changed >= 0 && trim && !delete_older(user_id, oldest_kept)) {
+      changed = -1;
+    }
+    mongoc_cursor_destroy(cursor);
+  }
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
+  return changed;
+}
+
+bool TrimRedisTimelines(mongoc_client_pool_t *mongodb_client_pool,
+                        const std::string &db, const std::string &collection,
+                        TimelineTrimmer *trimmer, size_t batch_size,
+                        const std::string &name) {
+  long long removed = 0;
+  size_t users = 0;
+  bool ok = ForEachUserIdBatch(
+      mongodb_client_pool, db, collection, batch_size,
+      [&](const std::vector<int64_t> &user_ids) {
+        try {
+          removed += trimmer->Trim(user_ids);
+        } catch (const Error &err) {
+          LOG(error) << "Failed to trim " << name << " in Redis: "
+                     << err.what();
+          return false;
+        }
+        users += user_ids.size();
+        return true;
+      });
+  LOG(info) << "Trimmed " << name << " of " << users << " users in Redis, "
+            << removed << " posts removed";
+  return ok;
+}
+
+// The zset keys are the user_ids listed in db.collection.
+bool TrimRedisTimelines(const json &config_json, bool redis_cluster_flag,
+                        const std::string &service_name,
+                        mongoc_client_pool_t *mongodb_client_pool,
+                        const std::string &db, const std::string &collection,
+                        int64_t max_len, size_t batch_size) {
+  int redis_cluster_config_flag =
+      config_json[service_name + "-redis"]["use_cluster"];
+  int redis_replica_config_flag =
+      config_json[service_name + "-redis"]["use_replica"];
+  std::string name = service_name + " timelines";
+  if (redis_cluster_flag || redis_cluster_config_flag) {
+    RedisCluster redis_cluster_client_pool =
+        init_redis_cluster_client_pool(config_json, service_name);
+    TimelineTrimmer trimmer(&redis_cluster_client_pool, max_len);
+    return TrimRedisTimelines(mongodb_client_pool, db, collection, &trimmer,
+                              batch_size, name);
+  } else if (redis_replica_config_flag) {
+    Redis redis_primary_client_pool =
+        init_redis_replica_client_pool(config_json, "redis-primary");
+    TimelineTrimmer trimmer(&redis_primary_client_pool, max_len);
+    return TrimRedisTimelines(mongodb_client_pool, db, collection, &trimmer,
+                              batch_size, name);
+  } else {
+    Redis redis_client_pool = init_redis_client_pool(config_json, service_name);
+    TimelineTrimmer trimmer(&redis_client_pool, max_len);
+    return TrimRedisTimelines(mongodb_client_pool, db, collection, &trimmer,
+                              batch_size, name);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  json config_json;
+  if (load_config_file("config/service-config.json", &config_json) != 0) {
+    exit(EXIT_FAILURE);
+  }
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "redis-cluster",
+      po::value<bool>()->default_value(false)->implicit_value(true),
+      "Enable redis cluster mode")(
+      "user-timeline-max-len",
+      po::value<int64_t>()->default_value(
+          config_json["user-timeline-service"].value("user_timeline_max_len",
+                                                     0)),
+      "Posts to keep per user timeline, 0 to leave them untouched")(
+      "home-timeline-max-len",
+      po::value<int64_t>()->default_value(
+          config_json["home-timeline-service"].value("home_timeline_max_len",
+                                                     0)),
+      "Posts to keep per home timeline, 0 to leave them untouched")(
+      "batch-size", po::value<int>()->default_value(1000),
+      "Timelines trimmed per Redis pipeline");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  bool redis_cluster_flag = vm["redis-cluster"].as<bool>();
+  int64_t user_timeline_max_len = vm["user-timeline-max-len"].as<int64_t>();
+  int64_t home_timeline_max_len = vm["home-timeline-max-len"].as<int64_t>();
+  size_t batch_size = std::max(vm["batch-size"].as<int>(), 1);
+  if (user_timeline_max_len <= 0 && home_timeline_max_len <= 0) {
+    LOG(info) << "No timeline length bound is set, nothing to do";
+    return 0;
+  }
+
+  bool ok = true;
+  if (user_timeline_max_len > 0) {
+    auto mongodb_client_pool =
+        init_mongodb_client_pool(config_json, "user-timeline", 2);
+    if (mongodb_client_pool == nullptr) {
+      return EXIT_FAILURE;
+    }
+    int64_t modified =
+        CompactUserTimelineDocuments(mongodb_client_pool, user_timeline_max_len);
+    if (modified < 0) {
+      ok = false;
+    } else {
+      LOG(info) << "Trimmed " << modified
+                << " user-timeline documents in MongoDB";
+    }
+    // Both layouts are compacted, since a migration leaves the old one behind.
+    modified =
+        CompactUserTimelineBuckets(mongodb_client_pool, user_timeline_max_len);
+    if (modified < 0) {
+      ok = false;
+    } else {
+      LOG(info) << "Trimmed or deleted " << modified
+                << " user-timeline-buckets documents in MongoDB";
+    }
+    bool bucketed =
+        config_json["user-timeline-service"].value("timeline_bucket_ms", 0) > 0;
+    ok = TrimRedisTimelines(
+             config_json, redis_cluster_flag, "user-timeline",
+             mongodb_client_pool, "user-timeline",
+             bucketed ? "user-timeline-buckets" : "user-timeline",
+             user_timeline_max_len, batch_size) && ok;
+    mongoc_client_pool_destroy(mongodb_client_pool);
+  }
+
+  if (home_timeline_max_len > 0) {
+    auto mongodb_client_pool = init_mongodb_client_pool(config_json, "user", 2);
+    if (mongodb_client_pool == nullptr) {
+      return EXIT_FAILURE;
+    }
+    ok = TrimRedisTimelines(config_json, redis_cluster_flag, "home-timeline",
+                            mongodb_client_pool, "user", "user",
+                            home_timeline_max_len, batch_size) && ok;
+    mongoc_client_pool_destroy(mongodb_client_pool);
+  }
+
+  mongoc_cleanup();
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
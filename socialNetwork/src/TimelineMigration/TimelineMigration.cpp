@@ -0,0 +1,233 @@
+// Copies user timelines from the one-document-per-user layout
+// ("user-timeline" collection) to the bucketed layout read when
+// timeline_bucket_ms is set ("user-timeline-buckets" collection, one document
+// per user_id and bucket).
+//
+// Posts are merged into the buckets with $addToSet, so the tool can be run
+// again, and can run while the service already writes to the buckets. The
+// source collection is left untouched.
+//
+// Run it from the socialNetwork directory so config/service-config.json is
+// found, e.g. TimelineMigration --bucket-ms 86400000
+
+#include <bson/bson.h>
+#include <mongoc.h>
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../bson_codec.h"
+#include "../logger.h"
+#include "../utils.h"
+#include "../utils_mongodb.h"
+
+using namespace social_network;
+
+// Queues one upsert per bucket of posts and sends them in unordered bulk
+// writes of at most batch_size operations.
+class BucketWriter {
+ public:
+  BucketWriter(mongoc_collection_t *collection, size_t batch_size)
+      : _collection(collection), _batch_size(batch_size), _bulk(nullptr),
+        _queued(0), _upserted(0), _modified(0), _ok(true) {}
+  ~BucketWriter() {
+    if (_bulk) {
+      mongoc_bulk_operation_destroy(_bulk);
+    }
+  }
+
+  void Add(int64_t user_id, int64_t bucket,
+           const std::vector<std::pair<int64_t, int64_t>> &posts) {
+    if (!_bulk) {
+      bson_t *opts = BCON_NEW("ordered", BCON_BOOL(false));
+      _bulk = mongoc_collection_create_bulk_operation_with_opts(_collection,
+                                                                opts);
+      bson_destroy(opts);
+    }
+    bson_t *selector = BCON_NEW("user_id", BCON_INT64(user_id), "bucket",
+                                BCON_INT64(bucket));
+    // Same field order as WriteUserTimeline, so $addToSet sees a post that
+    // is already in the bucket as equal.
+    bson_t *update = bson_new();
+    bson_t add_to_set, field, each;
+    BSON_APPEND_DOCUMENT_BEGIN(update, "$addToSet", &add_to_set);
+    BSON_APPEND_DOCUMENT_BEGIN(&add_to_set, "posts", &field);
+    BSON_APPEND_ARRAY_BEGIN(&field, "$each", &each);
+    for (size_t i = 0; i < posts.size(); ++i) {
+      const char *key;
+      char buf[16];
+      bson_uint32_to_string(i, &key, buf, sizeof(buf));
+      bson_t post;
+      BSON_APPEND_DOCUMENT_BEGIN(&each, key, &post);
+      BSON_APPEND_INT64(&post, "post_id", posts[i].first);
+      BSON_APPEND_INT64(&post, "timestamp", posts[i].second);
+      bson_append_document_end(&each, &post);
+    }
+    bson_append_array_end(&field, &each);
+    bson_append_document_end(&add_to_set, &field);
+    bson_append_document_end(update, &add_to_set);
+    bson_t *opts = BCON_NEW("upsert", BCON_BOOL(true));
+
+    bson_error_t error;
+    if (!mongoc_bulk_operation_update_one_with_opts(_bulk, selector, update,
+                                                    opts, &error)) {
+      LOG(error) << "Failed to queue bucket " << bucket << " of user "
+                 << user_id << ": " << error.message;
+      _ok = false;
+    } else if (++_queued >= _batch_size) {
+      Flush();
+    }
+    bson_destroy(opts);
+    bson_destroy(update);
+    bson_destroy(selector);
+  }
+
+  void Flush() {
+    if (!_bulk) {
+      return;
+    }
+    bson_t reply;
+    bson_error_t error;
+    if (mongoc_bulk_operation_execute(_bulk, &reply, &error)) {
+      bson_iter_t iter;
+      if (bson_iter_init_find(&iter, &reply, "nUpserted")) {
+        _upserted += bson_iter_as_int64(&iter);
+      }
+      if (bson_iter_init_find(&iter, &reply, "nModified")) {
+        _modified += bson_iter_as_int64(&iter);
+      }
+    } else {
+      LOG(error) << "Failed to write buckets: " << error.message;
+      _ok = false;
+    }
+    bson_destroy(&reply);
+    mongoc_bulk_operation_destroy(_bulk);
+    _bulk = nullptr;
+    _queued = 0;
+  }
+
+  int64_t upserted() const { return _upserted; }
+  int64_t modified() const { return _modified; }
+  bool ok() const { return _ok; }
+
+ private:
+  mongoc_collection_t *_collection;
+  size_t _batch_size;
+  mongoc_bulk_operation_t *_bulk;
+  size_t _queued;
+  int64_t _upserted;
+  int64_t _modified;
+  bool _ok;
+};
+
+int main(int argc, char *argv[]) {
+  init_logger();
+
+  json config_json;
+  if (load_config_file("config/service-config.json", &config_json) != 0) {
+    exit(EXIT_FAILURE);
+  }
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "bucket-ms",
+      po::value<int64_t>()->default_value(
+          config_json["user-timeline-service"].value("timeline_bucket_ms", 0)),
+      "Length of a timeline bucket in milliseconds")(
+      "batch-size", po::value<int>()->default_value(1000),
+      "Bucket upserts per bulk write");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  int64_t bucket_ms = vm["bucket-ms"].as<int64_t>();
+  size_t batch_size = std::max(vm["batch-size"].as<int>(), 1);
+  if (bucket_ms <= 0) {
+    LOG(error) << "Set --bucket-ms or timeline_bucket_ms in the "
+               << "user-timeline-service block";
+    return EXIT_FAILURE;
+  }
+
+  auto mongodb_client_pool =
+      init_mongodb_client_pool(config_json, "user-timeline", 2);
+  if (mongodb_client_pool == nullptr) {
+    return EXIT_FAILURE;
+  }
+  mongoc_client_t *source_client = mongoc_client_pool_pop(mongodb_client_pool);
+  mongoc_client_t *target_client = mongoc_client_pool_pop(mongodb_client_pool);
+  if (!source_client || !target_client) {
+    LOG(fatal) << "Failed to pop mongoc client";
+    return EXIT_FAILURE;
+  }
+  if (!CreateIndex(target_client, "user-timeline", "user-timeline-buckets",
+                   {"user_id", "bucket"}, true)) {
+    return EXIT_FAILURE;
+  }
+
+  auto source = mongoc_client_get_collection(source_client, "user-timeline",
+                                             "user-timeline");
+  auto target = mongoc_client_get_collection(target_client, "user-timeline",
+                                             "user-timeline-buckets");
+  bson_t *query = bson_new();
+  bson_t *opts = BCON_NEW("projection", "{", "_id", BCON_BOOL(false), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(source, query, opts, nullptr);
+
+  BucketWriter writer(target, batch_size);
+  int64_t users = 0;
+  int64_t posts_copied = 0;
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter;
+    if (!bson_iter_init_find(&iter, doc, "user_id")) {
+      continue;
+    }
+    int64_t user_id = bson_iter_as_int64(&iter);
+    std::vector<std::pair<int64_t, int64_t>> posts;
+    bson_decode_timestamped_ids(doc, "posts", "post_id", &posts);
+
+    std::map<int64_t, std::vector<std::pair<int64_t, int64_t>>> buckets;
+    for (auto &post : posts) {
+      buckets[post.second - post.second % bucket_ms].emplace_back(post);
+    }
+    for (auto &bucket : buckets) {
+      writer.Add(user_id, bucket.first, bucket.second);
+    }
+    ++users;
+    posts_copied += posts.size();
+  }
+  writer.Flush();
+
+  bool ok = writer.ok();
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    LOG(error) << "Failed to read user-timeline: " << error.message;
+    ok = false;
+  }
+  LOG(info) << "Copied " << posts_copied << " posts of " << users
+            << " users: " << writer.upserted() << " buckets created, "
+            << writer.modified() << " buckets updated";
+
+  mongoc_cursor_destroy(cursor);
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_collection_destroy(target);
+  mongoc_collection_destroy(source);
+  mongoc_client_pool_push(mongodb_client_pool, target_client);
+  mongoc_client_pool_push(mongodb_client_pool, source_client);
+  mongoc_client_pool_destroy(mongodb_client_pool);
+  mongoc_cleanup();
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
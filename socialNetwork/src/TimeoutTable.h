@@ -0,0 +1,253 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_TIMEOUTTABLE_H
+#define SOCIAL_NETWORK_MICROSERVICES_TIMEOUTTABLE_H
+
+#include <array>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ReloadableTable.h"
+#include "logger.h"
+
+namespace social_network {
+
+/*
+ * Process-wide table of per-future timeouts and injected wait times.
+ *
+ * Both files use the "<Service>-<future> : <duration>" line format, with
+ * durations as accepted by ParseDuration. Snapshots, registration and reloads
+ * are those of ReloadableTable.
+ *
+ * Observed latencies are recorded into fixed-bucket histograms and written to
+ * the stats file by a background thread.
+ */
+class TimeoutTable {
+ public:
+  static constexpr int kMaxSlots = ReloadableTable<int>::kMaxSlots;
+  static constexpr int kHistogramBuckets = 32;
+
+  TimeoutTable(const std::string &timeout_values_path,
+               const std::string &wait_times_path,
+               const std::string &latency_stats_path, int flush_interval_ms);
+  ~TimeoutTable();
+
+  TimeoutTable(const TimeoutTable &) = delete;
+  TimeoutTable &operator=(const TimeoutTable &) = delete;
+
+  int Register(const std::string &key);
+  void Start(int poll_interval_ms);
+  void Stop();
+  void RequestReload();
+
+  std::chrono::milliseconds Timeout(int slot) const;
+  std::chrono::milliseconds WaitTime(int slot) const;
+  uint64_t Version() const;
+  void RecordLatency(int slot, int64_t latency_ms);
+
+ private:
+  struct Entry {
+    std::chrono::milliseconds timeout{0};
+    std::chrono::milliseconds wait_time{0};
+  };
+
+  struct LatencyHistogram {
+    std::array<std::atomic<uint64_t>, kHistogramBuckets> buckets;
+    std::atomic<int64_t> max_ms;
+    std::atomic<int64_t> last_ms;
+  };
+
+  std::string _latency_stats_path;
+  int _flush_interval_ms;
+
+  ReloadableTable<Entry> _table;
+  std::array<LatencyHistogram, kMaxSlots> _histograms;
+
+  std::atomic<bool> _running;
+  std::thread _thread;
+
+  static bool _LoadFiles(const std::vector<std::string> &paths,
+                         std::map<std::string, Entry> *entries);
+  void _Flush();
+  void _Run();
+};
+
+std::map<std::string, std::string> ParseKeyValueFile(const std::string &path) {
+  std::map<std::string, std::string> values;
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    LOG(warning) << "Cannot open " << path;
+    return values;
+  }
+  std::string line;
+  while (std::getline(file, line)) {
+    auto pos = line.find(':');
+    if (pos == std::string::npos) {
+      continue;
+    }
+    std::string key = line.substr(0, pos);
+    std::string value = line.substr(pos + 1);
+    key.erase(key.find_last_not_of(" \t\r") + 1);
+    key.erase(0, key.find_first_not_of(" \t"));
+    value.erase(value.find_last_not_of(" \t\r") + 1);
+    value.erase(0, value.find_first_not_of(" \t"));
+    if (!key.empty()) {
+      values[key] = value;
+    }
+  }
+  return values;
+}
+
+TimeoutTable::TimeoutTable(const std::string &timeout_values_path,
+                           const std::string &wait_times_path,
+                           const std::string &latency_stats_path,
+                           int flush_interval_ms)
+    : _table("timeout table", &TimeoutTable::_LoadFiles) {
+  _latency_stats_path = latency_stats_path;
+  _flush_interval_ms = flush_interval_ms;
+  _running = false;
+  for (auto &histogram : _histograms) {
+    for (auto &bucket : histogram.buckets) {
+      bucket = 0;
+    }
+    histogram.max_ms = 0;
+    histogram.last_ms = -1;
+  }
+  _table.Load({timeout_values_path, wait_times_path});
+}
+
+TimeoutTable::~TimeoutTable() { Stop(); }
+
+int TimeoutTable::Register(const std::string &key) {
+  return _table.Register(key);
+}
+
+void TimeoutTable::Start(int poll_interval_ms) {
+  _table.Start(poll_interval_ms);
+  if (_running.exchange(true)) {
+    return;
+  }
+  _thread = std::thread(&TimeoutTable::_Run, this);
+}
+
+void TimeoutTable::Stop() {
+  _table.Stop();
+  if (!_running.exchange(false)) {
+    return;
+  }
+  if (_thread.joinable()) {
+    _thread.join();
+  }
+  _Flush();
+}
+
+void TimeoutTable::RequestReload() { _table.RequestReload(); }
+
+std::chrono::milliseconds TimeoutTable::Timeout(int slot) const {
+  return _table.Get(slot).timeout;
+}
+
+std::chrono::milliseconds TimeoutTable::WaitTime(int slot) const {
+  return _table.Get(slot).wait_time;
+}
+
+uint64_t TimeoutTable::Version() const { return _table.Version(); }
+
+void TimeoutTable::RecordLatency(int slot, int64_t latency_ms) {
+  if (slot < 0 || slot >= kMaxSlots) {
+    return;
+  }
+  if (latency_ms < 0) {
+    latency_ms = 0;
+  }
+  // Bucket i holds latencies in [2^(i-1), 2^i) ms, bucket 0 holds 0 ms.
+  int bucket = 0;
+  while (bucket < kHistogramBuckets - 1 && (latency_ms >> bucket) > 0) {
+    bucket++;
+  }
+  auto &histogram = _histograms[slot];
+  histogram.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  histogram.last_ms.store(latency_ms, std::memory_order_relaxed);
+  auto curr_max = histogram.max_ms.load(std::memory_order_relaxed);
+  while (latency_ms > curr_max &&
+         !histogram.max_ms.compare_exchange_weak(curr_max, latency_ms,
+                                                 std::memory_order_relaxed)) {
+  }
+}
+
+bool TimeoutTable::_LoadFiles(const std::vector<std::string> &paths,
+                              std::map<std::string, Entry> *entries) {
+  for (auto &timeout : ParseKeyValueFile(paths[0])) {
+    (*entries)[timeout.first].timeout = ParseDuration(timeout.second);
+  }
+  for (auto &wait_time : ParseKeyValueFile(paths[1])) {
+    (*entries)[wait_time.first].wait_time = ParseDuration(wait_time.second);
+  }
+  return true;
+}
+
+void TimeoutTable::_Flush() {
+  auto keys = _table.Keys();
+  std::ostringstream out;
+  for (int slot = 0; slot < keys.size(); ++slot) {
+    auto &histogram = _histograms[slot];
+    std::array<uint64_t, kHistogramBuckets> counts;
+    uint64_t total = 0;
+    for (int i = 0; i < kHistogramBuckets; ++i) {
+      counts[i] = histogram.buckets[i].load(std::memory_order_relaxed);
+      total += counts[i];
+    }
+    out << keys[slot] << ": count=" << total;
+    if (total > 0) {
+      // Report the upper bound of the bucket holding each percentile.
+      auto percentile = [&](double p) {
+        auto rank = std::max<uint64_t>(1, std::ceil(p * total));
+        uint64_t seen = 0;
+        for (int i = 0; i < kHistogramBuckets; ++i) {
+          seen += counts[i];
+          if (seen >= rank) {
+            return i == 0 ? int64_t(0) : (int64_t(1) << i) - 1;
+          }
+        }
+        return histogram.max_ms.load(std::memory_order_relaxed);
+      };
+      out << " last=" << histogram.last_ms.load(std::memory_order_relaxed)
+          << "ms p50<=" << percentile(0.5) << "ms p99<=" << percentile(0.99)
+          << "ms max=" << histogram.max_ms.load(std::memory_order_relaxed)
+          << "ms";
+    }
+    out << std::endl;
+  }
+  std::ofstream stats_file(_latency_stats_path, std::ios::trunc);
+  if (!stats_file.is_open()) {
+    LOG(warning) << "Cannot open " << _latency_stats_path;
+    return;
+  }
+  stats_file << out.str();
+}
+
+void TimeoutTable::_Run() {
+  auto next_flush = std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(_flush_interval_ms);
+  while (_running) {
+    // Short sleep so Stop() is picked up promptly.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (std::chrono::steady_clock::now() >= next_flush) {
+      _Flush();
+      next_flush = std::chrono::steady_clock::now() +
+          std::chrono::milliseconds(_flush_interval_ms);
+    }
+  }
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_TIMEOUTTABLE_H
@@ -0,0 +1,150 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_UNIQUEIDGENERATOR_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_UNIQUEIDGENERATOR_H_
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "logger.h"
+
+// Custom Epoch (January 1, 2018 Midnight GMT = 2018-01-01T00:00:00Z)
+#define CUSTOM_EPOCH 1514764800000
+
+namespace social_network {
+
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::system_clock;
+
+/*
+ * Generates the 64-bit IDs described in UniqueIdService.cpp without a lock.
+ * unique-id-service runs one, and ComposePostService can run its own in
+ * process (unique_id_mode "embedded"); each needs a distinct machine ID.
+ *
+ * The timestamp and counter of the next free ID are packed into one atomic
+ * word as (timestamp << 12 | counter), the low 52 bits of the ID, so taking
+ * count IDs is a single compare-and-swap that adds count to it. When the
+ * counter of a millisecond runs out the word simply carries into the next
+ * millisecond, and Next waits until the clock has reached it, so an ID never
+ * carries a timestamp from the future. The same wait covers the clock going
+ * backwards.
+ */
+class UniqueIdGenerator {
+ public:
+  static constexpr int kCounterBits = 12;
+  // The most IDs one call can take: they all share one millisecond.
+  static constexpr int kMaxCount = 1 << kCounterBits;
+
+  explicit UniqueIdGenerator(const std::string &machine_id);
+
+  // Returns the first of count consecutive IDs, 1 <= count <= kMaxCount.
+  int64_t Next(int count);
+
+ private:
+  uint64_t _machine_bits;
+  std::atomic<uint64_t> _state;
+
+  static uint64_t _Now();
+};
+
+UniqueIdGenerator::UniqueIdGenerator(const std::string &machine_id)
+    : _state(0) {
+  _machine_bits = std::stoull(machine_id, nullptr, 16) << 52;
+}
+
+uint64_t UniqueIdGenerator::_Now() {
+  uint64_t timestamp =
+      duration_cast<milliseconds>(system_clock::now().time_since_epoch())
+          .count() -
+      CUSTOM_EPOCH;
+  return (timestamp & 0xFFFFFFFFFF) << kCounterBits;
+}
+
+int64_t UniqueIdGenerator::Next(int count) {
+  uint64_t n = count;
+  uint64_t state = _state.load(std::memory_order_relaxed);
+  bool warned = false;
+  while (true) {
+    uint64_t now = _Now();
+    uint64_t first = std::max(state, now);
+    uint64_t last_ms = (first + n - 1) >> kCounterBits;
+    uint64_t now_ms = now >> kCounterBits;
+    if (last_ms > now_ms) {
+      if (last_ms - now_ms > 1) {
+        if (!warned) {
+          LOG(warning) << "Clock is " << last_ms - now_ms
+                       << " ms behind the last unique id, waiting for it";
+          warned = true;
+        }
+        std::this_thread::sleep_for(milliseconds(1));
+      } else {
+        std::this_thread::yield();
+      }
+      state = _state.load(std::memory_order_relaxed);
+      continue;
+    }
+    // Uniqueness only needs the compare-and-swap to be atomic; the IDs carry
+    // no other data, so no ordering is required.
+    if (_state.compare_exchange_weak(state, first + n,
+                                     std::memory_order_relaxed)) {
+      return (_machine_bits | first) & 0x7FFFFFFFFFFFFFFF;
+    }
+  }
+}
+
+/*
+ * The following code which obtaines machine ID from machine's MAC address was
+ * inspired from https://stackoverflow.com/a/16859693.
+ *
+ * MAC address is obtained from /sys/class/net/<netif>/address
+ */
+u_int16_t HashMacAddressPid(const std::string &mac) {
+  u_int16_t hash = 0;
+  std::string mac_pid = mac + std::to_string(getpid());
+  for (unsigned int i = 0; i < mac_pid.size(); i++) {
+    hash += (mac_pid[i] << ((i & 1) * 8));
+  }
+  return hash;
+}
+
+std::string GetMachineId(std::string &netif) {
+  std::string mac_hash;
+
+  std::string mac_addr_filename = "/sys/class/net/" + netif + "/address";
+  std::ifstream mac_addr_file;
+  mac_addr_file.open(mac_addr_filename);
+  if (!mac_addr_file) {
+    LOG(fatal) << "Cannot read MAC address from net interface " << netif;
+    return "";
+  }
+  std::string mac;
+  mac_addr_file >> mac;
+  if (mac == "") {
+    LOG(fatal) << "Cannot read MAC address from net interface " << netif;
+    return "";
+  }
+  mac_addr_file.close();
+
+  LOG(info) << "MAC address = " << mac;
+
+  std::stringstream stream;
+  stream << std::hex << HashMacAddressPid(mac);
+  mac_hash = stream.str();
+
+  if (mac_hash.size() > 3) {
+    mac_hash.erase(0, mac_hash.size() - 3);
+  } else if (mac_hash.size() < 3) {
+    mac_hash = std::string(3 - mac_hash.size(), '0') + mac_hash;
+  }
+  return mac_hash;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_UNIQUEIDGENERATOR_H_
@@ -1,62 +1,32 @@
 #ifndef SOCIAL_NETWORK_MICROSERVICES_UNIQUEIDHANDLER_H
 #define SOCIAL_NETWORK_MICROSERVICES_UNIQUEIDHANDLER_H
 
-#include <chrono>
-#include <iomanip>
-#include <iostream>
-#include <mutex>
-#include <sstream>
 #include <string>
 
 #include "../../gen-cpp/UniqueIdService.h"
 #include "../../gen-cpp/social_network_types.h"
+#include "../UniqueIdGenerator.h"
 #include "../logger.h"
 #include "../tracing.h"
 
-// Custom Epoch (January 1, 2018 Midnight GMT = 2018-01-01T00:00:00Z)
-#define CUSTOM_EPOCH 1514764800000
-
 namespace social_network {
 
-using std::chrono::duration_cast;
-using std::chrono::milliseconds;
-using std::chrono::system_clock;
-
-static int64_t current_timestamp = -1;
-static int counter = 0;
-
-static int GetCounter(int64_t timestamp) {
-  if (current_timestamp > timestamp) {
-    LOG(fatal) << "Timestamps are not incremental.";
-    exit(EXIT_FAILURE);
-  }
-  if (current_timestamp == timestamp) {
-    return counter++;
-  } else {
-    current_timestamp = timestamp;
-    counter = 0;
-    return counter++;
-  }
-}
-
 class UniqueIdHandler : public UniqueIdServiceIf {
  public:
   ~UniqueIdHandler() override = default;
-  UniqueIdHandler(std::mutex *, const std::string &);
+  explicit UniqueIdHandler(const std::string &);
 
   int64_t ComposeUniqueId(int64_t, PostType::type,
                           const std::map<std::string, std::string> &) override;
+  int64_t ComposeUniqueIds(int64_t, int32_t,
+                           const std::map<std::string, std::string> &) override;
 
  private:
-  std::mutex *_thread_lock;
-  std::string _machine_id;
+  UniqueIdGenerator _generator;
 };
 
-UniqueIdHandler::UniqueIdHandler(std::mutex *thread_lock,
-                                 const std::string &machine_id) {
-  _thread_lock = thread_lock;
-  _machine_id = machine_id;
-}
+UniqueIdHandler::UniqueIdHandler(const std::string &machine_id)
+    : _generator(machine_id) {}
 
 int64_t UniqueIdHandler::ComposeUniqueId(
     int64_t req_id, PostType::type post_type,
@@ -70,89 +40,41 @@ int64_t UniqueIdHandler::ComposeUniqueId(
       "compose_unique_id_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  _thread_lock->lock();
-  int64_t timestamp =
-      duration_cast<milliseconds>(system_clock::now().time_since_epoch())
-          .count() -
-      CUSTOM_EPOCH;
-  int idx = GetCounter(timestamp);
-  _thread_lock->unlock();
-
-  std::stringstream sstream;
-  sstream << std::hex << timestamp;
-  std::string timestamp_hex(sstream.str());
-
-  if (timestamp_hex.size() > 10) {
-    timestamp_hex.erase(0, timestamp_hex.size() - 10);
-  } else if (timestamp_hex.size() < 10) {
-    timestamp_hex = std::string(10 - timestamp_hex.size(), '0') + timestamp_hex;
-  }
-
-  // Empty the sstream buffer.
-  sstream.clear();
-  sstream.str(std::string());
-
-  sstream << std::hex << idx;
-  std::string counter_hex(sstream.str());
-
-  if (counter_hex.size() > 3) {
-    counter_hex.erase(0, counter_hex.size() - 3);
-  } else if (counter_hex.size() < 3) {
-    counter_hex = std::string(3 - counter_hex.size(), '0') + counter_hex;
-  }
-  std::string post_id_str = _machine_id + timestamp_hex + counter_hex;
-  int64_t post_id = stoul(post_id_str, nullptr, 16) & 0x7FFFFFFFFFFFFFFF;
+  int64_t post_id = _generator.Next(1);
   LOG(debug) << "The post_id of the request " << req_id << " is " << post_id;
 
   span->Finish();
   return post_id;
 }
 
-/*
- * The following code which obtaines machine ID from machine's MAC address was
- * inspired from https://stackoverflow.com/a/16859693.
- *
- * MAC address is obtained from /sys/class/net/<netif>/address
- */
-u_int16_t HashMacAddressPid(const std::string &mac) {
-  u_int16_t hash = 0;
-  std::string mac_pid = mac + std::to_string(getpid());
-  for (unsigned int i = 0; i < mac_pid.size(); i++) {
-    hash += (mac[i] << ((i & 1) * 8));
-  }
-  return hash;
-}
-
-std::string GetMachineId(std::string &netif) {
-  std::string mac_hash;
+int64_t UniqueIdHandler::ComposeUniqueIds(
+    int64_t req_id, int32_t count,
+    const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "compose_unique_ids_server", {opentracing::ChildOf(parent_span->get())});
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  std::string mac_addr_filename = "/sys/class/net/" + netif + "/address";
-  std::ifstream mac_addr_file;
-  mac_addr_file.open(mac_addr_filename);
-  if (!mac_addr_file) {
-    LOG(fatal) << "Cannot read MAC address from net interface " << netif;
-    return "";
+  if (count < 1 || count > UniqueIdGenerator::kMaxCount) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_HANDLER_ERROR;
+    se.message = "Cannot lease " + std::to_string(count) +
+                 " unique ids, the limit is " +
+                 std::to_string(UniqueIdGenerator::kMaxCount);
+    LOG(error) << se.message;
+    span->Finish();
+    throw se;
   }
-  std::string mac;
-  mac_addr_file >> mac;
-  if (mac == "") {
-    LOG(fatal) << "Cannot read MAC address from net interface " << netif;
-    return "";
-  }
-  mac_addr_file.close();
-
-  LOG(info) << "MAC address = " << mac;
+  int64_t first_id = _generator.Next(count);
+  LOG(debug) << "The request " << req_id << " leased " << count
+             << " unique ids from " << first_id;
 
-  std::stringstream stream;
-  stream << std::hex << HashMacAddressPid(mac);
-  mac_hash = stream.str();
-
-  if (mac_hash.size() > 3) {
-    mac_hash.erase(0, mac_hash.size() - 3);
-  } else if (mac_hash.size() < 3) {
-    mac_hash = std::string(3 - mac_hash.size(), '0') + mac_hash;
-  }
-  return mac_hash;
+  span->Finish();
+  return first_id;
 }
 
 }  // namespace social_network
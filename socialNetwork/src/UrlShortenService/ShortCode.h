@@ -0,0 +1,73 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_SHORTCODE_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_SHORTCODE_H_
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace social_network {
+
+#define SHORT_CODE_CHARS \
+  "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+
+// wyrand from https://github.com/wangyi-fudan/wyhash: one add and one
+// 64x64->128 bit multiply per draw. Not cryptographic; short codes only need
+// to be unlikely to collide.
+class WyRand {
+ public:
+  explicit WyRand(uint64_t seed) : _state(seed) {}
+
+  uint64_t Next() {
+    _state += 0xa0761d6478bd642fULL;
+    __uint128_t m =
+        static_cast<__uint128_t>(_state) * (_state ^ 0xe7037ed1a0b428dbULL);
+    return static_cast<uint64_t>(m >> 64) ^ static_cast<uint64_t>(m);
+  }
+
+ private:
+  uint64_t _state;
+};
+
+// Each thread draws from its own generator, seeded once from
+// std::random_device, so generating a code takes no lock.
+WyRand &short_code_rng() {
+  thread_local WyRand rng([]() {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device();
+  }());
+  return rng;
+}
+
+/*
+ * Writes length uniformly random base62 characters to out.
+ *
+ * 62^10 < 2^64, so one 64-bit draw below the largest multiple of 62^10 gives
+ * ten characters, one per base62 digit. Draws above it are redrawn, which
+ * happens for about 4.5% of them, so the digits are uniform.
+ */
+void gen_short_code(char *out, int length) {
+  const uint64_t chunk_range = 839299365868340224ULL;  // 62^10
+  const uint64_t limit = UINT64_MAX - UINT64_MAX % chunk_range;
+  auto &rng = short_code_rng();
+  while (length > 0) {
+    uint64_t draw;
+    do {
+      draw = rng.Next();
+    } while (draw >= limit);
+    draw %= chunk_range;
+    for (int i = 0; i < 10 && length > 0; ++i, --length) {
+      *out++ = SHORT_CODE_CHARS[draw % 62];
+      draw /= 62;
+    }
+  }
+}
+
+std::string gen_short_code(int length) {
+  std::string code(length, '\0');
+  gen_short_code(&code[0], length);
+  return code;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_SHORTCODE_H_
@@ -0,0 +1,172 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SHORTURLFILTER_H
+#define SOCIAL_NETWORK_MICROSERVICES_SHORTURLFILTER_H
+
+#include <bson/bson.h>
+#include <mongoc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "../BloomFilter.h"
+#include "../logger.h"
+
+// ObjectIds of documents inserted by other replicas can be up to this much
+// older than the last scan when it runs, so each scan looks back this far.
+#define SHORT_URL_FILTER_OVERLAP_S 60
+
+namespace social_network {
+
+/*
+ * Bloom filter over the shortened urls stored in MongoDB, so lookups of urls
+ * that were never composed skip MongoDB.
+ *
+ * A background thread loads every shortened url once, then every refresh_s
+ * adds those with an ObjectId from the last scan onwards, which picks up urls
+ * composed by other url-shorten-service replicas. Urls composed here are
+ * added right away. Until the first load completes every url might exist.
+ */
+class ShortUrlFilter {
+ public:
+  ShortUrlFilter(mongoc_client_pool_t *mongodb_client_pool,
+                 size_t expected_urls, double false_positive_rate,
+                 int refresh_s);
+  ~ShortUrlFilter();
+
+  ShortUrlFilter(const ShortUrlFilter &) = delete;
+  ShortUrlFilter &operator=(const ShortUrlFilter &) = delete;
+
+  void Add(const std::string &shortened_url);
+  // False only if shortened_url was not in MongoDB at the last scan and has
+  // not been added since.
+  bool MightExist(const std::string &shortened_url) const;
+
+ private:
+  mongoc_client_pool_t *_mongodb_client_pool;
+  BloomFilter _filter;
+  std::chrono::seconds _refresh;
+  std::atomic<bool> _loaded;
+
+  std::mutex _mtx;
+  std::condition_variable _cv;
+  bool _stopped;
+  std::thread _thread;
+
+  void _Run();
+  // Adds the urls of documents with an ObjectId from since (unix seconds)
+  // onwards, or of all documents if since is 0.
+  bool _Scan(int64_t since, size_t *count);
+};
+
+ShortUrlFilter::ShortUrlFilter(mongoc_client_pool_t *mongodb_client_pool,
+                               size_t expected_urls,
+                               double false_positive_rate, int refresh_s)
+    : _filter(expected_urls, false_positive_rate) {
+  _mongodb_client_pool = mongodb_client_pool;
+  _refresh = std::chrono::seconds(std::max(refresh_s, 1));
+  _loaded = false;
+  _stopped = false;
+  LOG(info) << "Short url Bloom filter of " << _filter.NumBits() / 8
+            << " bytes, " << _filter.NumHashes() << " hashes";
+  _thread = std::thread(&ShortUrlFilter::_Run, this);
+}
+
+ShortUrlFilter::~ShortUrlFilter() {
+  {
+    std::unique_lock<std::mutex> lock(_mtx);
+    _stopped = true;
+  }
+  _cv.notify_one();
+  _thread.join();
+}
+
+void ShortUrlFilter::Add(const std::string &shortened_url) {
+  _filter.Add(shortened_url);
+}
+
+bool ShortUrlFilter::MightExist(const std::string &shortened_url) const {
+  return !_loaded.load() || _filter.MightContain(shortened_url);
+}
+
+void ShortUrlFilter::_Run() {
+  int64_t since = 0;
+  std::unique_lock<std::mutex> lock(_mtx);
+  while (!_stopped) {
+    lock.unlock();
+    int64_t scan_start = std::time(nullptr);
+    size_t count = 0;
+    if (_Scan(since, &count)) {
+      if (!_loaded.load()) {
+        LOG(info) << "Loaded " << count
+                  << " shortened urls into the Bloom filter";
+        _loaded = true;
+      }
+      since = scan_start - SHORT_URL_FILTER_OVERLAP_S;
+    }
+    lock.lock();
+    _cv.wait_for(lock, _refresh, [this] { return _stopped; });
+  }
+}
+
+bool ShortUrlFilter::_Scan(int64_t since, size_t *count) {
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    LOG(warning) << "Failed to pop a client from MongoDB pool";
+    return false;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "url-shorten", "url-shorten");
+
+  bson_t *query = bson_new();
+  if (since > 0) {
+    // An ObjectId starts with its creation time in big-endian seconds, so
+    // the smallest one of a second has that prefix and zeros after it.
+    uint8_t data[12] = {0};
+    for (int i = 0; i < 4; ++i) {
+      data[i] = static_cast<uint8_t>(static_cast<uint32_t>(since) >>
+                                     (8 * (3 - i)));
+    }
+    bson_oid_t oid;
+    bson_oid_init_from_data(&oid, data);
+    bson_t id_child;
+    BSON_APPEND_DOCUMENT_BEGIN(query, "_id", &id_child);
+    BSON_APPEND_OID(&id_child, "$gte", &oid);
+    bson_append_document_end(query, &id_child);
+  }
+  bson_t *opts = BCON_NEW("projection", "{", "shortened_url", BCON_BOOL(true),
+                          "_id", BCON_BOOL(false), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t iter;
+    if (bson_iter_init_find(&iter, doc, "shortened_url") &&
+        BSON_ITER_HOLDS_UTF8(&iter)) {
+      uint32_t length;
+      const char *shortened_url = bson_iter_utf8(&iter, &length);
+      _filter.Add(std::string(shortened_url, length));
+      (*count)++;
+    }
+  }
+  bson_error_t error;
+  bool ok = !mongoc_cursor_error(cursor, &error);
+  if (!ok) {
+    LOG(warning) << "Failed to scan shortened urls: " << error.message;
+  }
+  mongoc_cursor_destroy(cursor);
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  return ok;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SHORTURLFILTER_H
@@ -0,0 +1,235 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_URLCACHE_H
+#define SOCIAL_NETWORK_MICROSERVICES_URLCACHE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../logger.h"
+
+namespace social_network {
+
+struct UrlCacheStats {
+  uint64_t hits;
+  uint64_t negative_hits;
+  uint64_t misses;
+  uint64_t insertions;
+  uint64_t evictions;
+  uint64_t expirations;
+  size_t entries;
+  size_t bytes;
+};
+
+enum class UrlCacheResult { MISS, FOUND, MISSING };
+
+/*
+ * In-process cache of shortened url -> expanded url in front of Memcached,
+ * laid out like PostCache: shards picked by a hash of the shortened url, an
+ * LRU list per shard under its own mutex, and an equal part of the memory
+ * budget per shard.
+ *
+ * Urls that MongoDB does not have are cached as missing for negative_ttl_ms,
+ * usually much shorter than ttl_ms, so repeated lookups of a bogus url stay
+ * in process without hiding a url composed on another replica for long.
+ */
+class UrlCache {
+ public:
+  UrlCache(size_t budget_bytes, int ttl_ms, int negative_ttl_ms,
+           int num_shards);
+  ~UrlCache();
+
+  UrlCache(const UrlCache &) = delete;
+  UrlCache &operator=(const UrlCache &) = delete;
+
+  UrlCacheResult Get(const std::string &shortened_url,
+                     std::string &expanded_url);
+  void Put(const std::string &shortened_url, const std::string &expanded_url);
+  void PutMissing(const std::string &shortened_url);
+  UrlCacheStats GetStats();
+
+ private:
+  struct Entry {
+    std::string shortened_url;
+    std::string expanded_url;
+    bool missing;
+    size_t bytes;
+    std::chrono::steady_clock::time_point expires;
+  };
+  struct Shard {
+    std::mutex mtx;
+    std::list<Entry> lru;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    size_t bytes = 0;
+  };
+
+  std::vector<std::unique_ptr<Shard>> _shards;
+  size_t _shard_budget;
+  std::chrono::milliseconds _ttl;
+  std::chrono::milliseconds _negative_ttl;
+
+  std::atomic<uint64_t> _hits{};
+  std::atomic<uint64_t> _negative_hits{};
+  std::atomic<uint64_t> _misses{};
+  std::atomic<uint64_t> _insertions{};
+  std::atomic<uint64_t> _evictions{};
+  std::atomic<uint64_t> _expirations{};
+
+  std::mutex _report_mtx;
+  std::condition_variable _report_cv;
+  bool _stopped{};
+  std::thread _report_thread;
+
+  Shard &_ShardFor(const std::string &shortened_url);
+  void _Insert(Entry entry);
+  static void _Erase(Shard &shard, std::list<Entry>::iterator it);
+  void _Report();
+};
+
+UrlCache::UrlCache(size_t budget_bytes, int ttl_ms, int negative_ttl_ms,
+                   int num_shards) {
+  num_shards = std::max(num_shards, 1);
+  for (int i = 0; i < num_shards; ++i) {
+    _shards.emplace_back(new Shard());
+  }
+  _shard_budget = budget_bytes / num_shards;
+  _ttl = std::chrono::milliseconds(ttl_ms);
+  _negative_ttl = std::chrono::milliseconds(negative_ttl_ms);
+  _report_thread = std::thread(&UrlCache::_Report, this);
+}
+
+UrlCache::~UrlCache() {
+  {
+    std::unique_lock<std::mutex> lock(_report_mtx);
+    _stopped = true;
+  }
+  _report_cv.notify_one();
+  _report_thread.join();
+}
+
+UrlCacheResult UrlCache::Get(const std::string &shortened_url,
+                             std::string &expanded_url) {
+  auto &shard = _ShardFor(shortened_url);
+  std::unique_lock<std::mutex> lock(shard.mtx);
+  auto it = shard.index.find(shortened_url);
+  if (it == shard.index.end()) {
+    _misses++;
+    return UrlCacheResult::MISS;
+  }
+  if (std::chrono::steady_clock::now() >= it->second->expires) {
+    _Erase(shard, it->second);
+    _expirations++;
+    _misses++;
+    return UrlCacheResult::MISS;
+  }
+  shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+  if (it->second->missing) {
+    _negative_hits++;
+    return UrlCacheResult::MISSING;
+  }
+  _hits++;
+  expanded_url = it->second->expanded_url;
+  return UrlCacheResult::FOUND;
+}
+
+void UrlCache::Put(const std::string &shortened_url,
+                   const std::string &expanded_url) {
+  Entry entry;
+  entry.shortened_url = shortened_url;
+  entry.expanded_url = expanded_url;
+  entry.missing = false;
+  entry.expires = std::chrono::steady_clock::now() + _ttl;
+  _Insert(std::move(entry));
+}
+
+void UrlCache::PutMissing(const std::string &shortened_url) {
+  Entry entry;
+  entry.shortened_url = shortened_url;
+  entry.missing = true;
+  entry.expires = std::chrono::steady_clock::now() + _negative_ttl;
+  _Insert(std::move(entry));
+}
+
+void UrlCache::_Insert(Entry entry) {
+  // The key is stored twice, in the entry and in the index.
+  entry.bytes = sizeof(Entry) + 2 * entry.shortened_url.capacity() +
+                entry.expanded_url.capacity();
+  if (entry.bytes > _shard_budget) {
+    return;
+  }
+
+  auto &shard = _ShardFor(entry.shortened_url);
+  std::unique_lock<std::mutex> lock(shard.mtx);
+  auto it = shard.index.find(entry.shortened_url);
+  if (it != shard.index.end()) {
+    _Erase(shard, it->second);
+  }
+  while (shard.bytes + entry.bytes > _shard_budget) {
+    _Erase(shard, std::prev(shard.lru.end()));
+    _evictions++;
+  }
+  shard.bytes += entry.bytes;
+  shard.lru.emplace_front(std::move(entry));
+  shard.index[shard.lru.front().shortened_url] = shard.lru.begin();
+  _insertions++;
+}
+
+UrlCacheStats UrlCache::GetStats() {
+  UrlCacheStats stats{_hits.load(),       _negative_hits.load(),
+                      _misses.load(),     _insertions.load(),
+                      _evictions.load(),  _expirations.load(),
+                      0,                  0};
+  for (auto &shard : _shards) {
+    std::unique_lock<std::mutex> lock(shard->mtx);
+    stats.entries += shard->index.size();
+    stats.bytes += shard->bytes;
+  }
+  return stats;
+}
+
+UrlCache::Shard &UrlCache::_ShardFor(const std::string &shortened_url) {
+  uint64_t h = std::hash<std::string>()(shortened_url) * 0x9E3779B97F4A7C15ULL;
+  return *_shards[(h >> 32) % _shards.size()];
+}
+
+void UrlCache::_Erase(Shard &shard, std::list<Entry>::iterator it) {
+  shard.bytes -= it->bytes;
+  shard.index.erase(it->shortened_url);
+  shard.lru.erase(it);
+}
+
+void UrlCache::_Report() {
+  UrlCacheStats last{};
+  std::unique_lock<std::mutex> lock(_report_mtx);
+  while (!_report_cv.wait_for(lock, std::chrono::minutes(1),
+                              [this] { return _stopped; })) {
+    auto stats = GetStats();
+    uint64_t lookups = (stats.hits - last.hits) +
+                       (stats.negative_hits - last.negative_hits) +
+                       (stats.misses - last.misses);
+    if (lookups == 0) {
+      continue;
+    }
+    LOG(info) << "UrlCache hit ratio "
+              << double(lookups - (stats.misses - last.misses)) / lookups
+              << " hits " << stats.hits << " negative hits "
+              << stats.negative_hits << " misses " << stats.misses
+              << " insertions " << stats.insertions << " evictions "
+              << stats.evictions << " expirations " << stats.expirations
+              << " entries " << stats.entries << " bytes " << stats.bytes;
+    last = stats;
+  }
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_URLCACHE_H
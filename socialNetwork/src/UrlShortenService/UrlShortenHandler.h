@@ -1,11 +1,11 @@
 #ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_URLSHORTENHANDLER_H_
 #define SOCIAL_NETWORK_MICROSERVICES_SRC_URLSHORTENSERVICE_URLSHORTENHANDLER_H_
 
-#include <random>
 #include <chrono>
 #include <future>
-#include <regex>
-#include <nlohmann/json.hpp>
+#include <map>
+#include <string>
+#include <vector>
 
 #include <mongoc.h>
 #include <libmemcached/memcached.h>
@@ -14,40 +14,23 @@
 
 #include "../../gen-cpp/UrlShortenService.h"
 #include "../../gen-cpp/social_network_types.h"
+#include "../Executor.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "../wait_config.h"
+#include "ShortCode.h"
+#include "ShortUrlFilter.h"
+#include "UrlCache.h"
 
 #define HOSTNAME "http://short-url/"
 
 namespace social_network {
 
-std::chrono::seconds parse_duration(const std::string &str) {
-    // Regular expression to extract the number (assuming it's seconds)
-    std::regex regex("(\\d+)([smhd])");
-    std::smatch match;
-    
-    if (regex_match(str, match, regex)) {
-        int time_value = std::stoi(match[1].str());  // Extract the number
-        char time_unit = match[2].str()[0];          // Extract the time unit (s, m, h, d)
-
-        switch (time_unit) {
-            case 's':
-                return std::chrono::seconds(time_value);  // Return as seconds
-            case 'm':
-                return std::chrono::minutes(time_value);  // Return as minutes
-            case 'h':
-                return std::chrono::hours(time_value);    // Return as hours
-            case 'd':
-                return std::chrono::hours(time_value * 24);  // Return as days (converted to hours)
-        }
-    }
-
-    return std::chrono::seconds(0);  // Default to 0 if invalid input
-}
-
 class UrlShortenHandler : public UrlShortenServiceIf {
  public:
-  UrlShortenHandler(memcached_pool_st *, mongoc_client_pool_t *, std::mutex *);
+  UrlShortenHandler(memcached_pool_st *, memcached_pool_st *,
+                    mongoc_client_pool_t *, Executor *, UrlCache *,
+                    ShortUrlFilter *);
   ~UrlShortenHandler() override = default;
 
   void ComposeUrls(std::vector<Url> &, int64_t,
@@ -60,36 +43,44 @@ class UrlShortenHandler : public UrlShortenServiceIf {
 
  private:
   memcached_pool_st *_memcached_client_pool;
+  // From init_memcached_write_pool, used by _CacheUrls.
+  memcached_pool_st *_memcached_write_pool;
   mongoc_client_pool_t *_mongodb_client_pool;
-  static std::mt19937 _generator;
-  std::uniform_int_distribution<int> _distribution;
   std::string _GenRandomStr(int length);
-  std::mutex *_thread_lock;
+  Executor *_executor;
+  // In-process cache in front of Memcached, nullptr when disabled.
+  UrlCache *_url_cache;
+  // Bloom filter in front of MongoDB, nullptr when disabled.
+  ShortUrlFilter *_short_url_filter;
+  int _mongo_future_wait_slot =
+      WaitConfig::Global().Register("UrlShortenService-mongo_future");
+
+  void _MultiGetUrls(int64_t req_id, const std::vector<std::string> &keys,
+                     std::map<std::string, std::string> &expanded_urls,
+                     const opentracing::SpanContext &span_context);
+  void _FindUrls(const std::vector<std::string> &shortened_urls,
+                 std::map<std::string, std::string> &expanded_urls,
+                 const opentracing::SpanContext &span_context);
+  void _CacheUrls(const std::map<std::string, std::string> &expanded_urls);
 };
 
-std::mt19937 UrlShortenHandler::_generator = std::mt19937(std::chrono::duration_cast<std::chrono::milliseconds>(
-          std::chrono::system_clock::now().time_since_epoch()).count() % 0xffffffff);
-
 UrlShortenHandler::UrlShortenHandler(
     memcached_pool_st *memcached_client_pool,
+    memcached_pool_st *memcached_write_pool,
     mongoc_client_pool_t *mongodb_client_pool,
-    std::mutex *thread_lock) {
+    Executor *executor,
+    UrlCache *url_cache,
+    ShortUrlFilter *short_url_filter) {
   _memcached_client_pool = memcached_client_pool;
+  _memcached_write_pool = memcached_write_pool;
   _mongodb_client_pool = mongodb_client_pool;
-  _thread_lock = thread_lock;
-  _distribution = std::uniform_int_distribution<int>(0, 61);
+  _executor = executor;
+  _url_cache = url_cache;
+  _short_url_filter = short_url_filter;
 }
 
 std::string UrlShortenHandler::_GenRandomStr(int length) {
-  const char char_map[] = "abcdefghijklmnopqrstuvwxyzABCDEF"
-                    "GHIJKLMNOPQRSTUVWXYZ0123456789";
-  std::string return_str;
-  _thread_lock->lock();
-  for (int i = 0; i < length; ++i) {
-    return_str.append(1, char_map[_distribution(_generator)]);
-  }
-  _thread_lock->unlock();
-  return return_str;
+  return gen_short_code(length);
 }
 void UrlShortenHandler::ComposeUrls(
     std::vector<Url> &_return,
@@ -108,7 +99,7 @@ void UrlShortenHandler::ComposeUrls(
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
   std::vector<Url> target_urls;
-  std::future<void> mongo_future;
+  Future<void> mongo_future;
 
   if (!urls.empty()) {
     for (auto &url : urls) {
@@ -119,14 +110,10 @@ void UrlShortenHandler::ComposeUrls(
       target_urls.emplace_back(new_target_url);
     }
 
-    std::ifstream times_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/wait_times.json");
-    nlohmann::json times;
-    times_file >> times;
 
     // Handle mongo_future
     std::future_status mongo_future_status;
-    mongo_future = std::async(
-        std::launch::async, [&](){
+    mongo_future = _executor->Submit([&]() {
           mongoc_client_t *mongodb_client = mongoc_client_pool_pop(
               _mongodb_client_pool);
           if (!mongodb_client) {
@@ -182,7 +169,7 @@ void UrlShortenHandler::ComposeUrls(
           mongo_span->Finish();
         });
     do {
-        switch (mongo_future_status = mongo_future.wait_for(parse_duration(times["UrlShortenService-mongo_future"]["time"]))) {
+        switch (mongo_future_status = mongo_future.wait_for(WaitConfig::Global().Get(_mongo_future_wait_slot))) {
             case std::future_status::deferred:
                 break;
             case std::future_status::timeout:
@@ -202,6 +189,20 @@ void UrlShortenHandler::ComposeUrls(
       LOG(error) << "Failed to upload shortened urls from MongoDB";
       throw;
     }
+
+    std::map<std::string, std::string> expanded_urls;
+    for (auto &url : target_urls) {
+      expanded_urls.emplace(url.shortened_url, url.expanded_url);
+      if (_url_cache) {
+        _url_cache->Put(url.shortened_url, url.expanded_url);
+      }
+      if (_short_url_filter) {
+        _short_url_filter->Add(url.shortened_url);
+      }
+    }
+    // Write through to Memcached, so other replicas find the urls there
+    // before their Bloom filters pick them up. Done off the request path.
+    _executor->Post([this, expanded_urls]() { _CacheUrls(expanded_urls); });
   }
 
   _return = target_urls;
@@ -209,15 +210,294 @@ void UrlShortenHandler::ComposeUrls(
 
 }
 
+// Expands each shortened url, or returns "" for it if it was never
+// composed. Lookups go through the in-process cache, one Memcached mget and
+// then one MongoDB query; the Bloom filter keeps urls MongoDB cannot have
+// away from it. It is only consulted after Memcached, since urls composed on
+// another replica reach Memcached before this replica's filter.
 void UrlShortenHandler::GetExtendedUrls(
     std::vector<std::string> &_return,
     int64_t req_id,
-    const std::vector<std::string> &shortened_id,
+    const std::vector<std::string> &shortened_urls,
     const std::map<std::string, std::string> &carrier) {
 
-  // TODO: Implement GetExtendedUrls
+  // Initialize a span
+  TextMapReader reader(carrier);
+  std::map<std::string, std::string> writer_text_map;
+  TextMapWriter writer(writer_text_map);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "get_extended_urls_server",
+      { opentracing::ChildOf(parent_span->get()) });
+  opentracing::Tracer::Global()->Inject(span->context(), writer);
+
+  std::map<std::string, std::string> expanded_urls;
+  std::vector<std::string> not_cached;
+  for (auto &shortened_url : shortened_urls) {
+    if (expanded_urls.count(shortened_url)) {
+      continue;
+    }
+    std::string expanded_url;
+    auto result = _url_cache ? _url_cache->Get(shortened_url, expanded_url)
+                             : UrlCacheResult::MISS;
+    if (result == UrlCacheResult::MISS) {
+      not_cached.emplace_back(shortened_url);
+    }
+    // Missing urls map to "".
+    expanded_urls.emplace(shortened_url, expanded_url);
+  }
+
+  if (!not_cached.empty()) {
+    std::map<std::string, std::string> found_urls;
+    _MultiGetUrls(req_id, not_cached, found_urls, span->context());
+
+    std::vector<std::string> not_found;
+    for (auto &shortened_url : not_cached) {
+      auto it = found_urls.find(shortened_url);
+      if (it != found_urls.end()) {
+        expanded_urls[shortened_url] = it->second;
+        if (_url_cache) {
+          _url_cache->Put(shortened_url, it->second);
+        }
+      } else if (_short_url_filter &&
+                 !_short_url_filter->MightExist(shortened_url)) {
+        if (_url_cache) {
+          _url_cache->PutMissing(shortened_url);
+        }
+      } else {
+        not_found.emplace_back(shortened_url);
+      }
+    }
+
+    if (!not_found.empty()) {
+      std::map<std::string, std::string> mongo_urls;
+      _FindUrls(not_found, mongo_urls, span->context());
+      for (auto &shortened_url : not_found) {
+        auto it = mongo_urls.find(shortened_url);
+        if (it != mongo_urls.end()) {
+          expanded_urls[shortened_url] = it->second;
+          if (_url_cache) {
+            _url_cache->Put(shortened_url, it->second);
+          }
+        } else if (_url_cache) {
+          _url_cache->PutMissing(shortened_url);
+        }
+      }
+      if (!mongo_urls.empty()) {
+        // Fill the cache off the request path.
+        _executor->Post([this, mongo_urls]() { _CacheUrls(mongo_urls); });
+      }
+    }
+  }
+
+  _return.clear();
+  _return.reserve(shortened_urls.size());
+  for (auto &shortened_url : shortened_urls) {
+    _return.emplace_back(expanded_urls[shortened_url]);
+  }
+  span->Finish();
+}
+
+void UrlShortenHandler::_MultiGetUrls(
+    int64_t req_id, const std::vector<std::string> &keys,
+    std::map<std::string, std::string> &expanded_urls,
+    const opentracing::SpanContext &span_context) {
+  // Strings that cannot be Memcached keys were never stored under one.
+  std::vector<const char *> valid_keys;
+  std::vector<size_t> key_sizes;
+  for (auto &key : keys) {
+    bool valid = !key.empty() && key.size() < MEMCACHED_MAX_KEY;
+    for (char c : key) {
+      valid = valid && c > ' ' && c != 0x7f;
+    }
+    if (valid) {
+      valid_keys.emplace_back(key.c_str());
+      key_sizes.emplace_back(key.size());
+    }
+  }
+  if (valid_keys.empty()) {
+    return;
+  }
+
+  memcached_return_t memcached_rc;
+  auto memcached_client =
+      memcached_pool_pop(_memcached_client_pool, true, &memcached_rc);
+  if (!memcached_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
+    se.message = "Failed to pop a client from memcached pool";
+    throw se;
+  }
+
+  auto get_span = opentracing::Tracer::Global()->StartSpan(
+      "url_mmc_mget_client", {opentracing::ChildOf(&span_context)});
+  memcached_rc = memcached_mget(memcached_client, valid_keys.data(),
+                                key_sizes.data(), valid_keys.size());
+  if (memcached_rc != MEMCACHED_SUCCESS) {
+    LOG(error) << "Cannot get urls of request " << req_id << ": "
+               << memcached_strerror(memcached_client, memcached_rc);
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
+    se.message = memcached_strerror(memcached_client, memcached_rc);
+    memcached_pool_push(_memcached_client_pool, memcached_client);
+    get_span->Finish();
+    throw se;
+  }
+
+  char return_key[MEMCACHED_MAX_KEY];
+  size_t return_key_length;
+  char *return_value;
+  size_t return_value_length;
+  uint32_t flags;
+  while (true) {
+    return_value =
+        memcached_fetch(memcached_client, return_key, &return_key_length,
+                        &return_value_length, &flags, &memcached_rc);
+    if (return_value == nullptr) {
+      LOG(debug) << "Memcached mget finished";
+      break;
+    }
+    if (memcached_rc != MEMCACHED_SUCCESS) {
+      free(return_value);
+      memcached_quit(memcached_client);
+      memcached_pool_push(_memcached_client_pool, memcached_client);
+      LOG(error) << "Cannot get urls of request " << req_id;
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_MEMCACHED_ERROR;
+      se.message = "Cannot get urls of request " + std::to_string(req_id);
+      get_span->Finish();
+      throw se;
+    }
+    expanded_urls.emplace(
+        std::string(return_key, return_key_length),
+        std::string(return_value, return_value + return_value_length));
+    free(return_value);
+  }
+  get_span->Finish();
+  memcached_quit(memcached_client);
+  memcached_pool_push(_memcached_client_pool, memcached_client);
 }
 
+void UrlShortenHandler::_FindUrls(
+    const std::vector<std::string> &shortened_urls,
+    std::map<std::string, std::string> &expanded_urls,
+    const opentracing::SpanContext &span_context) {
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "url-shorten", "url-shorten");
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection url-shorten from DB url-shorten";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  bson_t *query = bson_new();
+  bson_t query_child;
+  bson_t query_url_list;
+  const char *key;
+  char buf[16];
+  BSON_APPEND_DOCUMENT_BEGIN(query, "shortened_url", &query_child);
+  BSON_APPEND_ARRAY_BEGIN(&query_child, "$in", &query_url_list);
+  for (uint32_t i = 0; i < shortened_urls.size(); ++i) {
+    bson_uint32_to_string(i, &key, buf, sizeof buf);
+    BSON_APPEND_UTF8(&query_url_list, key, shortened_urls[i].c_str());
+  }
+  bson_append_array_end(&query_child, &query_url_list);
+  bson_append_document_end(query, &query_child);
+  bson_t *opts = BCON_NEW("projection", "{", "shortened_url", BCON_BOOL(true),
+                          "expanded_url", BCON_BOOL(true), "_id",
+                          BCON_BOOL(false), "}");
+
+  auto find_span = opentracing::Tracer::Global()->StartSpan(
+      "url_mongo_find_client", {opentracing::ChildOf(&span_context)});
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  while (mongoc_cursor_next(cursor, &doc)) {
+    bson_iter_t shortened_iter;
+    bson_iter_t expanded_iter;
+    if (!bson_iter_init_find(&shortened_iter, doc, "shortened_url") ||
+        !BSON_ITER_HOLDS_UTF8(&shortened_iter) ||
+        !bson_iter_init_find(&expanded_iter, doc, "expanded_url") ||
+        !BSON_ITER_HOLDS_UTF8(&expanded_iter)) {
+      ServiceException se;
+      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+      se.message = "Attribute of MongoDB item is not complete";
+      mongoc_cursor_destroy(cursor);
+      bson_destroy(opts);
+      bson_destroy(query);
+      mongoc_collection_destroy(collection);
+      mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+      find_span->Finish();
+      throw se;
+    }
+    uint32_t shortened_length, expanded_length;
+    const char *shortened_url =
+        bson_iter_utf8(&shortened_iter, &shortened_length);
+    const char *expanded_url = bson_iter_utf8(&expanded_iter, &expanded_length);
+    expanded_urls.emplace(std::string(shortened_url, shortened_length),
+                          std::string(expanded_url, expanded_length));
+  }
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    LOG(error) << "MongoDB error: " << error.message;
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = error.message;
+    mongoc_cursor_destroy(cursor);
+    bson_destroy(opts);
+    bson_destroy(query);
+    mongoc_collection_destroy(collection);
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    find_span->Finish();
+    throw se;
+  }
+  mongoc_cursor_destroy(cursor);
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+  find_span->Finish();
+}
+
+void UrlShortenHandler::_CacheUrls(
+    const std::map<std::string, std::string> &expanded_urls) {
+  memcached_return_t memcached_rc;
+  auto memcached_client =
+      memcached_pool_pop(_memcached_write_pool, true, &memcached_rc);
+  if (!memcached_client) {
+    LOG(warning) << "Failed to pop a client from memcached write pool";
+    return;
+  }
+  // The sets are buffered without waiting for replies and sent in one flush,
+  // instead of a round trip per url.
+  for (auto &it : expanded_urls) {
+    memcached_rc = memcached_set(
+        memcached_client, it.first.c_str(), it.first.length(),
+        it.second.c_str(), it.second.length(), static_cast<time_t>(0),
+        static_cast<uint32_t>(0));
+    if (memcached_rc != MEMCACHED_SUCCESS &&
+        memcached_rc != MEMCACHED_BUFFERED) {
+      LOG(warning) << "Failed to set url to Memcached: "
+                   << memcached_strerror(memcached_client, memcached_rc);
+    }
+  }
+  memcached_rc = memcached_flush_buffers(memcached_client);
+  if (memcached_rc != MEMCACHED_SUCCESS) {
+    LOG(warning) << "Failed to flush urls to Memcached: "
+                 << memcached_strerror(memcached_client, memcached_rc);
+  }
+  memcached_pool_push(_memcached_write_pool, memcached_client);
+}
 }
 
 
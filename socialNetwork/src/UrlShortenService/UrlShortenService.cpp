@@ -1,8 +1,6 @@
 #include <signal.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
+
+#include <memory>
 
 #include "../utils.h"
 #include "../utils_memcached.h"
@@ -11,24 +9,25 @@
 #include "UrlShortenHandler.h"
 #include "nlohmann/json.hpp"
 
-using apache::thrift::protocol::TBinaryProtocolFactory;
-using apache::thrift::server::TThreadedServer;
-using apache::thrift::transport::TFramedTransportFactory;
-using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
 static memcached_pool_st* memcached_client_pool;
+static memcached_pool_st* memcached_write_pool;
 static mongoc_client_pool_t* mongodb_client_pool;
 
 void sigintHandler(int sig) {
   if (memcached_client_pool != nullptr) {
     memcached_pool_destroy(memcached_client_pool);
   }
+  if (memcached_write_pool != nullptr) {
+    memcached_pool_destroy(memcached_write_pool);
+  }
   if (mongodb_client_pool != nullptr) {
     mongoc_client_pool_destroy(mongodb_client_pool);
   }
   exit(EXIT_SUCCESS);
 }
+
 int main(int argc, char* argv[]) {
   signal(SIGINT, sigintHandler);
   init_logger();
@@ -39,6 +38,20 @@ int main(int argc, char* argv[]) {
   }
   int port = config_json["url-shorten-service"]["port"];
 
+  std::string wait_times_path = config_json["url-shorten-service"].value(
+      "wait_times_path", DEFAULT_WAIT_TIMES_PATH);
+  int wait_times_poll_ms =
+      config_json["url-shorten-service"].value("wait_times_poll_ms", 1000);
+  WaitConfig::Global().Load(wait_times_path);
+  WaitConfig::Global().Start(wait_times_poll_ms);
+  InstallSighupReload();
+
+  int executor_threads =
+      config_json["url-shorten-service"].value("executor_threads", 64);
+  int executor_max_queued =
+      config_json["url-shorten-service"].value("executor_max_queued", 0);
+  Executor executor("url-shorten-service", executor_threads, executor_max_queued);
+
   int mongodb_conns = config_json["url-shorten-mongodb"]["connections"];
   int mongodb_timeout = config_json["url-shorten-mongodb"]["timeout_ms"];
 
@@ -47,9 +60,14 @@ int main(int argc, char* argv[]) {
 
   memcached_client_pool = init_memcached_client_pool(config_json, "url-shorten",
                                                      32, memcached_conns);
+  // Cache fills run on the executor, so this pool only grows to as many
+  // clients as it has threads.
+  memcached_write_pool = init_memcached_write_pool(config_json, "url-shorten",
+                                                   1, memcached_conns);
   mongodb_client_pool =
       init_mongodb_client_pool(config_json, "url-shorten", mongodb_conns);
-  if (memcached_client_pool == nullptr || mongodb_client_pool == nullptr) {
+  if (memcached_client_pool == nullptr || memcached_write_pool == nullptr ||
+      mongodb_client_pool == nullptr) {
     return EXIT_FAILURE;
   }
 
@@ -68,16 +86,42 @@ int main(int argc, char* argv[]) {
   }
   mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
 
-  std::mutex thread_lock;
-  std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
-  TThreadedServer server(
+  auto &url_shorten_config = config_json["url-shorten-service"];
+  int url_cache_mb = url_shorten_config.value("url_cache_mb", 0);
+  int url_cache_ttl_ms = url_shorten_config.value("url_cache_ttl_ms", 60000);
+  int url_cache_negative_ttl_ms =
+      url_shorten_config.value("url_cache_negative_ttl_ms", 5000);
+  int url_cache_shards = url_shorten_config.value("url_cache_shards", 16);
+  std::unique_ptr<UrlCache> url_cache;
+  if (url_cache_mb > 0) {
+    url_cache.reset(new UrlCache(size_t(url_cache_mb) << 20, url_cache_ttl_ms,
+                                 url_cache_negative_ttl_ms, url_cache_shards));
+    LOG(info) << "In-process url cache of " << url_cache_mb << " MB";
+  }
+
+  // Sized for url_bloom_filter_items shortened urls; 0 disables the filter.
+  int64_t url_bloom_filter_items =
+      url_shorten_config.value("url_bloom_filter_items", int64_t(0));
+  double url_bloom_filter_fp_rate =
+      url_shorten_config.value("url_bloom_filter_fp_rate", 0.01);
+  int url_bloom_filter_refresh_s =
+      url_shorten_config.value("url_bloom_filter_refresh_s", 60);
+  std::unique_ptr<ShortUrlFilter> short_url_filter;
+  if (url_bloom_filter_items > 0) {
+    short_url_filter.reset(new ShortUrlFilter(
+        mongodb_client_pool, url_bloom_filter_items, url_bloom_filter_fp_rate,
+        url_bloom_filter_refresh_s));
+  }
+
+  auto server = get_server(
+      config_json, "url-shorten-service",
       std::make_shared<UrlShortenServiceProcessor>(
           std::make_shared<UrlShortenHandler>(
-              memcached_client_pool, mongodb_client_pool, &thread_lock)),
-      server_socket,
-      std::make_shared<TFramedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
+              memcached_client_pool, memcached_write_pool,
+              mongodb_client_pool, &executor, url_cache.get(),
+              short_url_filter.get())),
+      "0.0.0.0", port);
 
   LOG(info) << "Starting the url-shorten-service server...";
-  server.serve();
+  server->serve();
 }
\ No newline at end of file
@@ -19,11 +19,10 @@
 #include "../../third_party/PicoSHA2/picosha2.h"
 #include "../ClientPool.h"
 #include "../ThriftClient.h"
+#include "../UniqueIdGenerator.h"
 #include "../logger.h"
 #include "../tracing.h"
 
-// Custom Epoch (January 1, 2018 Midnight GMT = 2018-01-01T00:00:00Z)
-#define CUSTOM_EPOCH 1514764800000
 #define MONGODB_TIMEOUT_MS 100
 
 namespace social_network {
@@ -896,52 +895,6 @@ int64_t UserHandler::GetUserId(
   return user_id;
 }
 
-/*
- * The following code which obtaines machine ID from machine's MAC address was
- * inspired from https://stackoverflow.com/a/16859693.
- *
- * MAC address is obtained from /sys/class/net/<netif>/address
- */
-u_int16_t HashMacAddressPid(const std::string &mac) {
-  u_int16_t hash = 0;
-  std::string mac_pid = mac + std::to_string(getpid());
-  for (unsigned int i = 0; i < mac_pid.size(); i++) {
-    hash += (mac[i] << ((i & 1) * 8));
-  }
-  return hash;
-}
-
-std::string GetMachineId(std::string &netif) {
-  std::string mac_hash;
-
-  std::string mac_addr_filename = "/sys/class/net/" + netif + "/address";
-  std::ifstream mac_addr_file;
-  mac_addr_file.open(mac_addr_filename);
-  if (!mac_addr_file) {
-    LOG(fatal) << "Cannot read MAC address from net interface " << netif;
-    return "";
-  }
-  std::string mac;
-  mac_addr_file >> mac;
-  if (mac == "") {
-    LOG(fatal) << "Cannot read MAC address from net interface " << netif;
-    return "";
-  }
-  mac_addr_file.close();
-
-  LOG(info) << "MAC address = " << mac;
-
-  std::stringstream stream;
-  stream << std::hex << HashMacAddressPid(mac);
-  mac_hash = stream.str();
-
-  if (mac_hash.size() > 3) {
-    mac_hash.erase(0, mac_hash.size() - 3);
-  } else if (mac_hash.size() < 3) {
-    mac_hash = std::string(3 - mac_hash.size(), '0') + mac_hash;
-  }
-  return mac_hash;
-}
 }  // namespace social_network
 
 #endif  // SOCIAL_NETWORK_MICROSERVICES_USERHANDLER_H
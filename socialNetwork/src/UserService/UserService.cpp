@@ -1,8 +1,4 @@
 #include <signal.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include "../utils.h"
 #include "../utils_memcached.h"
@@ -10,10 +6,6 @@
 #include "../utils_thrift.h"
 #include "UserHandler.h"
 
-using apache::thrift::protocol::TBinaryProtocolFactory;
-using apache::thrift::server::TThreadedServer;
-using apache::thrift::transport::TFramedTransportFactory;
-using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
 void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
@@ -36,6 +28,8 @@ int main(int argc, char *argv[]) {
   std::string social_graph_addr = config_json["social-graph-service"]["addr"];
   int social_graph_port = config_json["social-graph-service"]["port"];
   int social_graph_conns = config_json["social-graph-service"]["connections"];
+  int social_graph_min_conns =
+      config_json["social-graph-service"].value("min_connections", 0);
   int social_graph_timeout = config_json["social-graph-service"]["timeout_ms"];
   int social_graph_keepalive =
       config_json["social-graph-service"]["keepalive_ms"];
@@ -65,8 +59,9 @@ int main(int argc, char *argv[]) {
   std::mutex thread_lock;
 
   ClientPool<ThriftClient<SocialGraphServiceClient>> social_graph_client_pool(
-      "social-graph", social_graph_addr, social_graph_port, 0,
-      social_graph_conns, social_graph_timeout, social_graph_keepalive, config_json);
+      "social-graph", social_graph_addr, social_graph_port,
+      social_graph_min_conns, social_graph_conns, social_graph_timeout,
+      social_graph_keepalive, config_json);
 
   mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
   if (!mongodb_client) {
@@ -82,15 +77,13 @@ int main(int argc, char *argv[]) {
     }
   }
   mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
-  std::shared_ptr<TServerSocket> server_socket = get_server_socket(config_json, "0.0.0.0", port);
 
-  TThreadedServer server(
+  auto server = get_server(
+      config_json, "user-service",
       std::make_shared<UserServiceProcessor>(std::make_shared<UserHandler>(
           &thread_lock, machine_id, secret, memcached_client_pool,
           mongodb_client_pool, &social_graph_client_pool)),
-      server_socket,
-      std::make_shared<TFramedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
+      "0.0.0.0", port);
   LOG(info) << "Starting the user-service server ...";
-  server.serve();
+  server->serve();
 }
\ No newline at end of file
@@ -4,58 +4,42 @@
 #include <bson/bson.h>
 #include <mongoc.h>
 #include <sw/redis++/redis++.h>
-#include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <future>
 #include <iostream>
 #include <string>
-#include <regex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "../../gen-cpp/PostStorageService.h"
 #include "../../gen-cpp/UserTimelineService.h"
 #include "../ClientPool.h"
+#include "../Executor.h"
+#include "../bson_codec.h"
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
+#include "../wait_config.h"
 
 using namespace sw::redis;
 
 namespace social_network {
 
-std::chrono::seconds parse_duration(const std::string &str) {
-    // Regular expression to extract the number (assuming it's seconds)
-    std::regex regex("(\\d+)([smhd])");
-    std::smatch match;
-    
-    if (regex_match(str, match, regex)) {
-        int time_value = std::stoi(match[1].str());  // Extract the number
-        char time_unit = match[2].str()[0];          // Extract the time unit (s, m, h, d)
-
-        switch (time_unit) {
-            case 's':
-                return std::chrono::seconds(time_value);  // Return as seconds
-            case 'm':
-                return std::chrono::minutes(time_value);  // Return as minutes
-            case 'h':
-                return std::chrono::hours(time_value);    // Return as hours
-            case 'd':
-                return std::chrono::hours(time_value * 24);  // Return as days (converted to hours)
-        }
-    }
-
-    return std::chrono::seconds(0);  // Default to 0 if invalid input
-}
-
 class UserTimelineHandler : public UserTimelineServiceIf {
  public:
   UserTimelineHandler(Redis *, mongoc_client_pool_t *,
-                      ClientPool<ThriftClient<PostStorageServiceClient>> *);
+                      ClientPool<ThriftClient<PostStorageServiceClient>> *,
+                      Executor *, int64_t, int64_t);
 
   UserTimelineHandler(Redis *, Redis *, mongoc_client_pool_t *,
-      ClientPool<ThriftClient<PostStorageServiceClient>> *);
+      ClientPool<ThriftClient<PostStorageServiceClient>> *, Executor *,
+      int64_t, int64_t);
 
   UserTimelineHandler(RedisCluster *, mongoc_client_pool_t *,
-                      ClientPool<ThriftClient<PostStorageServiceClient>> *);
+                      ClientPool<ThriftClient<PostStorageServiceClient>> *,
+                      Executor *, int64_t, int64_t);
   ~UserTimelineHandler() override = default;
 
   bool IsRedisReplicationEnabled();
@@ -67,6 +51,10 @@ class UserTimelineHandler : public UserTimelineServiceIf {
   void ReadUserTimeline(std::vector<Post> &, int64_t, int64_t, int, int,
                         const std::map<std::string, std::string> &) override;
 
+  void ReadUserTimelineEntries(
+      std::map<int64_t, int64_t> &, int64_t, int64_t, int, int,
+      const std::map<std::string, std::string> &) override;
+
  private:
   Redis *_redis_client_pool;
   Redis *_redis_replica_pool;
@@ -74,45 +62,83 @@ class UserTimelineHandler : public UserTimelineServiceIf {
   RedisCluster *_redis_cluster_client_pool;
   mongoc_client_pool_t *_mongodb_client_pool;
   ClientPool<ThriftClient<PostStorageServiceClient>> *_post_client_pool;
+  Executor *_executor;
+  // Each timeline keeps only its newest _max_timeline_len posts in MongoDB
+  // and Redis. 0 keeps every post.
+  int64_t _max_timeline_len;
+  // With _bucket_ms > 0 posts are stored in the "user-timeline-buckets"
+  // collection, one document per (user_id, bucket), where bucket is the start
+  // of the _bucket_ms long period holding the post's timestamp. 0 keeps one
+  // document per user in "user-timeline". With _max_timeline_len > 0 a bucket
+  // holds at most _max_timeline_len posts, and when a post opens a new bucket
+  // the buckets that only hold older posts are deleted.
+  int64_t _bucket_ms;
+  int _post_future_wait_slot =
+      WaitConfig::Global().Register("UserTimelineService-post_future");
+
+  const char *_MongoCollection() const;
+  void _ReadEntries(int64_t, int, int, opentracing::Span *,
+                    std::vector<std::pair<int64_t, int64_t>> *);
+  void _FindPosts(mongoc_collection_t *, int64_t, int,
+                  std::vector<std::pair<int64_t, int64_t>> *);
+  void _FindBucketedPosts(mongoc_collection_t *, int64_t, int,
+                          std::vector<std::pair<int64_t, int64_t>> *);
+  void _TrimBuckets(mongoc_collection_t *, int64_t);
 };
 
 UserTimelineHandler::UserTimelineHandler(
     Redis *redis_pool, mongoc_client_pool_t *mongodb_pool,
-    ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool) {
+    ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool,
+    Executor *executor, int64_t max_timeline_len, int64_t bucket_ms) {
   _redis_client_pool = redis_pool;
   _redis_replica_pool = nullptr;
   _redis_primary_pool = nullptr;
   _redis_cluster_client_pool = nullptr;
   _mongodb_client_pool = mongodb_pool;
   _post_client_pool = post_client_pool;
+  _executor = executor;
+  _max_timeline_len = max_timeline_len;
+  _bucket_ms = bucket_ms;
 }
 
 UserTimelineHandler::UserTimelineHandler(
     Redis* redis_replica_pool, Redis* redis_primary_pool, mongoc_client_pool_t* mongodb_pool,
-    ClientPool<ThriftClient<PostStorageServiceClient>>* post_client_pool) {
+    ClientPool<ThriftClient<PostStorageServiceClient>>* post_client_pool,
+    Executor* executor, int64_t max_timeline_len, int64_t bucket_ms) {
     _redis_client_pool = nullptr;
     _redis_replica_pool = redis_replica_pool;
     _redis_primary_pool = redis_primary_pool;
     _redis_cluster_client_pool = nullptr;
     _mongodb_client_pool = mongodb_pool;
     _post_client_pool = post_client_pool;
+    _executor = executor;
+    _max_timeline_len = max_timeline_len;
+    _bucket_ms = bucket_ms;
 }
 
 UserTimelineHandler::UserTimelineHandler(
     RedisCluster *redis_pool, mongoc_client_pool_t *mongodb_pool,
-    ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool) {
+    ClientPool<ThriftClient<PostStorageServiceClient>> *post_client_pool,
+    Executor *executor, int64_t max_timeline_len, int64_t bucket_ms) {
   _redis_cluster_client_pool = redis_pool;
   _redis_replica_pool = nullptr;
   _redis_primary_pool = nullptr;
   _redis_client_pool = nullptr;
   _mongodb_client_pool = mongodb_pool;
   _post_client_pool = post_client_pool;
+  _executor = executor;
+  _max_timeline_len = max_timeline_len;
+  _bucket_ms = bucket_ms;
 }
 
 bool UserTimelineHandler::IsRedisReplicationEnabled() {
     return (_redis_primary_pool || _redis_replica_pool);
 }
 
+const char *UserTimelineHandler::_MongoCollection() const {
+  return _bucket_ms > 0 ? "user-timeline-buckets" : "user-timeline";
+}
+
 void UserTimelineHandler::WriteUserTimeline(
     int64_t req_id, int64_t post_id, int64_t user_id, int64_t timestamp,
     const std::map<std::string, std::string> &carrier) {
@@ -134,7 +160,7 @@ void UserTimelineHandler::WriteUserTimeline(
     throw se;
   }
   auto collection = mongoc_client_get_collection(
-      mongodb_client, "user-timeline", "user-timeline");
+      mongodb_client, "user-timeline", _MongoCollection());
   if (!collection) {
     ServiceException se;
     se.errorCode = ErrorCode::SE_MONGODB_ERROR;
@@ -145,10 +171,27 @@ void UserTimelineHandler::WriteUserTimeline(
   bson_t *query = bson_new();
 
   BSON_APPEND_INT64(query, "user_id", user_id);
-  bson_t *update =
-      BCON_NEW("$push", "{", "posts", "{", "$each", "[", "{", "post_id",
-               BCON_INT64(post_id), "timestamp", BCON_INT64(timestamp), "}",
-               "]", "$position", BCON_INT32(0), "}", "}");
+  if (_bucket_ms > 0) {
+    BSON_APPEND_INT64(query, "bucket", timestamp - timestamp % _bucket_ms);
+  }
+  bson_t *update;
+  if (_max_timeline_len > 0 && _bucket_ms == 0) {
+    // Posts are kept newest first, so $slice drops the oldest ones.
+    update = BCON_NEW("$push", "{", "posts", "{", "$each", "[", "{", "post_id",
+                      BCON_INT64(post_id), "timestamp", BCON_INT64(timestamp),
+                      "}", "]", "$position", BCON_INT32(0), "$slice",
+                      BCON_INT64(_max_timeline_len), "}", "}");
+  } else if (_max_timeline_len > 0) {
+    // Posts of a bucket can arrive out of order, so sort before slicing.
+    update = BCON_NEW("$push", "{", "posts", "{", "$each", "[", "{", "post_id",
+                      BCON_INT64(post_id), "timestamp", BCON_INT64(timestamp),
+                      "}", "]", "$sort", "{", "timestamp", BCON_INT32(-1), "}",
+                      "$slice", BCON_INT64(_max_timeline_len), "}", "}");
+  } else {
+    update = BCON_NEW("$push", "{", "posts", "{", "$each", "[", "{", "post_id",
+                      BCON_INT64(post_id), "timestamp", BCON_INT64(timestamp),
+                      "}", "]", "$position", BCON_INT32(0), "}", "}");
+  }
   bson_error_t error;
   bson_t reply;
   auto update_span = opentracing::Tracer::Global()->StartSpan(
@@ -159,6 +202,18 @@ void UserTimelineHandler::WriteUserTimeline(
                                                    true, &reply, &error);
   update_span->Finish();
 
+  // A post that opened a new bucket may have pushed older buckets past
+  // _max_timeline_len.
+  bson_iter_t iter;
+  bson_iter_t updated_existing;
+  if (updated && _bucket_ms > 0 && _max_timeline_len > 0 &&
+      bson_iter_init(&iter, &reply) &&
+      bson_iter_find_descendant(&iter, "lastErrorObject.updatedExisting",
+                                &updated_existing) &&
+      !bson_iter_as_bool(&updated_existing)) {
+    _TrimBuckets(collection, user_id);
+  }
+
   if (!updated) {
     // update the newly inserted document (upsert: false)
     updated = mongoc_collection_find_and_modify(collection, query, nullptr,
@@ -190,17 +245,16 @@ void UserTimelineHandler::WriteUserTimeline(
       "write_user_timeline_redis_update_client",
       {opentracing::ChildOf(&span->context())});
   try {
-    if (_redis_client_pool)
-      _redis_client_pool->zadd(std::to_string(user_id), std::to_string(post_id),
-                              timestamp, UpdateType::NOT_EXIST);
-    else if (IsRedisReplicationEnabled()) {
-        _redis_primary_pool->zadd(std::to_string(user_id), std::to_string(post_id),
-                              timestamp, UpdateType::NOT_EXIST);
+    std::string key = std::to_string(user_id);
+    auto pipe = _redis_client_pool ? _redis_client_pool->pipeline(false)
+                : IsRedisReplicationEnabled()
+                    ? _redis_primary_pool->pipeline(false)
+                    : _redis_cluster_client_pool->pipeline(key, false);
+    pipe.zadd(key, std::to_string(post_id), timestamp, UpdateType::NOT_EXIST);
+    if (_max_timeline_len > 0) {
+      pipe.zremrangebyrank(key, 0, -(_max_timeline_len + 1));
     }
-    else
-      _redis_cluster_client_pool->zadd(std::to_string(user_id), std::to_string(post_id),
-                              timestamp, UpdateType::NOT_EXIST);
-
+    pipe.exec();
   } catch (const Error &err) {
     LOG(error) << err.what();
     throw err;
@@ -221,118 +275,22 @@ void UserTimelineHandler::ReadUserTimeline(
       "read_user_timeline_server", {opentracing::ChildOf(parent_span->get())});
   opentracing::Tracer::Global()->Inject(span->context(), writer);
 
-  if (stop <= start || start < 0) {
+  std::vector<std::pair<int64_t, int64_t>> entries;
+  _ReadEntries(user_id, start, stop, span.get(), &entries);
+  if (entries.empty()) {
+    span->Finish();
     return;
   }
-
-  auto redis_span = opentracing::Tracer::Global()->StartSpan(
-      "read_user_timeline_redis_find_client",
-      {opentracing::ChildOf(&span->context())});
-
-  std::vector<std::string> post_ids_str;
-  try {
-    if (_redis_client_pool)
-      _redis_client_pool->zrevrange(std::to_string(user_id), start, stop - 1,
-                                  std::back_inserter(post_ids_str));
-    else if (IsRedisReplicationEnabled()) {
-        _redis_replica_pool->zrevrange(std::to_string(user_id), start, stop - 1,
-            std::back_inserter(post_ids_str));
-    }
-    else
-      _redis_cluster_client_pool->zrevrange(std::to_string(user_id), start, stop - 1,
-                                  std::back_inserter(post_ids_str));
-  } catch (const Error &err) {
-    LOG(error) << err.what();
-    throw err;
-  }
-  redis_span->Finish();
-
   std::vector<int64_t> post_ids;
-  for (auto &post_id_str : post_ids_str) {
-    post_ids.emplace_back(std::stoul(post_id_str));
+  post_ids.reserve(entries.size());
+  for (auto &entry : entries) {
+    post_ids.emplace_back(entry.first);
   }
 
-  // find in mongodb
-  int mongo_start = start + post_ids.size();
-  std::unordered_map<std::string, double> redis_update_map;
-  if (mongo_start < stop) {
-    // Instead find post_ids from mongodb
-    mongoc_client_t *mongodb_client =
-        mongoc_client_pool_pop(_mongodb_client_pool);
-    if (!mongodb_client) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to pop a client from MongoDB pool";
-      throw se;
-    }
-    auto collection = mongoc_client_get_collection(
-        mongodb_client, "user-timeline", "user-timeline");
-    if (!collection) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_MONGODB_ERROR;
-      se.message = "Failed to create collection user-timeline from MongoDB";
-      throw se;
-    }
-
-    bson_t *query = BCON_NEW("user_id", BCON_INT64(user_id));
-    bson_t *opts = BCON_NEW("projection", "{", "posts", "{", "$slice", "[",
-                            BCON_INT32(0), BCON_INT32(stop), "]", "}", "}");
-
-    auto find_span = opentracing::Tracer::Global()->StartSpan(
-        "user_timeline_mongo_find_client",
-        {opentracing::ChildOf(&span->context())});
-    mongoc_cursor_t *cursor =
-        mongoc_collection_find_with_opts(collection, query, opts, nullptr);
-    find_span->Finish();
-    const bson_t *doc;
-    bool found = mongoc_cursor_next(cursor, &doc);
-    if (found) {
-      bson_iter_t iter_0;
-      bson_iter_t iter_1;
-      bson_iter_t post_id_child;
-      bson_iter_t timestamp_child;
-      int idx = 0;
-      bson_iter_init(&iter_0, doc);
-      bson_iter_init(&iter_1, doc);
-      while (bson_iter_find_descendant(
-                 &iter_0, ("posts." + std::to_string(idx) + ".post_id").c_str(),
-                 &post_id_child) &&
-             BSON_ITER_HOLDS_INT64(&post_id_child) &&
-             bson_iter_find_descendant(
-                 &iter_1,
-                 ("posts." + std::to_string(idx) + ".timestamp").c_str(),
-                 &timestamp_child) &&
-             BSON_ITER_HOLDS_INT64(&timestamp_child)) {
-        auto curr_post_id = bson_iter_int64(&post_id_child);
-        auto curr_timestamp = bson_iter_int64(&timestamp_child);
-        if (idx >= mongo_start) {
-          //In mixed workload condition, post may composed between redis and mongo read
-          //mongodb index will shift and duplicate post_id occurs
-          if ( std::find(post_ids.begin(), post_ids.end(), curr_post_id) == post_ids.end() ) {
-            post_ids.emplace_back(curr_post_id);
-          }
-        }
-        redis_update_map.insert(std::make_pair(std::to_string(curr_post_id),
-                                               (double)curr_timestamp));
-        bson_iter_init(&iter_0, doc);
-        bson_iter_init(&iter_1, doc);
-        idx++;
-      }
-    }
-    bson_destroy(opts);
-    bson_destroy(query);
-    mongoc_cursor_destroy(cursor);
-    mongoc_collection_destroy(collection);
-    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
-  }
-
-  std::ifstream times_file("/mydata/adrita/socialnetwork-testbed/socialNetwork/wait_times.json");
-  nlohmann::json times;
-  times_file >> times;
   // Handle post_future
   std::future_status post_future_status;
-  std::future<std::vector<Post>> post_future =
-      std::async(std::launch::async, [&]() {
+  Future<std::vector<Post>> post_future =
+      _executor->Submit([&]() {
         auto post_client_wrapper = _post_client_pool->Pop();
         if (!post_client_wrapper) {
           ServiceException se;
@@ -354,7 +312,7 @@ void UserTimelineHandler::ReadUserTimeline(
         return _return_posts;
       });
   do {
-      switch (post_future_status = post_future.wait_for(parse_duration(times["UserTimelineService-post_future"]["time"]))) {
+      switch (post_future_status = post_future.wait_for(WaitConfig::Global().Get(_post_future_wait_slot))) {
           case std::future_status::deferred:
               break;
           case std::future_status::timeout:
@@ -364,6 +322,125 @@ void UserTimelineHandler::ReadUserTimeline(
       }
   } while (post_future_status != std::future_status::ready);
 
+  try {
+    _return = post_future.get();
+  } catch (...) {
+    LOG(error) << "Failed to get post from post-storage-service";
+    throw;
+  }
+  span->Finish();
+}
+
+void UserTimelineHandler::ReadUserTimelineEntries(
+    std::map<int64_t, int64_t> &_return, int64_t req_id, int64_t user_id,
+    int start, int stop, const std::map<std::string, std::string> &carrier) {
+  // Initialize a span
+  TextMapReader reader(carrier);
+  auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+  auto span = opentracing::Tracer::Global()->StartSpan(
+      "read_user_timeline_entries_server",
+      {opentracing::ChildOf(parent_span->get())});
+
+  std::vector<std::pair<int64_t, int64_t>> entries;
+  _ReadEntries(user_id, start, stop, span.get(), &entries);
+  _return.insert(entries.begin(), entries.end());
+  span->Finish();
+}
+
+// Appends the (post_id, timestamp) pairs of positions [start, stop) of the
+// timeline of user_id, newest first. Positions missing from Redis are read
+// from MongoDB and written back to Redis.
+void UserTimelineHandler::_ReadEntries(
+    int64_t user_id, int start, int stop, opentracing::Span *span,
+    std::vector<std::pair<int64_t, int64_t>> *entries) {
+  // Nothing is kept past _max_timeline_len, so don't look for it in MongoDB.
+  if (_max_timeline_len > 0 && stop > _max_timeline_len) {
+    stop = _max_timeline_len;
+  }
+  if (stop <= start || start < 0) {
+    return;
+  }
+
+  auto redis_span = opentracing::Tracer::Global()->StartSpan(
+      "read_user_timeline_redis_find_client",
+      {opentracing::ChildOf(&span->context())});
+
+  std::vector<std::pair<std::string, double>> post_ids_str;
+  try {
+    if (_redis_client_pool)
+      _redis_client_pool->zrevrange(std::to_string(user_id), start, stop - 1,
+                                  std::back_inserter(post_ids_str));
+    else if (IsRedisReplicationEnabled()) {
+        _redis_replica_pool->zrevrange(std::to_string(user_id), start, stop - 1,
+            std::back_inserter(post_ids_str));
+    }
+    else
+      _redis_cluster_client_pool->zrevrange(std::to_string(user_id), start, stop - 1,
+                                  std::back_inserter(post_ids_str));
+  } catch (const Error &err) {
+    LOG(error) << err.what();
+    throw err;
+  }
+  redis_span->Finish();
+
+  for (auto &post_id_str : post_ids_str) {
+    entries->emplace_back(std::stoul(post_id_str.first),
+                          static_cast<int64_t>(post_id_str.second));
+  }
+
+  // find in mongodb
+  int mongo_start = start + entries->size();
+  if (mongo_start >= stop) {
+    return;
+  }
+  mongoc_client_t *mongodb_client =
+      mongoc_client_pool_pop(_mongodb_client_pool);
+  if (!mongodb_client) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to pop a client from MongoDB pool";
+    throw se;
+  }
+  auto collection = mongoc_client_get_collection(
+      mongodb_client, "user-timeline", _MongoCollection());
+  if (!collection) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_MONGODB_ERROR;
+    se.message = "Failed to create collection user-timeline from MongoDB";
+    mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+    throw se;
+  }
+
+  auto find_span = opentracing::Tracer::Global()->StartSpan(
+      "user_timeline_mongo_find_client",
+      {opentracing::ChildOf(&span->context())});
+  std::vector<std::pair<int64_t, int64_t>> posts;
+  if (_bucket_ms > 0) {
+    _FindBucketedPosts(collection, user_id, stop, &posts);
+  } else {
+    _FindPosts(collection, user_id, stop, &posts);
+  }
+  find_span->Finish();
+  mongoc_collection_destroy(collection);
+  mongoc_client_pool_push(_mongodb_client_pool, mongodb_client);
+
+  std::unordered_map<std::string, double> redis_update_map;
+  size_t redis_count = entries->size();
+  for (int idx = 0; idx < posts.size(); ++idx) {
+    if (idx >= mongo_start) {
+      //In mixed workload condition, post may composed between redis and mongo read
+      //mongodb index will shift and duplicate post_id occurs
+      auto redis_end = entries->begin() + redis_count;
+      if (std::find_if(entries->begin(), redis_end,
+                       [&](const std::pair<int64_t, int64_t> &entry) {
+                         return entry.first == posts[idx].first;
+                       }) == redis_end) {
+        entries->emplace_back(posts[idx]);
+      }
+    }
+    redis_update_map.insert(std::make_pair(std::to_string(posts[idx].first),
+                                           (double)posts[idx].second));
+  }
 
   if (redis_update_map.size() > 0) {
     auto redis_update_span = opentracing::Tracer::Global()->StartSpan(
@@ -390,14 +467,106 @@ void UserTimelineHandler::ReadUserTimeline(
     }
     redis_update_span->Finish();
   }
+}
 
-  try {
-    _return = post_future.get();
-  } catch (...) {
-    LOG(error) << "Failed to get post from post-storage-service";
-    throw;
+// Reads the first stop posts of the single timeline document of user_id.
+void UserTimelineHandler::_FindPosts(
+    mongoc_collection_t *collection, int64_t user_id, int stop,
+    std::vector<std::pair<int64_t, int64_t>> *posts) {
+  bson_t *query = BCON_NEW("user_id", BCON_INT64(user_id));
+  bson_t *opts = BCON_NEW("projection", "{", "posts", "{", "$slice", "[",
+                          BCON_INT32(0), BCON_INT32(stop), "]", "}", "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  if (mongoc_cursor_next(cursor, &doc)) {
+    bson_decode_timestamped_ids(doc, "posts", "post_id", posts);
   }
-  span->Finish();
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
+}
+
+// Deletes the buckets of user_id older than the newest buckets that together
+// hold _max_timeline_len posts. It runs when a post opens a new bucket, so it
+// costs one read per user and bucket period. Failures are only logged, and the
+// next new bucket tries again.
+void UserTimelineHandler::_TrimBuckets(mongoc_collection_t *collection,
+                                       int64_t user_id) {
+  bson_t *query = BCON_NEW("user_id", BCON_INT64(user_id));
+  bson_t *opts = BCON_NEW("projection", "{", "bucket", BCON_BOOL(true),
+                          "size", "{", "$size", BCON_UTF8("$posts"), "}",
+                          "_id", BCON_BOOL(false), "}", "sort", "{", "bucket",
+                          BCON_INT32(-1), "}");
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  bson_iter_t iter;
+  int64_t posts = 0;
+  int64_t oldest_kept = 0;
+  bool trim = false;
+  while (!trim && mongoc_cursor_next(cursor, &doc)) {
+    if (bson_iter_init_find(&iter, doc, "size")) {
+      posts += bson_iter_as_int64(&iter);
+    }
+    if (posts >= _max_timeline_len &&
+        bson_iter_init_find(&iter, doc, "bucket")) {
+      oldest_kept = bson_iter_as_int64(&iter);
+      trim = true;
+    }
+  }
+  bson_error_t error;
+  if (mongoc_cursor_error(cursor, &error)) {
+    LOG(warning) << "Failed to read the timeline buckets of user " << user_id
+                 << " from MongoDB: " << error.message;
+    trim = false;
+  }
+  mongoc_cursor_destroy(cursor);
+  bson_destroy(opts);
+  bson_destroy(query);
+  if (!trim) {
+    return;
+  }
+
+  bson_t *selector = BCON_NEW("user_id", BCON_INT64(user_id), "bucket", "{",
+                              "$lt", BCON_INT64(oldest_kept), "}");
+  if (!mongoc_collection_delete_many(collection, selector, nullptr, nullptr,
+                                     &error)) {
+    LOG(warning) << "Failed to delete old timeline buckets of user "
+                 << user_id << " from MongoDB: " << error.message;
+  }
+  bson_destroy(selector);
+}
+
+// Reads the newest stop posts of user_id, newest bucket first, and stops
+// fetching buckets once it has them. Posts inside a bucket may be out of
+// order after a migration, so each bucket is sorted by timestamp.
+void UserTimelineHandler::_FindBucketedPosts(
+    mongoc_collection_t *collection, int64_t user_id, int stop,
+    std::vector<std::pair<int64_t, int64_t>> *posts) {
+  bson_t *query = BCON_NEW("user_id", BCON_INT64(user_id));
+  // Most reads are served by the newest bucket or two.
+  bson_t *opts = BCON_NEW("projection", "{", "posts", BCON_BOOL(true), "_id",
+                          BCON_BOOL(false), "}", "sort", "{", "bucket",
+                          BCON_INT32(-1), "}", "batchSize", BCON_INT32(2));
+  mongoc_cursor_t *cursor =
+      mongoc_collection_find_with_opts(collection, query, opts, nullptr);
+  const bson_t *doc;
+  while (posts->size() < stop && mongoc_cursor_next(cursor, &doc)) {
+    size_t begin = posts->size();
+    bson_decode_timestamped_ids(doc, "posts", "post_id", posts);
+    std::stable_sort(posts->begin() + begin, posts->end(),
+                     [](const std::pair<int64_t, int64_t> &a,
+                        const std::pair<int64_t, int64_t> &b) {
+                       return a.second > b.second;
+                     });
+  }
+  if (posts->size() > stop) {
+    posts->resize(stop);
+  }
+  bson_destroy(opts);
+  bson_destroy(query);
+  mongoc_cursor_destroy(cursor);
 }
 
 }  // namespace social_network
@@ -1,8 +1,4 @@
 #include <signal.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include <boost/program_options.hpp>
 
@@ -16,10 +12,6 @@
 #include "../utils_thrift.h"
 #include "UserTimelineHandler.h"
 
-using apache::thrift::protocol::TBinaryProtocolFactory;
-using apache::thrift::server::TThreadedServer;
-using apache::thrift::transport::TFramedTransportFactory;
-using apache::thrift::transport::TServerSocket;
 using namespace social_network;
 
 void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
@@ -61,9 +53,29 @@ int main(int argc, char *argv[]) {
 
   int port = config_json["user-timeline-service"]["port"];
 
+  std::string wait_times_path = config_json["user-timeline-service"].value(
+      "wait_times_path", DEFAULT_WAIT_TIMES_PATH);
+  int wait_times_poll_ms =
+      config_json["user-timeline-service"].value("wait_times_poll_ms", 1000);
+  WaitConfig::Global().Load(wait_times_path);
+  WaitConfig::Global().Start(wait_times_poll_ms);
+  InstallSighupReload();
+
+  int executor_threads =
+      config_json["user-timeline-service"].value("executor_threads", 64);
+  int executor_max_queued =
+      config_json["user-timeline-service"].value("executor_max_queued", 0);
+  Executor executor("user-timeline-service", executor_threads, executor_max_queued);
+  int64_t max_timeline_len =
+      config_json["user-timeline-service"].value("user_timeline_max_len", 0);
+  int64_t bucket_ms =
+      config_json["user-timeline-service"].value("timeline_bucket_ms", 0);
+
   int post_storage_port = config_json["post-storage-service"]["port"];
   std::string post_storage_addr = config_json["post-storage-service"]["addr"];
   int post_storage_conns = config_json["post-storage-service"]["connections"];
+  int post_storage_min_conns =
+      config_json["post-storage-service"].value("min_connections", 0);
   int post_storage_timeout = config_json["post-storage-service"]["timeout_ms"];
   int post_storage_keepalive =
       config_json["post-storage-service"]["keepalive_ms"];
@@ -87,9 +99,9 @@ int main(int argc, char *argv[]) {
   }
 
   ClientPool<ThriftClient<PostStorageServiceClient>> post_storage_client_pool(
-      "post-storage-client", post_storage_addr, post_storage_port, 0,
-      post_storage_conns, post_storage_timeout, post_storage_keepalive,
-      config_json);
+      "post-storage-client", post_storage_addr, post_storage_port,
+      post_storage_min_conns, post_storage_conns, post_storage_timeout,
+      post_storage_keepalive, config_json);
 
   mongoc_client_t *mongodb_client = mongoc_client_pool_pop(mongodb_client_pool);
   if (!mongodb_client) {
@@ -98,54 +110,58 @@ int main(int argc, char *argv[]) {
   }
   bool r = false;
   while (!r) {
-    r = CreateIndex(mongodb_client, "user-timeline", "user_id", true);
+    r = bucket_ms > 0
+            ? CreateIndex(mongodb_client, "user-timeline",
+                          "user-timeline-buckets", {"user_id", "bucket"}, true)
+            : CreateIndex(mongodb_client, "user-timeline", "user_id", true);
     if (!r) {
       LOG(error) << "Failed to create mongodb index, try again";
       sleep(1);
     }
   }
   mongoc_client_pool_push(mongodb_client_pool, mongodb_client);
-  std::shared_ptr<TServerSocket> server_socket =
-      get_server_socket(config_json, "0.0.0.0", port);
 
   if (redis_cluster_flag || redis_cluster_config_flag) {
     RedisCluster redis_client_pool =
         init_redis_cluster_client_pool(config_json, "user-timeline");
-    TThreadedServer server(std::make_shared<UserTimelineServiceProcessor>(
-                               std::make_shared<UserTimelineHandler>(
-                                   &redis_client_pool, mongodb_client_pool,
-                                   &post_storage_client_pool)),
-                           server_socket,
-                           std::make_shared<TFramedTransportFactory>(),
-                           std::make_shared<TBinaryProtocolFactory>());
+    auto server = get_server(
+        config_json, "user-timeline-service",
+        std::make_shared<UserTimelineServiceProcessor>(
+            std::make_shared<UserTimelineHandler>(
+                &redis_client_pool, mongodb_client_pool,
+                &post_storage_client_pool, &executor, max_timeline_len,
+                bucket_ms)),
+        "0.0.0.0", port);
     LOG(info) << "Starting the user-timeline-service server with Redis Cluster support...";
-    server.serve();
+    server->serve();
   }
   else if (redis_replica_config_flag) {
       Redis redis_replica_client_pool = init_redis_replica_client_pool(config_json, "redis-replica");
       Redis redis_primary_client_pool = init_redis_replica_client_pool(config_json, "redis-primary");
-      TThreadedServer server(std::make_shared<UserTimelineServiceProcessor>(
-          std::make_shared<UserTimelineHandler>(
-              &redis_replica_client_pool, &redis_primary_client_pool, mongodb_client_pool,
-              &post_storage_client_pool)),
-          server_socket,
-          std::make_shared<TFramedTransportFactory>(),
-          std::make_shared<TBinaryProtocolFactory>());
+      auto server = get_server(
+          config_json, "user-timeline-service",
+          std::make_shared<UserTimelineServiceProcessor>(
+              std::make_shared<UserTimelineHandler>(
+                  &redis_replica_client_pool, &redis_primary_client_pool, mongodb_client_pool,
+                  &post_storage_client_pool, &executor, max_timeline_len,
+                  bucket_ms)),
+          "0.0.0.0", port);
       LOG(info) << "Starting the user-timeline-service server with replicated Redis support...";
-      server.serve();
+      server->serve();
 
   }
   else {
     Redis redis_client_pool =
         init_redis_client_pool(config_json, "user-timeline");
-    TThreadedServer server(std::make_shared<UserTimelineServiceProcessor>(
-                               std::make_shared<UserTimelineHandler>(
-                                   &redis_client_pool, mongodb_client_pool,
-                                   &post_storage_client_pool)),
-                           server_socket,
-                           std::make_shared<TFramedTransportFactory>(),
-                           std::make_shared<TBinaryProtocolFactory>());
+    auto server = get_server(
+        config_json, "user-timeline-service",
+        std::make_shared<UserTimelineServiceProcessor>(
+            std::make_shared<UserTimelineHandler>(
+                &redis_client_pool, mongodb_client_pool,
+                &post_storage_client_pool, &executor, max_timeline_len,
+                bucket_ms)),
+        "0.0.0.0", port);
     LOG(info) << "Starting the user-timeline-service server...";
-    server.serve();
+    server->serve();
   }
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINECONSUMER_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINECONSUMER_H_
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "../MessageQueue.h"
+#include "../logger.h"
+#include "HomeTimelineMessage.h"
+
+// Longest wait between two writes of a failed batch.
+#define HOME_TIMELINE_CONSUMER_MAX_BACKOFF_MS 10000
+
+namespace social_network {
+
+/*
+ * Batches the messages of one write-home-timeline consumer.
+ *
+ * Decoded messages are buffered until batch_size of them have arrived or
+ * batch_flush_ms has passed, then handed to write together. Deliveries of a
+ * consumer are tagged in increasing order, so one ack with multiple settles
+ * the whole batch once write returns. Malformed messages are acked and
+ * dropped right away.
+ *
+ * If write throws, the batch stays unacknowledged and is written again after
+ * retry_backoff_ms, doubling up to HOME_TIMELINE_CONSUMER_MAX_BACKOFF_MS.
+ * Messages that arrive in the meantime join it. After max_attempts failed
+ * writes its messages are written one at a time, and those that still fail
+ * are rejected without requeueing. RabbitMQ then dead-letters them if the
+ * queue has a dead-letter-exchange policy, and drops them otherwise.
+ *
+ * write is HomeTimelineWriter::Write in WriteHomeTimelineService; anything
+ * else can stand in for it, and the queue can be a LocalMessageQueue, so the
+ * batching runs without RabbitMQ or Redis.
+ */
+class HomeTimelineConsumer {
+ public:
+  using WriteFn = std::function<void(const std::vector<HomeTimelineMessage> &)>;
+
+  HomeTimelineConsumer(MessageQueueConsumer *queue, WriteFn write,
+                       size_t batch_size, int batch_flush_ms, int max_attempts,
+                       int retry_backoff_ms);
+
+  // Consumes until queue->Stop() is called.
+  void Run();
+  void Flush();
+
+ private:
+  MessageQueueConsumer *_queue;
+  WriteFn _write;
+  size_t _batch_size;
+  int _batch_flush_ms;
+  int _max_attempts;
+  int _retry_backoff_ms;
+
+  std::vector<HomeTimelineMessage> _batch;
+  std::vector<uint64_t> _tags;
+  // Failed writes of _batch, and when to write it again.
+  int _attempts;
+  std::chrono::steady_clock::time_point _retry_at;
+
+  void _OnMessage(const char *body, size_t size, uint64_t tag);
+  void _WriteEach();
+};
+
+HomeTimelineConsumer::HomeTimelineConsumer(MessageQueueConsumer *queue,
+                                           WriteFn write, size_t batch_size,
+                                           int batch_flush_ms,
+                                           int max_attempts,
+                                           int retry_backoff_ms) {
+  _queue = queue;
+  _write = std::move(write);
+  _batch_size = std::max<size_t>(batch_size, 1);
+  _batch_flush_ms = std::max(batch_flush_ms, 1);
+  _max_attempts = std::max(max_attempts, 1);
+  _retry_backoff_ms = std::max(retry_backoff_ms, 1);
+  _batch.reserve(_batch_size);
+  _tags.reserve(_batch_size);
+  _attempts = 0;
+}
+
+void HomeTimelineConsumer::Run() {
+  _queue->SetTimer(_batch_flush_ms, [this]() { Flush(); });
+  _queue->Run([this](const char *body, size_t size, uint64_t tag) {
+    _OnMessage(body, size, tag);
+  });
+}
+
+void HomeTimelineConsumer::_OnMessage(const char *body, size_t size,
+                                      uint64_t tag) {
+  HomeTimelineMessage msg;
+  if (!decode_home_timeline_message(body, size, &msg)) {
+    LOG(error) << "Dropping malformed write-home-timeline message of " << size
+               << " bytes";
+    _queue->Ack(tag, false);
+    return;
+  }
+  _batch.emplace_back(std::move(msg));
+  _tags.push_back(tag);
+  if (_batch.size() >= _batch_size) {
+    Flush();
+  }
+}
+
+void HomeTimelineConsumer::Flush() {
+  if (_batch.empty()) {
+    return;
+  }
+  auto now = std::chrono::steady_clock::now();
+  if (_attempts > 0 && now < _retry_at) {
+    return;
+  }
+  try {
+    _write(_batch);
+    _queue->Ack(_tags.back(), true);
+  } catch (...) {
+    if (++_attempts < _max_attempts) {
+      int backoff_ms = _retry_backoff_ms;
+      for (int i = 1; i < _attempts &&
+                      backoff_ms < HOME_TIMELINE_CONSUMER_MAX_BACKOFF_MS;
+           ++i) {
+        backoff_ms *= 2;
+      }
+      backoff_ms = std::min(backoff_ms, HOME_TIMELINE_CONSUMER_MAX_BACKOFF_MS);
+      // Every write of the batch is idempotent, so it is simply written
+      // again.
+      LOG(warning) << "Failed to write " << _batch.size()
+                   << " posts to home timelines (attempt " << _attempts
+                   << " of " << _max_attempts << "), retrying in "
+                   << backoff_ms << " ms";
+      _retry_at = now + std::chrono::milliseconds(backoff_ms);
+      return;
+    }
+    _WriteEach();
+  }
+  _batch.clear();
+  _tags.clear();
+  _attempts = 0;
+}
+
+// Writes the messages of a batch that failed _max_attempts times one at a
+// time, so a single bad message does not take the others with it.
+void HomeTimelineConsumer::_WriteEach() {
+  std::vector<HomeTimelineMessage> single(1);
+  for (size_t i = 0; i < _batch.size(); ++i) {
+    single[0] = std::move(_batch[i]);
+    try {
+      _write(single);
+      _queue->Ack(_tags[i], false);
+    } catch (...) {
+      LOG(error) << "Giving up on writing post " << single[0].post_id
+                 << " to home timelines after " << _max_attempts
+                 << " attempts, rejecting it";
+      _queue->Reject(_tags[i], false, false);
+    }
+  }
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINECONSUMER_H_
@@ -0,0 +1,164 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINEMESSAGE_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINEMESSAGE_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+// Messages on the write-home-timeline queue start with a format byte.
+// Messages from producers that predate the byte are JSON and start with '{'.
+#define HOME_TIMELINE_MESSAGE_FORMAT_JSON '{'
+// Unsigned LEB128 varints for the integers, length-prefixed strings for the
+// tracing carrier.
+#define HOME_TIMELINE_MESSAGE_FORMAT_BINARY 0x01
+
+namespace social_network {
+using json = nlohmann::json;
+
+// A post to add to the home timelines of its author's followers and of the
+// users it mentions.
+struct HomeTimelineMessage {
+  int64_t req_id;
+  int64_t post_id;
+  int64_t user_id;
+  int64_t timestamp;
+  std::vector<int64_t> user_mentions_id;
+  std::map<std::string, std::string> carrier;
+};
+
+void append_varint(std::string *out, uint64_t value) {
+  while (value >= 0x80) {
+    out->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out->push_back(static_cast<char>(value));
+}
+
+bool read_varint(const char **pos, const char *end, uint64_t *value) {
+  uint64_t result = 0;
+  for (int shift = 0; shift < 64 && *pos < end; shift += 7) {
+    auto byte = static_cast<uint8_t>(*(*pos)++);
+    result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool read_string(const char **pos, const char *end, std::string *value) {
+  uint64_t size;
+  if (!read_varint(pos, end, &size) ||
+      size > static_cast<uint64_t>(end - *pos)) {
+    return false;
+  }
+  value->assign(*pos, size);
+  *pos += size;
+  return true;
+}
+
+std::string encode_home_timeline_message(const HomeTimelineMessage &msg) {
+  std::string out;
+  out.reserve(48 + msg.user_mentions_id.size() * 9);
+  out.push_back(HOME_TIMELINE_MESSAGE_FORMAT_BINARY);
+  append_varint(&out, msg.req_id);
+  append_varint(&out, msg.post_id);
+  append_varint(&out, msg.user_id);
+  append_varint(&out, msg.timestamp);
+  append_varint(&out, msg.user_mentions_id.size());
+  for (auto user_id : msg.user_mentions_id) {
+    append_varint(&out, user_id);
+  }
+  append_varint(&out, msg.carrier.size());
+  for (auto &item : msg.carrier) {
+    append_varint(&out, item.first.size());
+    out.append(item.first);
+    append_varint(&out, item.second.size());
+    out.append(item.second);
+  }
+  return out;
+}
+
+// Returns false if data is not a well-formed message.
+bool decode_home_timeline_message(const char *data, size_t size,
+                                  HomeTimelineMessage *msg) {
+  if (size == 0) {
+    return false;
+  }
+  if (data[0] == HOME_TIMELINE_MESSAGE_FORMAT_JSON) {
+    json msg_json = json::parse(data, data + size, nullptr, false);
+    if (msg_json.is_discarded()) {
+      return false;
+    }
+    try {
+      msg->req_id = msg_json["req_id"];
+      msg->post_id = msg_json["post_id"];
+      msg->user_id = msg_json["user_id"];
+      msg->timestamp = msg_json["timestamp"];
+      msg->user_mentions_id =
+          msg_json["user_mentions_id"].get<std::vector<int64_t>>();
+      msg->carrier.clear();
+      for (auto it = msg_json["carrier"].begin();
+           it != msg_json["carrier"].end(); ++it) {
+        msg->carrier.emplace(it.key(), it.value().get<std::string>());
+      }
+    } catch (const json::exception &) {
+      return false;
+    }
+    return true;
+  }
+  if (data[0] != HOME_TIMELINE_MESSAGE_FORMAT_BINARY) {
+    return false;
+  }
+
+  const char *pos = data + 1;
+  const char *end = data + size;
+  uint64_t fields[4];
+  for (auto &field : fields) {
+    if (!read_varint(&pos, end, &field)) {
+      return false;
+    }
+  }
+  msg->req_id = fields[0];
+  msg->post_id = fields[1];
+  msg->user_id = fields[2];
+  msg->timestamp = fields[3];
+
+  uint64_t count;
+  // Each entry takes at least one byte, which bounds the reservation.
+  if (!read_varint(&pos, end, &count) ||
+      count > static_cast<uint64_t>(end - pos)) {
+    return false;
+  }
+  msg->user_mentions_id.clear();
+  msg->user_mentions_id.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    uint64_t user_id;
+    if (!read_varint(&pos, end, &user_id)) {
+      return false;
+    }
+    msg->user_mentions_id.push_back(user_id);
+  }
+
+  if (!read_varint(&pos, end, &count)) {
+    return false;
+  }
+  msg->carrier.clear();
+  for (uint64_t i = 0; i < count; ++i) {
+    std::string key;
+    std::string value;
+    if (!read_string(&pos, end, &key) || !read_string(&pos, end, &value)) {
+      return false;
+    }
+    msg->carrier.emplace(std::move(key), std::move(value));
+  }
+  return pos == end;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINEMESSAGE_H_
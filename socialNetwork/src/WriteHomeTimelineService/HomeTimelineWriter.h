@@ -0,0 +1,195 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINEWRITER_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINEWRITER_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../../gen-cpp/SocialGraphService.h"
+#include "../ClientPool.h"
+#include "../HomeTimelineService/FanoutWriter.h"
+#include "../ThriftClient.h"
+#include "../logger.h"
+#include "../tracing.h"
+#include "HomeTimelineMessage.h"
+
+namespace social_network {
+
+/*
+ * Adds a batch of posts taken from the write-home-timeline queue to the home
+ * timelines of the authors' followers and of the mentioned users.
+ *
+ * Followers are read in pages of followers_page_size, and the posts of the
+ * batch share FanoutWriter pipelines. Once max_batch_timelines timelines are
+ * pending they are written before more followers are read, which bounds the
+ * memory a batch of popular authors takes. Like WriteHomeTimeline, posts of
+ * authors with at least fanout_threshold followers only go to the mentioned
+ * users.
+ */
+class HomeTimelineWriter {
+ public:
+  HomeTimelineWriter(
+      ClientPool<ThriftClient<SocialGraphServiceClient>> *social_graph_client_pool,
+      FanoutWriter *fanout_writer, int followers_page_size,
+      int64_t fanout_threshold, size_t max_batch_timelines);
+
+  // Throws on the first failure. Every write is a ZADD NX, so the caller can
+  // retry the whole batch.
+  void Write(const std::vector<HomeTimelineMessage> &msgs);
+
+ private:
+  ClientPool<ThriftClient<SocialGraphServiceClient>> *_social_graph_client_pool;
+  FanoutWriter *_fanout_writer;
+  int _followers_page_size;
+  int64_t _fanout_threshold;
+  size_t _max_batch_timelines;
+
+  std::vector<FanoutPost> _pending;
+  size_t _pending_timelines;
+
+  void _Add(FanoutPost &&post);
+  void _Flush();
+  void _AddFollowers(SocialGraphServiceClient *, const HomeTimelineMessage &,
+                     opentracing::Span *, FanoutPost *, bool *client_failed);
+};
+
+HomeTimelineWriter::HomeTimelineWriter(
+    ClientPool<ThriftClient<SocialGraphServiceClient>> *social_graph_client_pool,
+    FanoutWriter *fanout_writer, int followers_page_size,
+    int64_t fanout_threshold, size_t max_batch_timelines) {
+  _social_graph_client_pool = social_graph_client_pool;
+  _fanout_writer = fanout_writer;
+  _followers_page_size = std::max(followers_page_size, 1);
+  _fanout_threshold = fanout_threshold;
+  _max_batch_timelines = std::max<size_t>(max_batch_timelines, 1);
+  _pending_timelines = 0;
+}
+
+void HomeTimelineWriter::Write(const std::vector<HomeTimelineMessage> &msgs) {
+  _pending.clear();
+  _pending_timelines = 0;
+  if (msgs.empty()) {
+    return;
+  }
+
+  auto social_graph_client_wrapper = _social_graph_client_pool->Pop();
+  if (!social_graph_client_wrapper) {
+    ServiceException se;
+    se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
+    se.message = "Failed to connect to social-graph-service";
+    throw se;
+  }
+  auto social_graph_client = social_graph_client_wrapper->GetClient();
+
+  // Redis errors from the flushes in between leave the client usable.
+  bool client_failed = false;
+  try {
+    for (auto &msg : msgs) {
+      TextMapReader reader(msg.carrier);
+      auto parent_span = opentracing::Tracer::Global()->Extract(reader);
+      auto span = opentracing::Tracer::Global()->StartSpan(
+          "write_home_timeline_server",
+          {opentracing::ChildOf(parent_span->get())});
+
+      // A mentioned user who also follows the author is written twice, which
+      // ZADD NX makes harmless.
+      FanoutPost post{msg.user_mentions_id, std::to_string(msg.post_id),
+                      msg.timestamp};
+      _AddFollowers(social_graph_client, msg, span.get(), &post,
+                    &client_failed);
+      _Add(std::move(post));
+      span->Finish();
+    }
+  } catch (...) {
+    if (client_failed) {
+      _social_graph_client_pool->Remove(social_graph_client_wrapper);
+    } else {
+      _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
+    }
+    throw;
+  }
+  _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
+  _Flush();
+}
+
+void HomeTimelineWriter::_AddFollowers(SocialGraphServiceClient *client,
+                                       const HomeTimelineMessage &msg,
+                                       opentracing::Span *span,
+                                       FanoutPost *post,
+                                       bool *client_failed) {
+  if (_fanout_threshold > 0) {
+    std::map<std::string, std::string> writer_text_map;
+    TextMapWriter writer(writer_text_map);
+    opentracing::Tracer::Global()->Inject(span->context(), writer);
+    int64_t followers_count;
+    try {
+      followers_count =
+          client->GetFollowerCount(msg.req_id, msg.user_id, writer_text_map);
+    } catch (...) {
+      LOG(error) << "Failed to get follower count from social-network-service";
+      *client_failed = true;
+      throw;
+    }
+    if (followers_count >= _fanout_threshold) {
+      // Followers pull this post from the user timeline when they read
+      // their home timeline.
+      return;
+    }
+  }
+
+  std::vector<int64_t> followers_id;
+  for (int64_t cursor = 0;; cursor = followers_id.back() + 1) {
+    auto followers_span = opentracing::Tracer::Global()->StartSpan(
+        "get_followers_page_client", {opentracing::ChildOf(&span->context())});
+    std::map<std::string, std::string> writer_text_map;
+    TextMapWriter writer(writer_text_map);
+    opentracing::Tracer::Global()->Inject(followers_span->context(), writer);
+    followers_id.clear();
+    try {
+      client->GetFollowersPage(followers_id, msg.req_id, msg.user_id, cursor,
+                               _followers_page_size, writer_text_map);
+    } catch (...) {
+      LOG(error) << "Failed to get followers from social-network-service";
+      *client_failed = true;
+      throw;
+    }
+    followers_span->Finish();
+
+    post->user_ids.insert(post->user_ids.end(), followers_id.begin(),
+                          followers_id.end());
+    if (_pending_timelines + post->user_ids.size() >= _max_batch_timelines) {
+      // Write what this post has so far along with the pending posts.
+      FanoutPost head{std::move(post->user_ids), post->post_id_str,
+                      post->timestamp};
+      post->user_ids.clear();
+      _Add(std::move(head));
+    }
+    if (followers_id.size() < static_cast<size_t>(_followers_page_size)) {
+      break;
+    }
+  }
+}
+
+void HomeTimelineWriter::_Add(FanoutPost &&post) {
+  if (post.user_ids.empty()) {
+    return;
+  }
+  _pending_timelines += post.user_ids.size();
+  _pending.emplace_back(std::move(post));
+  if (_pending_timelines >= _max_batch_timelines) {
+    _Flush();
+  }
+}
+
+void HomeTimelineWriter::_Flush() {
+  if (_pending.empty()) {
+    return;
+  }
+  _fanout_writer->Write(_pending);
+  _pending.clear();
+  _pending_timelines = 0;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_SRC_WRITEHOMETIMELINESERVICE_HOMETIMELINEWRITER_H_
@@ -1,157 +1,103 @@
-
-#include <cpp_redis/cpp_redis>
+#include <algorithm>
 #include <csignal>
-#include <mutex>
-#include <set>
-#include <sstream>
+#include <memory>
+#include <string>
 #include <thread>
+#include <vector>
+
+#include <boost/program_options.hpp>
 
 #include "../../gen-cpp/SocialGraphService.h"
 #include "../../gen-cpp/social_network_types.h"
-#include "../AmqpLibeventHandler.h"
+#include "../AmqpMessageQueue.h"
 #include "../ClientPool.h"
-#include "../RedisClient.h"
+#include "../Executor.h"
+#include "../HomeTimelineService/FanoutWriter.h"
 #include "../ThriftClient.h"
 #include "../logger.h"
 #include "../tracing.h"
 #include "../utils.h"
+#include "../utils_redis.h"
+#include "HomeTimelineConsumer.h"
+#include "HomeTimelineWriter.h"
 
 using namespace social_network;
 
-static std::exception_ptr _teptr;
-static ClientPool<RedisClient> *_redis_client_pool;
+struct WorkerConfig {
+  std::string rabbitmq_addr;
+  int rabbitmq_port;
+  int prefetch;
+  size_t batch_size;
+  int batch_flush_ms;
+  int max_attempts;
+  int retry_backoff_ms;
+  int followers_page_size;
+  int64_t fanout_threshold;
+  size_t max_batch_timelines;
+};
+
 static ClientPool<ThriftClient<SocialGraphServiceClient>>
     *_social_graph_client_pool;
 
 void sigintHandler(int sig) { exit(EXIT_SUCCESS); }
 
-void OnReceivedWorker(const AMQP::Message &msg) {
-  try {
-    json msg_json = json::parse(std::string(msg.body(), msg.bodySize()));
-
-    std::map<std::string, std::string> carrier;
-    for (auto it = msg_json["carrier"].begin(); it != msg_json["carrier"].end();
-         ++it) {
-      carrier.emplace(std::make_pair(it.key(), it.value()));
-    }
-
-    // Jaeger tracing
-    TextMapReader span_reader(carrier);
-    auto parent_span = opentracing::Tracer::Global()->Extract(span_reader);
-    auto span = opentracing::Tracer::Global()->StartSpan(
-        "write_home_timeline_server",
-        {opentracing::ChildOf(parent_span->get())});
-
-    // Extract information from rabbitmq messages
-    int64_t user_id = msg_json["user_id"];
-    int64_t req_id = msg_json["req_id"];
-    int64_t post_id = msg_json["post_id"];
-    int64_t timestamp = msg_json["timestamp"];
-    std::vector<int64_t> user_mentions_id = msg_json["user_mentions_id"];
-
-    // Find followers of the user
-    auto followers_span = opentracing::Tracer::Global()->StartSpan(
-        "get_followers_client", {opentracing::ChildOf(&span->context())});
-    std::map<std::string, std::string> writer_text_map;
-    TextMapWriter writer(writer_text_map);
-    opentracing::Tracer::Global()->Inject(followers_span->context(), writer);
-
-    auto social_graph_client_wrapper = _social_graph_client_pool->Pop();
-    if (!social_graph_client_wrapper) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_THRIFT_CONN_ERROR;
-      se.message = "Failed to connect to social-graph-service";
-      throw se;
-    }
-    auto social_graph_client = social_graph_client_wrapper->GetClient();
-    std::vector<int64_t> followers_id;
-    try {
-      social_graph_client->GetFollowers(followers_id, req_id, user_id,
-                                        writer_text_map);
-    } catch (...) {
-      LOG(error) << "Failed to get followers from social-network-service";
-      _social_graph_client_pool->Remove(social_graph_client_wrapper);
-      throw;
-    }
-    _social_graph_client_pool->Keepalive(social_graph_client_wrapper);
-    followers_span->Finish();
-
-    std::set<int64_t> followers_id_set(followers_id.begin(),
-                                       followers_id.end());
-    followers_id_set.insert(user_mentions_id.begin(), user_mentions_id.end());
-
-    // Update Redis ZSet
-    auto redis_span = opentracing::Tracer::Global()->StartSpan(
-        "write_home_timeline_redis_update_client",
-        {opentracing::ChildOf(&span->context())});
-    auto redis_client_wrapper = _redis_client_pool->Pop();
-    if (!redis_client_wrapper) {
-      ServiceException se;
-      se.errorCode = ErrorCode::SE_REDIS_ERROR;
-      se.message = "Cannot connect to Redis server";
-      throw se;
-    }
-    auto redis_client = redis_client_wrapper->GetClient();
-    std::vector<std::string> options{"NX"};
-    std::string post_id_str = std::to_string(post_id);
-    std::string timestamp_str = std::to_string(timestamp);
-    std::multimap<std::string, std::string> value = {
-        {timestamp_str, post_id_str}};
-
-    for (auto &follower_id : followers_id_set) {
-      redis_client->zadd(std::to_string(follower_id), options, value);
-    }
-
-    redis_client->sync_commit();
-    redis_span->Finish();
-    _redis_client_pool->Keepalive(redis_client_wrapper);
-  } catch (...) {
-    LOG(error) << "OnReveived worker error";
-    throw;
-  }
+void WorkerThread(const WorkerConfig &config, FanoutWriter *fanout_writer) {
+  HomeTimelineWriter writer(_social_graph_client_pool, fanout_writer,
+                            config.followers_page_size, config.fanout_threshold,
+                            config.max_batch_timelines);
+  // At most prefetch messages are unacknowledged on this channel, which
+  // bounds both the batch and the messages redelivered after a crash.
+  AmqpMessageQueueConsumer queue(config.rabbitmq_addr, config.rabbitmq_port,
+                                 "write-home-timeline", config.prefetch);
+  HomeTimelineConsumer consumer(
+      &queue,
+      [&writer](const std::vector<HomeTimelineMessage> &msgs) {
+        writer.Write(msgs);
+      },
+      config.batch_size, config.batch_flush_ms, config.max_attempts,
+      config.retry_backoff_ms);
+  consumer.Run();
 }
 
-void HeartbeatSend(AmqpLibeventHandler &handler,
-                   AMQP::TcpConnection &connection, int interval) {
-  while (handler.GetIsRunning()) {
-    LOG(debug) << "Heartbeat sent";
-    connection.heartbeat();
-    sleep(interval);
+void RunWorkers(int n_workers, const WorkerConfig &config,
+                FanoutWriter *fanout_writer) {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < n_workers; ++i) {
+    threads.emplace_back(WorkerThread, std::cref(config), fanout_writer);
+  }
+  for (auto &thread : threads) {
+    thread.join();
   }
-}
-
-void WorkerThread(std::string &addr, int port) {
-  AmqpLibeventHandler handler;
-  AMQP::TcpConnection connection(
-      handler, AMQP::Address(addr, port, AMQP::Login("guest", "guest"), "/"));
-  AMQP::TcpChannel channel(&connection);
-  channel.onError([&handler](const char *message) {
-    LOG(error) << "Channel error: " << message;
-    handler.Stop();
-  });
-  channel.declareQueue("write-home-timeline", AMQP::durable)
-      .onSuccess([&connection](const std::string &name, uint32_t messagecount,
-                               uint32_t consumercount) {
-        LOG(debug) << "Created queue: " << name;
-      });
-  channel.consume("write-home-timeline", AMQP::noack)
-      .onReceived([](const AMQP::Message &msg, uint64_t tag, bool redelivered) {
-        LOG(debug) << "Received: " << std::string(msg.body(), msg.bodySize());
-        OnReceivedWorker(msg);
-      });
-
-  std::thread heartbeat_thread(HeartbeatSend, std::ref(handler),
-                               std::ref(connection), 30);
-  heartbeat_thread.detach();
-  handler.Start();
-  LOG(debug) << "Closing connection.";
-  connection.close();
 }
 
 int main(int argc, char *argv[]) {
   signal(SIGINT, sigintHandler);
   init_logger();
 
+  // Command line options
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help", "produce help message")(
+      "redis-cluster",
+      po::value<bool>()->default_value(false)->implicit_value(true),
+      "Enable redis cluster mode");
+
+  po::variables_map vm;
+  po::store(po::parse_command_line(argc, argv, desc), vm);
+  po::notify(vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << "\n";
+    return 0;
+  }
+
+  bool redis_cluster_flag = false;
+  if (vm.count("redis-cluster")) {
+    if (vm["redis-cluster"].as<bool>()) {
+      redis_cluster_flag = true;
+    }
+  }
+
   SetUpTracer("config/jaeger-config.yml", "write-home-timeline-service");
 
   json config_json;
@@ -159,57 +105,100 @@ int main(int argc, char *argv[]) {
     exit(EXIT_FAILURE);
   }
 
-  int port = config_json["write-home-timeline-service"]["port"];
-  int n_workers = config_json["write-home-timeline-service"]["workers"];
+  auto &service_config = config_json["write-home-timeline-service"];
+  auto &home_timeline_config = config_json["home-timeline-service"];
+  int n_workers = service_config["workers"];
 
-  std::string rabbitmq_addr =
+  WorkerConfig worker_config;
+  worker_config.rabbitmq_addr =
       config_json["write-home-timeline-rabbitmq"]["addr"];
-  int rabbitmq_port = config_json["write-home-timeline-rabbitmq"]["port"];
-
-  std::string redis_addr = config_json["home-timeline-redis"]["addr"];
-  int redis_port = config_json["home-timeline-redis"]["port"];
-  int redis_conns = config_json["home-timeline-redis"]["connections"];
-  int redis_timeout = config_json["home-timeline-redis"]["timeout_ms"];
-  int redis_keepalive = config_json["home-timeline-redis"]["keepalive_ms"];
+  worker_config.rabbitmq_port =
+      config_json["write-home-timeline-rabbitmq"]["port"];
+  worker_config.prefetch = std::max(service_config.value("prefetch", 256), 1);
+  worker_config.batch_size =
+      std::max(service_config.value("batch_size", 64), 1);
+  worker_config.batch_flush_ms =
+      std::max(service_config.value("batch_flush_ms", 5), 1);
+  worker_config.max_attempts =
+      std::max(service_config.value("max_attempts", 5), 1);
+  worker_config.retry_backoff_ms =
+      std::max(service_config.value("retry_backoff_ms", 100), 1);
+  worker_config.max_batch_timelines =
+      std::max(service_config.value("max_batch_timelines", 4096), 1);
+  // Fan-out follows the same rules as WriteHomeTimeline.
+  worker_config.followers_page_size =
+      std::max(home_timeline_config.value("followers_page_size", 1000), 1);
+  worker_config.fanout_threshold =
+      home_timeline_config.value("fanout_threshold", 0);
+  int fanout_chunk_size = home_timeline_config.value("fanout_chunk_size", 256);
+  int fanout_max_in_flight =
+      home_timeline_config.value("fanout_max_in_flight", 4);
+  int64_t home_timeline_max_len =
+      home_timeline_config.value("home_timeline_max_len", 0);
+  int executor_threads = service_config.value("executor_threads", 64);
+  int executor_max_queued = service_config.value("executor_max_queued", 0);
+
+  int redis_cluster_config_flag =
+      config_json["home-timeline-redis"]["use_cluster"];
+  int redis_replica_config_flag =
+      config_json["home-timeline-redis"]["use_replica"];
 
   std::string social_graph_service_addr =
       config_json["social-graph-service"]["addr"];
   int social_graph_service_port = config_json["social-graph-service"]["port"];
   int social_graph_service_conns =
       config_json["social-graph-service"]["connections"];
+  int social_graph_service_min_conns =
+      config_json["social-graph-service"].value("min_connections", 0);
   int social_graph_service_timeout =
       config_json["social-graph-service"]["timeout_ms"];
   int social_graph_service_keepalive =
       config_json["social-graph-service"]["keepalive_ms"];
 
-  ClientPool<RedisClient> redis_client_pool("redis", redis_addr, redis_port, 0,
-                                            redis_conns, redis_timeout,
-                                            redis_keepalive, config_json);
+  if (redis_replica_config_flag &&
+      (redis_cluster_config_flag || redis_cluster_flag)) {
+    LOG(error) << "Can't start service when Redis Cluster and Redis Replica "
+                  "are enabled at the same time";
+    exit(EXIT_FAILURE);
+  }
 
   ClientPool<ThriftClient<SocialGraphServiceClient>> social_graph_client_pool(
       "social-graph-service", social_graph_service_addr,
-      social_graph_service_port, 0, social_graph_service_conns,
-      social_graph_service_timeout, social_graph_service_keepalive, config_json);
-
-  _redis_client_pool = &redis_client_pool;
+      social_graph_service_port, social_graph_service_min_conns,
+      social_graph_service_conns, social_graph_service_timeout,
+      social_graph_service_keepalive, config_json);
   _social_graph_client_pool = &social_graph_client_pool;
 
-  std::unique_ptr<std::thread> threads_ptr[n_workers];
-  for (auto &thread_ptr : threads_ptr) {
-    thread_ptr = std::make_unique<std::thread>(
-        WorkerThread, std::ref(rabbitmq_addr), rabbitmq_port);
+  Executor executor("write-home-timeline-service", executor_threads,
+                    executor_max_queued);
+
+  if (redis_replica_config_flag) {
+    // Home timelines are only written here, so only the primary is needed.
+    Redis redis_primary_client_pool =
+        init_redis_replica_client_pool(config_json, "redis-primary");
+    FanoutWriter fanout_writer(&redis_primary_client_pool, &executor,
+                               fanout_chunk_size, fanout_max_in_flight,
+                               home_timeline_max_len);
+    LOG(info) << "Starting the write-home-timeline-service workers with "
+                 "replicated Redis support...";
+    RunWorkers(n_workers, worker_config, &fanout_writer);
+  } else if (redis_cluster_flag || redis_cluster_config_flag) {
+    RedisCluster redis_cluster_client_pool =
+        init_redis_cluster_client_pool(config_json, "home-timeline");
+    FanoutWriter fanout_writer(&redis_cluster_client_pool, &executor,
+                               fanout_chunk_size, fanout_max_in_flight,
+                               home_timeline_max_len);
+    LOG(info) << "Starting the write-home-timeline-service workers with "
+                 "Redis Cluster support...";
+    RunWorkers(n_workers, worker_config, &fanout_writer);
+  } else {
+    Redis redis_client_pool =
+        init_redis_client_pool(config_json, "home-timeline");
+    FanoutWriter fanout_writer(&redis_client_pool, &executor,
+                               fanout_chunk_size, fanout_max_in_flight,
+                               home_timeline_max_len);
+    LOG(info) << "Starting the write-home-timeline-service workers...";
+    RunWorkers(n_workers, worker_config, &fanout_writer);
   }
-  for (auto &thread_ptr : threads_ptr) {
-    thread_ptr->join();
-    if (_teptr) {
-      try {
-        std::rethrow_exception(_teptr);
-      } catch (const std::exception &ex) {
-        LOG(error) << "Thread exited with exception: " << ex.what();
-        exit(1);
-      }
-    }
-  }
-
   return 0;
 }
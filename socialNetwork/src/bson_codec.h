@@ -0,0 +1,178 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_SRC_BSON_CODEC_H_
+#define SOCIAL_NETWORK_MICROSERVICES_SRC_BSON_CODEC_H_
+
+#include <bson/bson.h>
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../gen-cpp/social_network_types.h"
+
+// Decodes MongoDB documents straight into Thrift structs. Every document and
+// array is walked once with bson_iter_next/bson_iter_recurse, instead of
+// rendering it with bson_as_json and parsing the text again, or looking up
+// "array.N.field" paths from the root for every element.
+
+namespace social_network {
+
+// Numbers may have been stored as int32, int64 or double.
+bool bson_iter_read_int64(const bson_iter_t *iter, int64_t *value) {
+  if (!BSON_ITER_HOLDS_NUMBER(iter)) {
+    return false;
+  }
+  *value = bson_iter_as_int64(iter);
+  return true;
+}
+
+bool bson_iter_read_string(const bson_iter_t *iter, std::string *value) {
+  if (!BSON_ITER_HOLDS_UTF8(iter)) {
+    return false;
+  }
+  uint32_t length;
+  const char *str = bson_iter_utf8(iter, &length);
+  value->assign(str, length);
+  return true;
+}
+
+// Calls fn(bson_iter_t *) with an iterator over the fields of every
+// sub-document of the array iter points at. Stops and returns false as soon
+// as fn returns false or an element is not a document.
+template <class Fn>
+bool bson_iter_for_each_document(const bson_iter_t *iter, Fn fn) {
+  bson_iter_t array;
+  if (!BSON_ITER_HOLDS_ARRAY(iter) || !bson_iter_recurse(iter, &array)) {
+    return false;
+  }
+  while (bson_iter_next(&array)) {
+    bson_iter_t fields;
+    if (!BSON_ITER_HOLDS_DOCUMENT(&array) ||
+        !bson_iter_recurse(&array, &fields) || !fn(&fields)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Reads {id_key: int64, "timestamp": int64} elements of doc[array_key], such
+// as the "posts" of a user timeline or the "followers" of a social graph
+// entry, in array order. Like the path lookups it replaces, it stops at the
+// first element missing either field. Returns false if the array is absent.
+bool bson_decode_timestamped_ids(
+    const bson_t *doc, const char *array_key, const char *id_key,
+    std::vector<std::pair<int64_t, int64_t>> *entries) {
+  bson_iter_t iter;
+  if (!bson_iter_init_find(&iter, doc, array_key)) {
+    return false;
+  }
+  bson_iter_for_each_document(&iter, [&](bson_iter_t *fields) {
+    int64_t id = 0;
+    int64_t timestamp = 0;
+    bool has_id = false;
+    bool has_timestamp = false;
+    while (bson_iter_next(fields)) {
+      const char *key = bson_iter_key(fields);
+      if (strcmp(key, id_key) == 0) {
+        has_id = BSON_ITER_HOLDS_INT64(fields) &&
+                 bson_iter_read_int64(fields, &id);
+      } else if (strcmp(key, "timestamp") == 0) {
+        has_timestamp = BSON_ITER_HOLDS_INT64(fields) &&
+                        bson_iter_read_int64(fields, &timestamp);
+      }
+    }
+    if (!has_id || !has_timestamp) {
+      return false;
+    }
+    entries->emplace_back(id, timestamp);
+    return true;
+  });
+  return true;
+}
+
+// Fills post from a document of the post collection. Fields that are
+// missing keep their default. Returns false if post_id is missing.
+bool bson_decode_post(const bson_t *doc, Post *post) {
+  bson_iter_t iter;
+  if (!bson_iter_init(&iter, doc)) {
+    return false;
+  }
+  bool has_post_id = false;
+  while (bson_iter_next(&iter)) {
+    const char *key = bson_iter_key(&iter);
+    int64_t value;
+    if (strcmp(key, "post_id") == 0) {
+      has_post_id = bson_iter_read_int64(&iter, &post->post_id);
+    } else if (strcmp(key, "timestamp") == 0) {
+      bson_iter_read_int64(&iter, &post->timestamp);
+    } else if (strcmp(key, "req_id") == 0) {
+      bson_iter_read_int64(&iter, &post->req_id);
+    } else if (strcmp(key, "text") == 0) {
+      bson_iter_read_string(&iter, &post->text);
+    } else if (strcmp(key, "post_type") == 0) {
+      if (bson_iter_read_int64(&iter, &value)) {
+        post->post_type = static_cast<PostType::type>(value);
+      }
+    } else if (strcmp(key, "creator") == 0) {
+      bson_iter_t fields;
+      if (BSON_ITER_HOLDS_DOCUMENT(&iter) &&
+          bson_iter_recurse(&iter, &fields)) {
+        while (bson_iter_next(&fields)) {
+          const char *field = bson_iter_key(&fields);
+          if (strcmp(field, "user_id") == 0) {
+            bson_iter_read_int64(&fields, &post->creator.user_id);
+          } else if (strcmp(field, "username") == 0) {
+            bson_iter_read_string(&fields, &post->creator.username);
+          }
+        }
+      }
+    } else if (strcmp(key, "urls") == 0) {
+      bson_iter_for_each_document(&iter, [post](bson_iter_t *fields) {
+        Url url;
+        while (bson_iter_next(fields)) {
+          const char *field = bson_iter_key(fields);
+          if (strcmp(field, "shortened_url") == 0) {
+            bson_iter_read_string(fields, &url.shortened_url);
+          } else if (strcmp(field, "expanded_url") == 0) {
+            bson_iter_read_string(fields, &url.expanded_url);
+          }
+        }
+        post->urls.emplace_back(std::move(url));
+        return true;
+      });
+    } else if (strcmp(key, "user_mentions") == 0) {
+      bson_iter_for_each_document(&iter, [post](bson_iter_t *fields) {
+        UserMention user_mention;
+        while (bson_iter_next(fields)) {
+          const char *field = bson_iter_key(fields);
+          if (strcmp(field, "user_id") == 0) {
+            bson_iter_read_int64(fields, &user_mention.user_id);
+          } else if (strcmp(field, "username") == 0) {
+            bson_iter_read_string(fields, &user_mention.username);
+          }
+        }
+        post->user_mentions.emplace_back(std::move(user_mention));
+        return true;
+      });
+    } else if (strcmp(key, "media") == 0) {
+      bson_iter_for_each_document(&iter, [post](bson_iter_t *fields) {
+        Media media;
+        while (bson_iter_next(fields)) {
+          const char *field = bson_iter_key(fields);
+          if (strcmp(field, "media_id") == 0) {
+            bson_iter_read_int64(fields, &media.media_id);
+          } else if (strcmp(field, "media_type") == 0) {
+            bson_iter_read_string(fields, &media.media_type);
+          }
+        }
+        post->media.emplace_back(std::move(media));
+        return true;
+      });
+    }
+  }
+  return has_post_id;
+}
+
+} // namespace social_network
+
+#endif //SOCIAL_NETWORK_MICROSERVICES_SRC_BSON_CODEC_H_
@@ -6,11 +6,9 @@
 
 namespace social_network {
 
-memcached_pool_st *init_memcached_client_pool(
+memcached_st *init_memcached_client(
     const json &config_json,
-    const std::string &service_name,
-    uint32_t min_size,
-    uint32_t max_size
+    const std::string &service_name
 ) {
   std::string addr = config_json[service_name + "-memcached"]["addr"];
   int port = config_json[service_name + "-memcached"]["port"];
@@ -22,11 +20,39 @@ memcached_pool_st *init_memcached_client_pool(
   if (use_binary_protocol == 1) {
     memcached_behavior_set(memcached_client, MEMCACHED_BEHAVIOR_BINARY_PROTOCOL, 1);
   }
+  return memcached_client;
+}
+
+memcached_pool_st *init_memcached_client_pool(
+    const json &config_json,
+    const std::string &service_name,
+    uint32_t min_size,
+    uint32_t max_size
+) {
+  auto memcached_client = init_memcached_client(config_json, service_name);
   auto memcached_client_pool =
       memcached_pool_create(memcached_client, min_size, max_size);
   return memcached_client_pool;
 }
 
+// Pool for cache fills off the request path. Its clients are created with
+// NOREPLY and BUFFER_REQUESTS, so sets are queued without waiting for replies
+// until memcached_flush_buffers sends them together. Nothing should be read
+// through it.
+memcached_pool_st *init_memcached_write_pool(
+    const json &config_json,
+    const std::string &service_name,
+    uint32_t min_size,
+    uint32_t max_size
+) {
+  auto memcached_client = init_memcached_client(config_json, service_name);
+  memcached_behavior_set(memcached_client, MEMCACHED_BEHAVIOR_NOREPLY, 1);
+  memcached_behavior_set(memcached_client, MEMCACHED_BEHAVIOR_BUFFER_REQUESTS, 1);
+  auto memcached_write_pool =
+      memcached_pool_create(memcached_client, min_size, max_size);
+  return memcached_write_pool;
+}
+
 } // namespace social_network
 
 #endif //SOCIAL_NETWORK_MICROSERVICES_SRC_UTILS_MEMCACHED_H_
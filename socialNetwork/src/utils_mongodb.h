@@ -4,6 +4,9 @@
 #include <mongoc.h>
 #include <bson/bson.h>
 
+#include <string>
+#include <vector>
+
 #define SERVER_SELECTION_TIMEOUT_MS 300
 
 namespace social_network {
@@ -83,6 +86,49 @@ bool CreateIndex(
   return r;
 }
 
+// Creates an ascending index on the fields of index, in order, for a
+// collection whose name differs from its database.
+bool CreateIndex(
+    mongoc_client_t *client,
+    const std::string &db_name,
+    const std::string &collection_name,
+    const std::vector<std::string> &index,
+    bool unique) {
+  mongoc_database_t *db;
+  bson_t keys;
+  char *index_name;
+  bson_t *create_indexes;
+  bson_t reply;
+  bson_error_t error;
+  bool r;
+
+  db = mongoc_client_get_database(client, db_name.c_str());
+  bson_init (&keys);
+  for (auto &field : index) {
+    BSON_APPEND_INT32(&keys, field.c_str(), 1);
+  }
+  index_name = mongoc_collection_keys_to_index_string(&keys);
+  create_indexes = BCON_NEW (
+      "createIndexes", BCON_UTF8(collection_name.c_str()),
+      "indexes", "[", "{",
+          "key", BCON_DOCUMENT (&keys),
+          "name", BCON_UTF8 (index_name),
+          "unique", BCON_BOOL(unique),
+      "}", "]");
+  r = mongoc_database_write_command_with_opts (
+      db, create_indexes, NULL, &reply, &error);
+  if (!r) {
+    LOG(error) << "Error in createIndexes: " << error.message;
+  }
+  bson_free (index_name);
+  bson_destroy (&reply);
+  bson_destroy (create_indexes);
+  bson_destroy (&keys);
+  mongoc_database_destroy(db);
+
+  return r;
+}
+
 } // namespace social_network
 
 #endif //SOCIAL_NETWORK_MICROSERVICES_SRC_UTILS_MONGODB_H_
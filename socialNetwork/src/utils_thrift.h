@@ -3,38 +3,145 @@
 
 #include <string>
 #include <nlohmann/json.hpp>
+#include <thrift/TProcessor.h>
+#include <thrift/concurrency/PlatformThreadFactory.h>
+#include <thrift/concurrency/ThreadManager.h>
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/server/TNonblockingServer.h>
+#include <thrift/server/TThreadPoolServer.h>
+#include <thrift/server/TThreadedServer.h>
+#include <thrift/transport/TBufferTransports.h>
+#include <thrift/transport/TNonblockingServerSocket.h>
+#include <thrift/transport/TNonblockingSSLServerSocket.h>
 #include <thrift/transport/TServerSocket.h>
 #include <thrift/transport/TSSLSocket.h>
 #include <thrift/transport/TSSLServerSocket.h>
 
+#include "PipelinedServer.h"
+#include "logger.h"
+
 namespace social_network{
 using json = nlohmann::json;
 using apache::thrift::transport::TServerSocket;
 using apache::thrift::transport::TSSLServerSocket;
 using apache::thrift::transport::TSSLSocketFactory;
+using apache::thrift::TProcessor;
+using apache::thrift::concurrency::PlatformThreadFactory;
+using apache::thrift::concurrency::ThreadManager;
+using apache::thrift::protocol::TBinaryProtocolFactory;
+using apache::thrift::server::TNonblockingServer;
+using apache::thrift::server::TServer;
+using apache::thrift::server::TThreadPoolServer;
+using apache::thrift::server::TThreadedServer;
+using apache::thrift::transport::TFramedTransportFactory;
+using apache::thrift::transport::TNonblockingServerSocket;
+using apache::thrift::transport::TNonblockingServerTransport;
+using apache::thrift::transport::TNonblockingSSLServerSocket;
+
+std::shared_ptr<TSSLSocketFactory> get_ssl_socket_factory(const json &config_json) {
+  std::string cert_path = config_json["ssl"]["serverCertPath"];
+  std::string key_path = config_json["ssl"]["serverKeyPath"];
+  std::string ca_path = config_json["ssl"]["caPath"];
+  std::string ciphers = config_json["ssl"]["ciphers"];
+
+  std::shared_ptr<TSSLSocketFactory> ssl_socket_factory;
+  ssl_socket_factory = std::make_shared<TSSLSocketFactory>();
+  ssl_socket_factory->loadCertificate(cert_path.c_str());
+  ssl_socket_factory->loadPrivateKey(key_path.c_str());
+  ssl_socket_factory->ciphers(ciphers);
+  // if (config_json["ssl"]["verifyClient"]) {
+  //   ssl_socket_factory->loadTrustedCertificates(ca_path.c_str());
+  //   ssl_socket_factory->authenticate(true);
+  // }
+  return ssl_socket_factory;
+}
 
 std::shared_ptr<TServerSocket> get_server_socket(const json &config_json, const std::string &address, int port) {
   bool ssl_enabled = config_json["ssl"]["enabled"];
   if (ssl_enabled) {
-    std::string cert_path = config_json["ssl"]["serverCertPath"];
-    std::string key_path = config_json["ssl"]["serverKeyPath"];
-    std::string ca_path = config_json["ssl"]["caPath"];
-    std::string ciphers = config_json["ssl"]["ciphers"];
-
-    std::shared_ptr<TSSLSocketFactory> ssl_socket_factory;
-    ssl_socket_factory = std::make_shared<TSSLSocketFactory>();
-    ssl_socket_factory->loadCertificate(cert_path.c_str());
-    ssl_socket_factory->loadPrivateKey(key_path.c_str());
-    ssl_socket_factory->ciphers(ciphers);
-    // if (config_json["ssl"]["verifyClient"]) {
-    //   ssl_socket_factory->loadTrustedCertificates(ca_path.c_str());
-    //   ssl_socket_factory->authenticate(true);
-    // }
-    return std::make_shared<TSSLServerSocket>(address, port, ssl_socket_factory);
+    return std::make_shared<TSSLServerSocket>(address, port, get_ssl_socket_factory(config_json));
   }
   return std::make_shared<TServerSocket>(address, port);
 };
 
+std::shared_ptr<TNonblockingServerTransport> get_nonblocking_server_socket(const json &config_json, const std::string &address, int port) {
+  bool ssl_enabled = config_json["ssl"]["enabled"];
+  if (ssl_enabled) {
+    return std::make_shared<TNonblockingSSLServerSocket>(address, port, get_ssl_socket_factory(config_json));
+  }
+  return std::make_shared<TNonblockingServerSocket>(address, port);
+}
+
+std::shared_ptr<ThreadManager> get_thread_manager(int workers) {
+  auto thread_manager = ThreadManager::newSimpleThreadManager(workers);
+  thread_manager->threadFactory(std::make_shared<PlatformThreadFactory>());
+  thread_manager->start();
+  return thread_manager;
+}
+
+// Builds the Thrift server selected by "server_mode" in the service's config
+// block. All modes speak framed binary protocol, so clients are unaffected.
+//   threaded:    TThreadedServer, one thread per connection (default).
+//   threadpool:  TThreadPoolServer, connections are served by
+//                "server_workers" threads. A pooled connection holds its
+//                worker while it stays open, so size the pool above the
+//                number of client connections.
+//   nonblocking: TNonblockingServer, "server_io_threads" epoll event loops
+//                read and write frames and hand complete requests to
+//                "server_workers" threads.
+//   pipelined:   PipelinedServer, a reader thread per connection hands every
+//                request to "server_workers" threads as soon as it arrives,
+//                so one connection carries many concurrent calls. Needed by
+//                clients with "thrift_client.multiplexed_connections" set.
+//                At most "server_max_queued" requests wait for a worker
+//                before the reader stops reading. SSL is not supported.
+std::shared_ptr<TServer> get_server(const json &config_json, const std::string &service_name,
+                                    const std::shared_ptr<TProcessor> &processor,
+                                    const std::string &address, int port) {
+  auto &service_config = config_json[service_name];
+  std::string mode = service_config.value("server_mode", "threaded");
+  int workers = service_config.value("server_workers", 64);
+  int io_threads = service_config.value("server_io_threads", 4);
+  int max_queued = service_config.value("server_max_queued", 4096);
+
+  auto protocol_factory = std::make_shared<TBinaryProtocolFactory>();
+  if (mode == "threaded") {
+    LOG(info) << service_name << " uses threaded server";
+    return std::make_shared<TThreadedServer>(
+        processor, get_server_socket(config_json, address, port),
+        std::make_shared<TFramedTransportFactory>(), protocol_factory);
+  } else if (mode == "threadpool") {
+    LOG(info) << service_name << " uses threadpool server with " << workers
+              << " workers";
+    return std::make_shared<TThreadPoolServer>(
+        processor, get_server_socket(config_json, address, port),
+        std::make_shared<TFramedTransportFactory>(), protocol_factory,
+        get_thread_manager(workers));
+  } else if (mode == "nonblocking") {
+    LOG(info) << service_name << " uses nonblocking server with "
+              << io_threads << " io threads and " << workers << " workers";
+    auto server = std::make_shared<TNonblockingServer>(
+        processor, protocol_factory,
+        get_nonblocking_server_socket(config_json, address, port),
+        get_thread_manager(workers));
+    server->setNumIOThreads(io_threads);
+    return server;
+  } else if (mode == "pipelined") {
+    bool ssl_enabled = config_json["ssl"]["enabled"];
+    if (ssl_enabled) {
+      LOG(fatal) << "server_mode pipelined does not support SSL";
+      exit(EXIT_FAILURE);
+    }
+    LOG(info) << service_name << " uses pipelined server with " << workers
+              << " workers";
+    return std::make_shared<PipelinedServer>(
+        processor, get_server_socket(config_json, address, port), workers,
+        max_queued);
+  }
+  LOG(fatal) << "Unknown server_mode " << mode << " for " << service_name;
+  exit(EXIT_FAILURE);
+}
+
 } //namespace social_network
 
 #endif //SOCIAL_NETWORK_MICROSERVICES_SRC_UTILS_THRIFT_H_
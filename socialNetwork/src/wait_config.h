@@ -0,0 +1,85 @@
+#ifndef SOCIAL_NETWORK_MICROSERVICES_WAIT_CONFIG_H
+#define SOCIAL_NETWORK_MICROSERVICES_WAIT_CONFIG_H
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+#include "ReloadableTable.h"
+#include "logger.h"
+
+namespace social_network {
+
+#define DEFAULT_WAIT_TIMES_PATH \
+  "/mydata/adrita/socialnetwork-testbed/socialNetwork/wait_times.json"
+
+/*
+ * Per-future wait times shared by the handlers of a service.
+ *
+ * The wait times file maps "<Service>-<future>" to {"time": "<duration>"},
+ * with durations as accepted by ParseDuration. Snapshots, registration and
+ * reloads are those of ReloadableTable.
+ */
+class WaitConfig : public ReloadableTable<std::chrono::milliseconds> {
+ public:
+  static WaitConfig &Global();
+
+  WaitConfig();
+
+  void Load(const std::string &path);
+
+ private:
+  static bool _LoadFile(const std::vector<std::string> &paths,
+                        std::map<std::string, std::chrono::milliseconds> *);
+};
+
+WaitConfig &WaitConfig::Global() {
+  static WaitConfig wait_config;
+  return wait_config;
+}
+
+WaitConfig::WaitConfig()
+    : ReloadableTable<std::chrono::milliseconds>("wait config",
+                                                 &WaitConfig::_LoadFile) {}
+
+void WaitConfig::Load(const std::string &path) {
+  ReloadableTable<std::chrono::milliseconds>::Load({path});
+}
+
+bool WaitConfig::_LoadFile(
+    const std::vector<std::string> &paths,
+    std::map<std::string, std::chrono::milliseconds> *durations) {
+  std::ifstream file(paths[0]);
+  if (!file.is_open()) {
+    LOG(warning) << "Cannot open " << paths[0];
+    return false;
+  }
+  nlohmann::json raw;
+  try {
+    file >> raw;
+  } catch (const std::exception &e) {
+    // Keep serving the previous snapshot while the file is being rewritten.
+    LOG(warning) << "Cannot parse " << paths[0] << ": " << e.what();
+    return false;
+  }
+  if (!raw.is_object()) {
+    return true;
+  }
+  for (auto entry = raw.begin(); entry != raw.end(); ++entry) {
+    if (!entry->is_object()) {
+      continue;
+    }
+    auto time = entry->find("time");
+    if (time != entry->end() && time->is_string()) {
+      (*durations)[entry.key()] = ParseDuration(time->get<std::string>());
+    }
+  }
+  return true;
+}
+
+}  // namespace social_network
+
+#endif  // SOCIAL_NETWORK_MICROSERVICES_WAIT_CONFIG_H
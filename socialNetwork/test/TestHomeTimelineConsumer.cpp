@@ -0,0 +1,177 @@
+// Runs HomeTimelineConsumer on a LocalMessageQueue with a home timeline write
+// that fails on purpose, and checks how the deliveries are settled: a batch
+// that fails once is written again and acked, and a batch that keeps failing
+// is written one message at a time, acking the messages that succeed and
+// rejecting the rest without requeueing.
+//
+// Usage: TestHomeTimelineConsumer
+
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../src/MessageQueue.h"
+#include "../src/WriteHomeTimelineService/HomeTimelineConsumer.h"
+#include "../src/logger.h"
+
+using namespace social_network;
+
+struct Settlement {
+  uint64_t tag;
+  bool ack;
+  bool multiple;
+  bool requeue;
+};
+
+// Records how deliveries are settled and stops once num_messages of them
+// are.
+class RecordingConsumer : public MessageQueueConsumer {
+ public:
+  RecordingConsumer(LocalMessageQueue *queue, int num_messages)
+      : _queue(queue, 16), _num_messages(num_messages), _settled(0) {}
+
+  void Ack(uint64_t tag, bool multiple) override {
+    settlements.push_back({tag, true, multiple, false});
+    _Settled(multiple ? tag - _settled : 1);
+    _queue.Ack(tag, multiple);
+  }
+  void Reject(uint64_t tag, bool multiple, bool requeue) override {
+    settlements.push_back({tag, false, multiple, requeue});
+    _Settled(multiple ? tag - _settled : 1);
+    _queue.Reject(tag, multiple, requeue);
+  }
+  void SetTimer(int interval_ms, std::function<void()> callback) override {
+    _queue.SetTimer(interval_ms, std::move(callback));
+  }
+  void Run(MessageCallback callback) override {
+    _queue.Run(std::move(callback));
+  }
+  void Stop() override { _queue.Stop(); }
+
+  std::vector<Settlement> settlements;
+
+ private:
+  LocalMessageQueueConsumer _queue;
+  int _num_messages;
+  int _settled;
+
+  void _Settled(int count) {
+    _settled += count;
+    if (_settled >= _num_messages) {
+      Stop();
+    }
+  }
+};
+
+int failures = 0;
+
+void Check(bool ok, const std::string &what) {
+  if (!ok) {
+    std::cerr << "FAILED: " << what << std::endl;
+    failures++;
+  }
+}
+
+void Publish(LocalMessageQueue *queue, const std::vector<int64_t> &post_ids) {
+  for (auto post_id : post_ids) {
+    HomeTimelineMessage msg;
+    msg.req_id = post_id;
+    msg.post_id = post_id;
+    msg.user_id = 1;
+    msg.timestamp = post_id;
+    msg.user_mentions_id = {2, 3};
+    queue->Publish(encode_home_timeline_message(msg));
+  }
+}
+
+// Runs the consumer until every message is settled, or for at most 10
+// seconds.
+void Consume(RecordingConsumer *queue_consumer,
+             HomeTimelineConsumer::WriteFn write, int max_attempts) {
+  HomeTimelineConsumer consumer(queue_consumer, std::move(write), 3, 1,
+                                max_attempts, 1);
+  queue_consumer->SetTimer(10000, [&]() {
+    Check(false, "every message is settled within 10 seconds");
+    queue_consumer->Stop();
+  });
+  consumer.Run();
+}
+
+void TestRetryThenAck() {
+  LocalMessageQueue queue(16);
+  Publish(&queue, {1, 2, 3});
+  RecordingConsumer queue_consumer(&queue, 3);
+  std::vector<size_t> writes;
+  Consume(&queue_consumer,
+          [&](const std::vector<HomeTimelineMessage> &msgs) {
+            writes.push_back(msgs.size());
+            if (writes.size() == 1) {
+              throw std::runtime_error("redis unavailable");
+            }
+          },
+          5);
+
+  Check(writes == std::vector<size_t>({3, 3}),
+        "a failed batch is written again once");
+  Check(queue_consumer.settlements.size() == 1,
+        "a batch that succeeds on retry is settled once");
+  if (!queue_consumer.settlements.empty()) {
+    auto &settlement = queue_consumer.settlements[0];
+    Check(settlement.ack && settlement.multiple && settlement.tag == 3,
+          "a batch that succeeds on retry is acked together");
+  }
+}
+
+void TestRetryThenReject() {
+  LocalMessageQueue queue(16);
+  Publish(&queue, {1, 2, 3});
+  RecordingConsumer queue_consumer(&queue, 3);
+  int batch_writes = 0;
+  std::vector<int64_t> single_writes;
+  Consume(&queue_consumer,
+          [&](const std::vector<HomeTimelineMessage> &msgs) {
+            if (msgs.size() > 1) {
+              batch_writes++;
+              throw std::runtime_error("post 2 cannot be written");
+            }
+            single_writes.push_back(msgs[0].post_id);
+            if (msgs[0].post_id == 2) {
+              throw std::runtime_error("post 2 cannot be written");
+            }
+          },
+          2);
+
+  Check(batch_writes == 2, "a failed batch is retried once with "
+                           "max_attempts 2");
+  Check(single_writes == std::vector<int64_t>({1, 2, 3}),
+        "a batch that keeps failing is written one message at a time");
+  std::set<uint64_t> acked;
+  std::set<uint64_t> rejected;
+  for (auto &settlement : queue_consumer.settlements) {
+    Check(!settlement.multiple, "messages written alone are settled alone");
+    if (settlement.ack) {
+      acked.insert(settlement.tag);
+    } else {
+      Check(!settlement.requeue, "a rejected message is not requeued");
+      rejected.insert(settlement.tag);
+    }
+  }
+  Check(acked == std::set<uint64_t>({1, 3}),
+        "the messages that can be written are acked");
+  Check(rejected == std::set<uint64_t>({2}),
+        "the message that cannot be written is rejected");
+}
+
+int main(int argc, char *argv[]) {
+  init_logger();
+  TestRetryThenAck();
+  TestRetryThenReject();
+  if (failures > 0) {
+    return EXIT_FAILURE;
+  }
+  std::cout << "TestHomeTimelineConsumer passed" << std::endl;
+  return EXIT_SUCCESS;
+}